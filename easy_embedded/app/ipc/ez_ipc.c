@@ -47,11 +47,17 @@
 #define CONFIG_USING_MODULE_NAME     1U
 #endif /* CONFIG_USING_MODULE_NAME */
 
-/**@brief Get the MemBlock structure from the node
+/**@brief Get the IpcMessage structure from the node
  *
  */
-#define GET_BLOCK(node_ptr)\
-    (EZ_LINKEDLIST_GET_PARENT_OF(node_ptr, node, struct MemBlock))
+#define GET_MESSAGE(node_ptr)\
+    (EZ_LINKEDLIST_GET_PARENT_OF(node_ptr, node, IpcMessage))
+
+/**@brief Get the data of a message, located right after its header
+ *
+ */
+#define GET_MESSAGE_DATA(message_ptr)\
+    ((void*)((message_ptr) + 1))
 
 /**@brief Get the instance from the ezmIpc type
  *
@@ -62,6 +68,16 @@
 
 /*****************************************************************************
 * Component Typedefs
+/**@brief Header of a message, allocated in front of its data
+ *
+ */
+typedef struct
+{
+    struct Node node;                   /**< Node in the pending or the ready list */
+    uint16_t    size;                   /**< Size of the data in byte */
+}IpcMessage;
+
+
 /**@brief structure define an IPC instance
  *
  */
@@ -70,6 +86,7 @@ typedef struct
     bool        is_busy;                /**< Store the id of the owner of the instance */
     ezmMemList  memory_list;            /**< Memory list to manage the buffer of the ipc instance*/
     struct Node pending_list_head;      /**< list contains message pending to be sent*/
+    struct Node ready_list_head;        /**< list contains message sent and not released yet*/
     ezmIpc_MessageCallback fnCallback;  /**< Callback function */
 }IpcInstance;
 
@@ -83,14 +100,8 @@ static IpcInstance instance_pool[CONFIG_NUM_OF_IPC_INSTANCE] = {0};    /**< pool
 /*****************************************************************************
 * Function Definitions
 *****************************************************************************/
-/**Function to manipulate the buffer of the ipc. Keyword extern is used because these 
- * functions are not meant to be shared with the user
- */
-extern struct Node*      ezmStcMem_ReserveMemoryBlock(struct Node* free_list_head, uint16_t block_size_byte);
-extern bool              ezmStcMem_MoveBlock(struct Node* move_node, struct Node* from_list_head, struct Node* to_list_head);
-extern struct MemBlock*  GetFreeBlock(void);
-extern void              ReleaseBlock(struct MemBlock* block);
 static void              ezIpc_ResetInstance    (uint8_t instance_index);
+static IpcMessage*       ezIpc_FindMessage      (struct Node *list_head, void *message);
 
 
 /*****************************************************************************
@@ -129,17 +140,19 @@ void *ezIpc_InitMessage(ezmMailBox send_to, uint16_t size_in_byte)
 {
     void            *buffer_address = NULL;
     IpcInstance     *send_to_instance = NULL;
-    struct Node     *pending_node = NULL;
+    IpcMessage      *pending_message = NULL;
 
     if (size_in_byte > 0 && send_to < CONFIG_NUM_OF_IPC_INSTANCE)
     {
         send_to_instance = GET_INSTANCE(send_to);
-        pending_node = ezmStcMem_ReserveMemoryBlock(&send_to_instance->memory_list.free_list_head, size_in_byte);
-        if (NULL != pending_node)
+        pending_message = (IpcMessage*)ezStaticAlloc_Malloc(&send_to_instance->memory_list,
+                                                             sizeof(IpcMessage) + size_in_byte);
+        if (NULL != pending_message)
         {
-            buffer_address = GET_BLOCK(pending_node)->buff;
-            EZ_LINKEDLIST_UNLINK_NODE(pending_node);
-            EZ_LINKEDLIST_ADD_TAIL(&send_to_instance->pending_list_head, pending_node);
+            pending_message->size = size_in_byte;
+            ezLinkedList_InitNode(&pending_message->node);
+            EZ_LINKEDLIST_ADD_TAIL(&send_to_instance->pending_list_head, &pending_message->node);
+            buffer_address = GET_MESSAGE_DATA(pending_message);
         }
     }
 
@@ -151,23 +164,21 @@ bool ezIpc_SendMessage(ezmMailBox send_to, void *message)
 {
     bool        is_success = false;
     IpcInstance *send_to_instance = NULL;
-    struct Node *it_node = NULL;
+    IpcMessage  *sent_message = NULL;
 
     if (NULL != message && send_to < CONFIG_NUM_OF_IPC_INSTANCE)
     {
         send_to_instance = GET_INSTANCE(send_to);
-        EZ_LINKEDLIST_FOR_EACH(it_node, &send_to_instance->pending_list_head)
+        sent_message = ezIpc_FindMessage(&send_to_instance->pending_list_head, message);
+        if (NULL != sent_message)
         {
-            if (GET_BLOCK(it_node)->buff == message)
+            EZ_LINKEDLIST_UNLINK_NODE(&sent_message->node);
+            EZ_LINKEDLIST_ADD_TAIL(&send_to_instance->ready_list_head, &sent_message->node);
+            if (NULL != send_to_instance->fnCallback)
             {
-                ezmStcMem_MoveBlock(it_node, &send_to_instance->pending_list_head, &send_to_instance->memory_list.alloc_list_head);
-                if (NULL != send_to_instance->fnCallback)
-                {
-                    send_to_instance->fnCallback();
-                }
-                is_success = true;
-                break;
+                send_to_instance->fnCallback();
             }
+            is_success = true;
         }
     }
 
@@ -184,10 +195,10 @@ void* ezIpc_ReceiveMessage(ezmMailBox receive_from, uint16_t *message_size)
     {
         instance = GET_INSTANCE(receive_from);
    
-        if (!IS_LIST_EMPTY(&instance->memory_list.alloc_list_head))
+        if (!IS_LIST_EMPTY(&instance->ready_list_head))
         {
-            buffer_address = GET_BLOCK(instance->memory_list.alloc_list_head.next)->buff;
-            *message_size = GET_BLOCK(instance->memory_list.alloc_list_head.next)->buff_size;
+            buffer_address = GET_MESSAGE_DATA(GET_MESSAGE(instance->ready_list_head.next));
+            *message_size = GET_MESSAGE(instance->ready_list_head.next)->size;
         }
     }
     return buffer_address;
@@ -198,11 +209,18 @@ bool ezIpc_ReleaseMessage(ezmMailBox receive_from, void* message)
 {
     bool        is_success = true;
     IpcInstance *instance = NULL;
+    IpcMessage  *released_message = NULL;
 
     if (message != NULL && receive_from < CONFIG_NUM_OF_IPC_INSTANCE)
     {
         instance = GET_INSTANCE(receive_from);
-        is_success = is_success && ezStaticAlloc_Free(&instance->memory_list, message);
+        released_message = ezIpc_FindMessage(&instance->ready_list_head, message);
+        is_success = false;
+        if (NULL != released_message)
+        {
+            EZ_LINKEDLIST_UNLINK_NODE(&released_message->node);
+            is_success = ezStaticAlloc_Free(&instance->memory_list, released_message);
+        }
     }
 
     return is_success;
@@ -235,10 +253,46 @@ static void ezIpc_ResetInstance(uint8_t instance_index)
  
         instance_pool[instance_index].pending_list_head.next = &instance_pool[instance_index].pending_list_head;
         instance_pool[instance_index].pending_list_head.prev = &instance_pool[instance_index].pending_list_head;
+        instance_pool[instance_index].ready_list_head.next = &instance_pool[instance_index].ready_list_head;
+        instance_pool[instance_index].ready_list_head.prev = &instance_pool[instance_index].ready_list_head;
 
         memset(&instance_pool[instance_index].memory_list, 0, sizeof(instance_pool[instance_index].memory_list));
     }
 }
 
+
+/******************************************************************************
+* Function : ezIpc_FindMessage
+*//**
+* \b Description:
+*
+* Find the message owning a data buffer in a list
+*
+* PRE-CONDITION: None
+*
+* POST-CONDITION: None
+*
+* @param    list_head: pending or ready list of an instance
+* @param    message: data buffer returned by ezIpc_InitMessage
+* @return   header of the message, NULL if not found
+*
+*******************************************************************************/
+static IpcMessage *ezIpc_FindMessage(struct Node *list_head, void *message)
+{
+    IpcMessage  *found_message = NULL;
+    struct Node *it_node = NULL;
+
+    EZ_LINKEDLIST_FOR_EACH(it_node, list_head)
+    {
+        if (GET_MESSAGE_DATA(GET_MESSAGE(it_node)) == message)
+        {
+            found_message = GET_MESSAGE(it_node);
+            break;
+        }
+    }
+
+    return found_message;
+}
+
 #endif /* EZ_IPC_ENABLE == 1 */
 /* End of file*/
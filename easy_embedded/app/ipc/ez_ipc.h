@@ -145,8 +145,8 @@ void *ezIpc_InitMessage(ezmMailBox send_to, uint16_t size_in_byte);
 *//** 
 * @brief "Send" the message to the module.
 *
-* @details Send action means in move the memory header from free list to the
-* allocated list. If a callback is set, it will trigger the owner that a
+* @details Send action means in move the message from the pending list to the
+* ready list. If a callback is set, it will trigger the owner that a
 * message is sent.
 *
 * @param[in]    send_to: ipc handle, which the message will be sent to
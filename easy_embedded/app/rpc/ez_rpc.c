@@ -86,6 +86,7 @@ static bool ezRpc_IsCrcActivated(struct ezRpc *rpc_inst);
 static struct ezRpcRequestRecord *ezRpc_GetAvailRecord(struct ezRpc *rpc_inst);
 static void ezRpc_DeserializedData(struct ezRpc *rpc_inst, uint8_t rx_byte);
 static void ezRpc_HandleReceivedMsg(struct ezRpc *rpc_inst);
+static const struct ezRpcService *ezRpc_FindService(struct ezRpc *rpc_inst, uint8_t tag);
 static void ezRpc_CheckTimeoutRecords(struct ezRpc *rpc_inst);
 
 /*Helper functions for debugging */
@@ -131,6 +132,26 @@ ezSTATUS ezRpc_Initialization(struct ezRpc *rpc_inst,
                 buff_size/2);
         }
 
+#if (EZ_RPC_ITEM_POOL == 1U)
+        /* The instance is not thread safe, so both queues can share the pool */
+        if (status == ezSUCCESS
+            && ezObjPool_Init(&rpc_inst->item_pool,
+                              rpc_inst->item_slots,
+                              sizeof(rpc_inst->item_slots[0]),
+                              CONFIG_EZ_RPC_NUM_OF_QUEUE_ITEM) == true)
+        {
+            status = ezQueue_SetItemPool(&rpc_inst->tx_msg_queue, &rpc_inst->item_pool);
+            if (status == ezSUCCESS)
+            {
+                status = ezQueue_SetItemPool(&rpc_inst->rx_msg_queue, &rpc_inst->item_pool);
+            }
+        }
+        else
+        {
+            status = ezFAIL;
+        }
+#endif /* EZ_RPC_ITEM_POOL == 1U */
+
         if (status == ezSUCCESS)
         {
             rpc_inst->service_table = service_table;
@@ -194,6 +215,23 @@ ezSTATUS ezRpc_SetTxRxFunctions(struct ezRpc *rpc_inst,
 }
 
 
+ezSTATUS ezRpc_SetDispatchTable(struct ezRpc *rpc_inst,
+                                const struct ezRpcDispatchTable *dispatch_table)
+{
+    ezSTATUS status = ezFAIL;
+
+    if (rpc_inst != NULL
+        && (dispatch_table == NULL
+            || (dispatch_table->entries != NULL && dispatch_table->modulus > 0)))
+    {
+        rpc_inst->dispatch_table = dispatch_table;
+        status = ezSUCCESS;
+    }
+
+    return status;
+}
+
+
 ezSTATUS ezRPC_CreateRpcRequest(struct ezRpc *rpc_inst,
                                 uint8_t tag,
                                 uint8_t *payload,
@@ -271,7 +309,7 @@ void ezRPC_Run(struct ezRpc *rpc_inst)
         ezRpc_HandleReceivedMsg(rpc_inst);
 
         /* Transmit message */
-        if (ezQueue_GetNumOfElement(&rpc_inst->tx_msg_queue) > 0)
+        if (ezQueue_IsEmpty(&rpc_inst->tx_msg_queue) == false)
         {
             uint8_t *req;
             uint32_t req_size;
@@ -856,11 +894,11 @@ static void ezRpc_HandleReceivedMsg(struct ezRpc *rpc_inst)
     uint8_t *payload = NULL;
     uint32_t payload_size = 0U;
     ezSTATUS status = ezFAIL;
-    bool service_found = false;
+    const struct ezRpcService *service = NULL;
 
     if (rpc_inst != NULL 
         && ezRpc_IsRpcInstanceReady(rpc_inst) == true
-        && ezQueue_GetNumOfElement(&rpc_inst->rx_msg_queue) > 0)
+        && ezQueue_IsEmpty(&rpc_inst->rx_msg_queue) == false)
     {
         status = ezQueue_GetFront(&rpc_inst->rx_msg_queue,
             (void *)&header,
@@ -905,40 +943,32 @@ static void ezRpc_HandleReceivedMsg(struct ezRpc *rpc_inst)
 
         if (status == ezSUCCESS)
         {
-            for (uint32_t i = 0; i < rpc_inst->service_table_size; i++)
+            service = ezRpc_FindService(rpc_inst, header->tag);
+            if (service != NULL)
             {
-                if (rpc_inst->service_table[i].tag == header->tag)
-                {
-                    EZDEBUG("service supported [tag = %d]",
-                        rpc_inst->service_table[i].tag);
+                EZDEBUG("service supported [tag = %d]", service->tag);
 
-                    /* pop header to read payload */
-                    (void)ezQueue_PopFront(&rpc_inst->rx_msg_queue);
+                /* pop header to read payload */
+                (void)ezQueue_PopFront(&rpc_inst->rx_msg_queue);
 
-                    /* get payload data */
-                    status = ezQueue_GetFront(&rpc_inst->rx_msg_queue,
-                        (void *)&payload,
-                        &payload_size);
+                /* get payload data */
+                status = ezQueue_GetFront(&rpc_inst->rx_msg_queue,
+                    (void *)&payload,
+                    &payload_size);
 
 #if(DEBUG_LVL == LVL_TRACE)
-                    if (status == ezSUCCESS)
-                    {
-                        ezRpc_PrintPayload(payload, payload_size);
-                    }
+                if (status == ezSUCCESS)
+                {
+                    ezRpc_PrintPayload(payload, payload_size);
+                }
 #endif /* DEBUG_LVL == LVL_TRACE */
 
-                    if (status == ezSUCCESS &&
-                        rpc_inst->service_table[i].pfnService != NULL)
-                    {
-                        rpc_inst->service_table[i].pfnService(payload, payload_size);
-                    }
-
-                    service_found = true;
-                    break;
+                if (status == ezSUCCESS && service->pfnService != NULL)
+                {
+                    service->pfnService(payload, payload_size);
                 }
             }
-
-            if (service_found == false)
+            else
             {
                 /* no service found for the tag, pop header */
                 (void)ezQueue_PopFront(&rpc_inst->rx_msg_queue);
@@ -951,6 +981,46 @@ static void ezRpc_HandleReceivedMsg(struct ezRpc *rpc_inst)
 }
 
 
+/******************************************************************************
+* Function : ezRpc_FindService
+*//**
+* @Description: this function returns the service of a tag. It indexes the
+* dispatch table if there is one, otherwise it scans the service table
+*
+* @param    *rpc_inst: (IN)rpc instance
+* @param    tag: (IN)tag of the received message
+* @return   pointer to the service or NULL if the tag is not supported
+*
+*******************************************************************************/
+static const struct ezRpcService *ezRpc_FindService(struct ezRpc *rpc_inst, uint8_t tag)
+{
+    const struct ezRpcService *service = NULL;
+    const struct ezRpcService *entry = NULL;
+
+    if (rpc_inst->dispatch_table != NULL)
+    {
+        entry = &rpc_inst->dispatch_table->entries[tag % rpc_inst->dispatch_table->modulus];
+        if (entry->tag == tag)
+        {
+            service = entry;
+        }
+    }
+    else
+    {
+        for (uint32_t i = 0; i < rpc_inst->service_table_size; i++)
+        {
+            if (rpc_inst->service_table[i].tag == tag)
+            {
+                service = &rpc_inst->service_table[i];
+                break;
+            }
+        }
+    }
+
+    return service;
+}
+
+
 /******************************************************************************
 * Function : ezRpc_CheckTimeoutRecords
 *//**
@@ -46,6 +46,18 @@ extern "C" {
 #define CONFIG_NUM_OF_REQUEST       4
 #endif
 
+/* Queue items kept by each instance for the headers and small payloads of
+ * its tx and rx queues, 0 to take them from the buffer of the instance */
+#ifndef CONFIG_EZ_RPC_NUM_OF_QUEUE_ITEM
+#define CONFIG_EZ_RPC_NUM_OF_QUEUE_ITEM     8U
+#endif
+
+#if (EZ_QUEUE_ITEM_POOL == 1U) && (CONFIG_EZ_RPC_NUM_OF_QUEUE_ITEM > 0U)
+#define EZ_RPC_ITEM_POOL    1U
+#else
+#define EZ_RPC_ITEM_POOL    0U
+#endif
+
 
 /*****************************************************************************
 * Component Typedefs
@@ -120,6 +132,19 @@ struct ezRpcService
 };
 
 
+/** @brief Dispatch table generated at build time from a service table, see
+ *  tools/rpc_dispatch_generator. The service of a tag is at entries[tag %
+ *  modulus], the generator picks the modulus so that no two tags collide.
+ *  An entry is valid only if its tag matches. Unused entries hold a tag
+ *  that is not stored at their index, so no received tag matches them.
+ */
+struct ezRpcDispatchTable
+{
+    const struct ezRpcService   *entries;   /**< Entries, modulus elements */
+    uint32_t                    modulus;    /**< Number of entries */
+};
+
+
 /** @brief Data structure holding deserializer related data
  *
  */
@@ -163,6 +188,7 @@ struct ezRpc
 {
     uint32_t            service_table_size; /**< Size of the command table, how many commands are there in total */
     struct ezRpcService *service_table;     /**< Poiter to the command table */
+    const struct ezRpcDispatchTable *dispatch_table; /**< Optional O(1) lookup of service_table */
     struct ezRpcDeserializer deserializer;  /**< Hold deserializer related data */
     struct ezRpcCrc     crc;                /**< Hold crc related data */
     struct ezRpcEncrypt encrypt;            /**< Hold encryption related data */
@@ -172,6 +198,11 @@ struct ezRpc
     RpcTransmit         RpcTransmit;        /**< Function to transmit RPC message */
     RpcReceive          RpcReceive;         /**< Function to receive RPC message */
     struct ezRpcRequestRecord records[CONFIG_NUM_OF_REQUEST]; /* num of request*/
+#if (EZ_RPC_ITEM_POOL == 1U)
+    ezObjPool           item_pool;          /**< Queue items of tx_msg_queue and rx_msg_queue */
+    EZ_OBJ_POOL_SLOT(struct ezQueueItemSlot) item_slots[CONFIG_EZ_RPC_NUM_OF_QUEUE_ITEM];
+    /**< Storage of item_pool, CONFIG_EZ_RPC_NUM_OF_QUEUE_ITEM * sizeof(struct ezQueueItemSlot) bytes */
+#endif /* EZ_RPC_ITEM_POOL == 1U */
 };
 
 
@@ -212,7 +243,9 @@ struct ezRpc
 *//** 
 * @brief This function initializes RPC instance of the RPC module
 *
-* @details
+* @details The headers and small payloads of the tx and rx queues are
+* stored in the CONFIG_EZ_RPC_NUM_OF_QUEUE_ITEM items kept in the instance
+* before the buffer is used. An instance must be used from one context.
 *
 * @param[in]    *rpc_inst: pointer to the rpc instance
 * @param[in]    *buff: pointer to memory provided to this rpc instance
@@ -297,6 +330,35 @@ ezSTATUS ezRpc_SetTxRxFunctions(struct ezRpc *rpc_inst,
                                 RpcReceive rx_function);
 
 
+/*****************************************************************************
+* Function: ezRpc_SetDispatchTable
+*//** 
+* @brief This function sets the generated dispatch table of an RPC instance
+*
+* @details Without a dispatch table, a received message is dispatched by
+* scanning the service table. The dispatch table must be generated from the
+* same services as the service table given at initialization. Passing NULL
+* falls back to the scan.
+*
+* @param[in]    *rpc_inst: pointer to the rpc instance
+* @param[in]    *dispatch_table: generated dispatch table or NULL
+* @return   ezSUCCESS or ezFAIL
+*
+* @pre None
+* @post None
+*
+* \b Example
+* @code
+* ezRpc_SetDispatchTable(&rpc_inst, &my_rpc_dispatch_table);
+* @endcode
+*
+* @see ezRpcDispatchTable
+*
+*****************************************************************************/
+ezSTATUS ezRpc_SetDispatchTable(struct ezRpc *rpc_inst,
+                                const struct ezRpcDispatchTable *dispatch_table);
+
+
 /*****************************************************************************
 * Function: ezRPC_CreateRpcRequest
 *//** 
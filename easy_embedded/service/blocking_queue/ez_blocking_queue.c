@@ -0,0 +1,237 @@
+/*****************************************************************************
+* Filename:         ez_blocking_queue.c
+* Author:           Hai Nguyen
+* Original Date:    18.10.2026
+*
+* ----------------------------------------------------------------------------
+* Contact:          Hai Nguyen
+*                   hainguyen.eeit@gmail.com
+*
+* ----------------------------------------------------------------------------
+* License: This file is published under the license described in LICENSE.md
+*
+*****************************************************************************/
+
+/** @file   ez_blocking_queue.c
+ *  @author Hai Nguyen
+ *  @date   18.10.2026
+ *  @brief  Implementation of the blocking queue component
+ *
+ *  @details
+ */
+
+/*****************************************************************************
+* Includes
+*****************************************************************************/
+#include "ez_blocking_queue.h"
+
+#if (EZ_BLOCKING_QUEUE == 1)
+
+#define DEBUG_LVL   LVL_INFO                /**< logging level */
+#define MOD_NAME    "ez_blocking_queue"     /**< module name */
+
+#include "ez_logging.h"
+#include <string.h>
+
+
+/*****************************************************************************
+* Component Preprocessor Macros
+*****************************************************************************/
+/* None */
+
+
+/*****************************************************************************
+* Component Typedefs
+*****************************************************************************/
+/* None */
+
+
+/*****************************************************************************
+* Component Variable Definitions
+*****************************************************************************/
+/* None */
+
+
+/*****************************************************************************
+* Function Definitions
+*****************************************************************************/
+static uint32_t ezBlockingQueue_GetRemainingTime(uint32_t start_ms, uint32_t timeout_ms);
+
+
+/*****************************************************************************
+* Public functions
+*****************************************************************************/
+ezSTATUS ezBlockingQueue_Create(ezBlockingQueue *queue, uint8_t *buff, uint32_t buff_size)
+{
+    ezSTATUS status = ezFAIL;
+
+    EZTRACE("ezBlockingQueue_Create()");
+
+    if (queue != NULL
+        && ezQueue_CreateQueue(&queue->queue, buff, buff_size) == ezSUCCESS
+        && ezOsal_MutexCreate(&queue->mutex) == EZ_OSAL_OK
+        && ezOsal_CondCreate(&queue->not_empty) == EZ_OSAL_OK
+        && ezOsal_CondCreate(&queue->not_full) == EZ_OSAL_OK)
+    {
+        status = ezSUCCESS;
+    }
+    else
+    {
+        EZERROR("Create blocking queue failed");
+    }
+
+    return status;
+}
+
+
+ezSTATUS ezBlockingQueue_Push(ezBlockingQueue *queue,
+                              void *data,
+                              uint32_t data_size,
+                              uint32_t timeout_ms)
+{
+    ezSTATUS status = ezFAIL;
+    uint32_t start_ms = 0;
+    uint32_t wait_ms = 0;
+
+    EZTRACE("ezBlockingQueue_Push( [size = %lu])", (unsigned long)data_size);
+
+    if (queue != NULL && data != NULL && data_size > 0)
+    {
+        start_ms = ezOsal_GetTimeMs();
+        (void)ezOsal_MutexLock(&queue->mutex);
+
+        status = ezQueue_Push(&queue->queue, data, data_size);
+        while (status != ezSUCCESS)
+        {
+            wait_ms = ezBlockingQueue_GetRemainingTime(start_ms, timeout_ms);
+            if (wait_ms == 0
+                || ezOsal_CondWait(&queue->not_full, &queue->mutex, wait_ms) == EZ_OSAL_ERR)
+            {
+                break;
+            }
+            status = ezQueue_Push(&queue->queue, data, data_size);
+        }
+
+        if (status == ezSUCCESS)
+        {
+            (void)ezOsal_CondSignal(&queue->not_empty);
+        }
+
+        (void)ezOsal_MutexUnlock(&queue->mutex);
+    }
+
+    return status;
+}
+
+
+ezSTATUS ezBlockingQueue_Pop(ezBlockingQueue *queue,
+                             void *data,
+                             uint32_t *data_size,
+                             uint32_t timeout_ms)
+{
+    ezSTATUS status = ezFAIL;
+    uint32_t start_ms = 0;
+    uint32_t wait_ms = 0;
+    void *front_data = NULL;
+    uint32_t front_size = 0;
+
+    EZTRACE("ezBlockingQueue_Pop()");
+
+    if (queue != NULL && data != NULL && data_size != NULL)
+    {
+        start_ms = ezOsal_GetTimeMs();
+        (void)ezOsal_MutexLock(&queue->mutex);
+
+        while (ezQueue_GetFront(&queue->queue, &front_data, &front_size) != ezSUCCESS)
+        {
+            wait_ms = ezBlockingQueue_GetRemainingTime(start_ms, timeout_ms);
+            if (wait_ms == 0
+                || ezOsal_CondWait(&queue->not_empty, &queue->mutex, wait_ms) == EZ_OSAL_ERR)
+            {
+                front_data = NULL;
+                break;
+            }
+        }
+
+        if (front_data != NULL)
+        {
+            if (front_size <= *data_size)
+            {
+                memcpy(data, front_data, front_size);
+                (void)ezQueue_PopFront(&queue->queue);
+                status = ezSUCCESS;
+
+                /* Any waiting producer may fit now, whatever the size of its element */
+                (void)ezOsal_CondBroadcast(&queue->not_full);
+            }
+            else
+            {
+                EZWARNING("Element does not fit, size = %lu", (unsigned long)front_size);
+            }
+            *data_size = front_size;
+        }
+
+        (void)ezOsal_MutexUnlock(&queue->mutex);
+    }
+
+    return status;
+}
+
+
+uint32_t ezBlockingQueue_GetNumOfElement(ezBlockingQueue *queue)
+{
+    uint32_t num_of_element = 0;
+
+    if (queue != NULL)
+    {
+        (void)ezOsal_MutexLock(&queue->mutex);
+        num_of_element = ezQueue_GetNumOfElement(&queue->queue);
+        (void)ezOsal_MutexUnlock(&queue->mutex);
+    }
+
+    return num_of_element;
+}
+
+
+/*****************************************************************************
+* Local functions
+*****************************************************************************/
+
+/*****************************************************************************
+* Function: ezBlockingQueue_GetRemainingTime
+*//**
+* @brief Return the time left before the timeout elapses
+*
+* @details
+*
+* @param[in]    start_ms: time at which the operation started
+* @param[in]    timeout_ms: timeout of the operation
+* @return       Time left in milliseconds, 0 if elapsed
+*
+* @pre None
+* @post None
+*
+* \b Example
+* @code
+* @endcode
+*
+* @see None
+*
+*****************************************************************************/
+static uint32_t ezBlockingQueue_GetRemainingTime(uint32_t start_ms, uint32_t timeout_ms)
+{
+    uint32_t elapsed_ms = 0;
+    uint32_t remaining_ms = EZ_OSAL_WAIT_FOREVER;
+
+    if (timeout_ms != EZ_OSAL_WAIT_FOREVER)
+    {
+        elapsed_ms = ezOsal_GetTimeMs() - start_ms;
+        remaining_ms = (elapsed_ms < timeout_ms) ? (timeout_ms - elapsed_ms) : 0;
+    }
+
+    return remaining_ms;
+}
+
+#endif /* EZ_BLOCKING_QUEUE == 1 */
+
+/* End of file */
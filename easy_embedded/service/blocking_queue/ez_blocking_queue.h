@@ -0,0 +1,216 @@
+/*****************************************************************************
+* Filename:         ez_blocking_queue.h
+* Author:           Hai Nguyen
+* Original Date:    18.10.2026
+*
+* ----------------------------------------------------------------------------
+* Contact:          Hai Nguyen
+*                   hainguyen.eeit@gmail.com
+*
+* ----------------------------------------------------------------------------
+* License: This file is published under the license described in LICENSE.md
+*
+*****************************************************************************/
+
+/** @file   ez_blocking_queue.h
+ *  @author Hai Nguyen
+ *  @date   18.10.2026
+ *  @brief  Public API of the blocking queue component
+ *
+ *  @details Thread-safe bounded queue for producers and consumers running in
+ *  different threads. The elements are stored in an ezQueue, so they have a
+ *  variable size and the bound is the size of the buffer. Push waits until
+ *  there is room for the element, pop waits until there is an element. Both
+ *  take a timeout in milliseconds. Synchronization goes through the OSAL.
+ */
+
+#ifndef _EZ_BLOCKING_QUEUE_H
+#define _EZ_BLOCKING_QUEUE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*****************************************************************************
+* Includes
+*****************************************************************************/
+#if (EZ_BUILD_WITH_CMAKE == 0U)
+#include "ez_target_config.h"
+#endif
+
+#if (EZ_BLOCKING_QUEUE == 1)
+#include <stdint.h>
+#include "ez_utilities_common.h"
+#include "ez_queue.h"
+#include "ez_osal.h"
+
+
+/*****************************************************************************
+* Component Preprocessor Macros
+*****************************************************************************/
+/* None */
+
+
+/*****************************************************************************
+* Component Typedefs
+*****************************************************************************/
+
+/** @brief Blocking queue
+ */
+struct ezBlockingQueue
+{
+    ezQueue queue;          /**< Storage of the elements */
+    ezOsalMutex mutex;      /**< Protects queue */
+    ezOsalCond not_empty;   /**< Signaled when an element is pushed */
+    ezOsalCond not_full;    /**< Signaled when an element is popped */
+};
+
+
+/** @brief Define ezBlockingQueue type
+ */
+typedef struct ezBlockingQueue ezBlockingQueue;
+
+
+/*****************************************************************************
+* Component Variable Definitions
+*****************************************************************************/
+/* None */
+
+
+/*****************************************************************************
+* Function Prototypes
+*****************************************************************************/
+
+/*****************************************************************************
+* Function: ezBlockingQueue_Create
+*//**
+* @brief Create a blocking queue
+*
+* @details
+*
+* @param[in]    queue: queue to be created
+* @param[in]    buff: buffer storing the elements
+* @param[in]    buff_size: size of buff
+* @return       ezSUCCESS or ezFAIL
+*
+* @pre None
+* @post None
+*
+* \b Example
+* @code
+* static ezBlockingQueue msg_queue;
+* static uint8_t msg_buff[256];
+* ezBlockingQueue_Create(&msg_queue, msg_buff, sizeof(msg_buff));
+* @endcode
+*
+* @see ezQueue_CreateQueue
+*
+*****************************************************************************/
+ezSTATUS ezBlockingQueue_Create(ezBlockingQueue *queue, uint8_t *buff, uint32_t buff_size);
+
+
+/*****************************************************************************
+* Function: ezBlockingQueue_Push
+*//**
+* @brief Push a copy of data to the back of the queue
+*
+* @details Waits until there is room for the element or the timeout elapses.
+* An element larger than the queue can ever hold waits for the full timeout.
+*
+* @param[in]    queue: blocking queue
+* @param[in]    data: data of the element
+* @param[in]    data_size: size of data
+* @param[in]    timeout_ms: time to wait in milliseconds, EZ_OSAL_NO_WAIT or
+*               EZ_OSAL_WAIT_FOREVER
+* @return       ezSUCCESS or ezFAIL if the timeout elapsed or the arguments
+*               are invalid
+*
+* @pre queue must be created
+* @post None
+*
+* \b Example
+* @code
+* uint8_t msg[] = {1, 2, 3};
+* ezBlockingQueue_Push(&msg_queue, msg, sizeof(msg), 100);
+* @endcode
+*
+* @see ezBlockingQueue_Pop
+*
+*****************************************************************************/
+ezSTATUS ezBlockingQueue_Push(ezBlockingQueue *queue,
+                              void *data,
+                              uint32_t data_size,
+                              uint32_t timeout_ms);
+
+
+/*****************************************************************************
+* Function: ezBlockingQueue_Pop
+*//**
+* @brief Copy the front element to data and pop it
+*
+* @details Waits until the queue has an element or the timeout elapses. If
+* the front element does not fit in data, it stays in the queue and the
+* function fails with data_size set to the size of the element.
+*
+* @param[in]    queue: blocking queue
+* @param[out]   data: buffer receiving the element
+* @param[inout] data_size: size of data as input, size of the element as output
+* @param[in]    timeout_ms: time to wait in milliseconds, EZ_OSAL_NO_WAIT or
+*               EZ_OSAL_WAIT_FOREVER
+* @return       ezSUCCESS or ezFAIL
+*
+* @pre queue must be created
+* @post None
+*
+* \b Example
+* @code
+* uint8_t msg[16];
+* uint32_t msg_size = sizeof(msg);
+* if (ezBlockingQueue_Pop(&msg_queue, msg, &msg_size, EZ_OSAL_WAIT_FOREVER) == ezSUCCESS)
+* {
+*     Handle(msg, msg_size);
+* }
+* @endcode
+*
+* @see ezBlockingQueue_Push
+*
+*****************************************************************************/
+ezSTATUS ezBlockingQueue_Pop(ezBlockingQueue *queue,
+                             void *data,
+                             uint32_t *data_size,
+                             uint32_t timeout_ms);
+
+
+/*****************************************************************************
+* Function: ezBlockingQueue_GetNumOfElement
+*//**
+* @brief Return the number of elements in the queue
+*
+* @details The value may be outdated as soon as it is returned
+*
+* @param[in]    queue: blocking queue
+* @return       Number of elements
+*
+* @pre queue must be created
+* @post None
+*
+* \b Example
+* @code
+* uint32_t pending = ezBlockingQueue_GetNumOfElement(&msg_queue);
+* @endcode
+*
+* @see None
+*
+*****************************************************************************/
+uint32_t ezBlockingQueue_GetNumOfElement(ezBlockingQueue *queue);
+
+#endif /* EZ_BLOCKING_QUEUE == 1 */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _EZ_BLOCKING_QUEUE_H */
+
+
+/* End of file */
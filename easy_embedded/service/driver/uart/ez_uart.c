@@ -48,8 +48,14 @@
 /*****************************************************************************
 * Component Variable Definitions
 *****************************************************************************/
+#if (EZ_HASH_TABLE == 1U)
+static struct ezHashNode *hw_driver_slots[CONFIG_EZ_UART_NUM_OF_HW_DRIVER_SLOT] = { 0 };
+static struct ezHashTable hw_driver_table = EZ_HASH_TABLE_INIT(hw_driver_slots, EZ_HASH_KEY_STRING);
+/**< Registry of HW driver implementation, keyed by driver name */
+#else
 static struct Node hw_driver_list = EZ_LINKEDLIST_INIT_NODE(hw_driver_list);
 /**< List of HW driver implementation  */
+#endif /* EZ_HASH_TABLE == 1U */
 
 static struct Node instance_list = EZ_LINKEDLIST_INIT_NODE(instance_list);
 /**< Keep tracks of instance register to this driver */
@@ -58,6 +64,7 @@ static struct Node instance_list = EZ_LINKEDLIST_INIT_NODE(instance_list);
 * Function Definitions
 *****************************************************************************/
 static void ezUart_PrintStatus(EZ_DRV_STATUS status);
+static struct ezUartDriver *ezUart_FindHwDriver(const char *driver_name);
 
 
 /*****************************************************************************
@@ -68,16 +75,29 @@ EZ_DRV_STATUS ezUart_SystemRegisterHwDriver(struct ezUartDriver *hw_uart_driver)
     EZ_DRV_STATUS status = STATUS_ERR_GENERIC;
 
     EZTRACE("ezUart_SystemRegisterHwDriver()");
-    if(hw_uart_driver == NULL)
+    if(hw_uart_driver == NULL || hw_uart_driver->common.name == NULL)
     {
         status = STATUS_ERR_ARG;
         EZERROR("hw_uart_driver == NULL");
     }
-    else
+#if (EZ_HASH_TABLE == 1U)
+    else if(ezHashTable_InsertString(&hw_driver_table,
+                                     &hw_uart_driver->hash_node,
+                                     hw_uart_driver->common.name) == true)
+    {
+        status = STATUS_OK;
+    }
+#else
+    else if(ezUart_FindHwDriver(hw_uart_driver->common.name) == NULL)
     {
         EZ_LINKEDLIST_ADD_TAIL(&hw_driver_list, &hw_uart_driver->ll_node);
         status = STATUS_OK;
     }
+#endif /* EZ_HASH_TABLE == 1U */
+    else
+    {
+        EZERROR("Name already registered or registry full");
+    }
 
     return status;
 }
@@ -93,11 +113,23 @@ EZ_DRV_STATUS ezUart_SystemUnregisterHwDriver(struct ezUartDriver *hw_uart_drive
         status = STATUS_ERR_ARG;
         EZERROR("hw_uart_driver == NULL");
     }
-    else
+#if (EZ_HASH_TABLE == 1U)
+    else if(ezHashTable_Remove(&hw_driver_table, &hw_uart_driver->hash_node) == true)
+    {
+        status = STATUS_OK;
+    }
+#else
+    else if(hw_uart_driver->common.name != NULL
+            && ezUart_FindHwDriver(hw_uart_driver->common.name) == hw_uart_driver)
     {
         EZ_LINKEDLIST_UNLINK_NODE(&hw_uart_driver->ll_node);
         status = STATUS_OK;
     }
+#endif /* EZ_HASH_TABLE == 1U */
+    else
+    {
+        status = STATUS_ERR_DRV_NOT_FOUND;
+    }
 
     return status;
 }
@@ -108,7 +140,6 @@ EZ_DRV_STATUS ezUart_RegisterInstance(ezUartDrvInstance_t *inst,
                                       ezDrvCallback callback)
 {
     EZ_DRV_STATUS status = STATUS_ERR_DRV_NOT_FOUND;
-    struct Node* it_node = NULL;
     struct ezUartDriver *uart_drv = NULL;
 
     EZTRACE("ezUart_RegisterInstance(name = %s)", driver_name);
@@ -118,17 +149,13 @@ EZ_DRV_STATUS ezUart_RegisterInstance(ezUartDrvInstance_t *inst,
     }
     else
     {
-        EZ_LINKEDLIST_FOR_EACH(it_node, &hw_driver_list)
+        uart_drv = ezUart_FindHwDriver(driver_name);
+        if(uart_drv != NULL)
         {
-            uart_drv = EZ_LINKEDLIST_GET_PARENT_OF(it_node, ll_node, struct ezUartDriver);
-            if(strcmp(uart_drv->common.name, driver_name) == 0)
-            {
-                inst->driver = (void*)uart_drv;
-                inst->calback = callback;
-                status = STATUS_OK;
-                EZDEBUG("Found driver!");
-                break;
-            }
+            inst->driver = (void*)uart_drv;
+            inst->calback = callback;
+            status = STATUS_OK;
+            EZDEBUG("Found driver!");
         }
     }
 
@@ -438,6 +465,57 @@ static void ezUart_PrintStatus(EZ_DRV_STATUS status)
 }
 
 
+/*****************************************************************************
+* Function: ezUart_FindHwDriver
+*//** 
+* @brief Find a registered HW driver by its name
+*
+* @details
+*
+* @param[in]    driver_name: name of the driver
+* @return       pointer to the driver or NULL if it is not registered
+*
+* @pre None
+* @post None
+*
+* \b Example
+* @code
+* struct ezUartDriver *drv = ezUart_FindHwDriver("uart_1");
+* @endcode
+*
+* @see
+*
+*****************************************************************************/
+static struct ezUartDriver *ezUart_FindHwDriver(const char *driver_name)
+{
+    struct ezUartDriver *uart_drv = NULL;
+#if (EZ_HASH_TABLE == 1U)
+    struct ezHashNode *found_node = NULL;
+
+    found_node = ezHashTable_FindString(&hw_driver_table, driver_name);
+    if(found_node != NULL)
+    {
+        uart_drv = EZ_HASH_TABLE_GET_PARENT_OF(found_node, hash_node, struct ezUartDriver);
+    }
+#else
+    struct Node* it_node = NULL;
+    struct ezUartDriver *it_drv = NULL;
+
+    EZ_LINKEDLIST_FOR_EACH(it_node, &hw_driver_list)
+    {
+        it_drv = EZ_LINKEDLIST_GET_PARENT_OF(it_node, ll_node, struct ezUartDriver);
+        if(strcmp(it_drv->common.name, driver_name) == 0)
+        {
+            uart_drv = it_drv;
+            break;
+        }
+    }
+#endif /* EZ_HASH_TABLE == 1U */
+
+    return uart_drv;
+}
+
+
 
 #endif /* EZ_UART_ENABLE == 1 */
 /* End of file*/
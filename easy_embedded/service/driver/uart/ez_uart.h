@@ -41,12 +41,18 @@ extern "C" {
 #include <stdbool.h>
 
 #include "ez_driver_def.h"
+#include "ez_hash_table.h"
 
 
 /*****************************************************************************
 * Component Preprocessor Macros
 *****************************************************************************/
-/* None */
+/* Number of slots of the HW driver registry, a power of two. Holds up to
+ * CONFIG_EZ_UART_NUM_OF_HW_DRIVER_SLOT - 1 drivers. Unused when the hash
+ * table is disabled, the registry is then a linked list */
+#ifndef CONFIG_EZ_UART_NUM_OF_HW_DRIVER_SLOT
+#define CONFIG_EZ_UART_NUM_OF_HW_DRIVER_SLOT    16U
+#endif /* CONFIG_EZ_UART_NUM_OF_HW_DRIVER_SLOT */
 
 
 /*****************************************************************************
@@ -195,7 +201,11 @@ struct ezHwUartInterface
  */
 struct ezUartDriver
 {
+#if (EZ_HASH_TABLE == 1U)
+    struct ezHashNode           hash_node;  /* node in the registry of hw driver implementation, keyed by name */
+#else
     struct Node                 ll_node;    /* linked list node to link to list of hw driver implmentation */
+#endif /* EZ_HASH_TABLE == 1U */
     struct ezDriverCommon       common;     /* Common data of driver */
     struct ezUartConfiguration  config;     /* Uart related configuration */
     struct ezHwUartInterface    interface;  /* HW API */
@@ -71,9 +71,10 @@ struct ezObserver
 };
 
 
-/** @brief define event_subject type.
+/** @brief define event_subject type. The list counts its observers, so
+ *  ezEventNotifier_GetNumOfObservers does not walk it.
  */
-typedef struct Node ezSubject;
+typedef struct ezCountedList ezSubject;
 
 
 /** @brief define event_observer type.
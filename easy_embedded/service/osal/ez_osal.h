@@ -0,0 +1,443 @@
+/*****************************************************************************
+* Filename:         ez_osal.h
+* Author:           Hai Nguyen
+* Original Date:    18.10.2026
+*
+* ----------------------------------------------------------------------------
+* Contact:          Hai Nguyen
+*                   hainguyen.eeit@gmail.com
+*
+* ----------------------------------------------------------------------------
+* License: This file is published under the license described in LICENSE.md
+*
+*****************************************************************************/
+
+/** @file   ez_osal.h
+ *  @author Hai Nguyen
+ *  @date   18.10.2026
+ *  @brief  Public API of the operating system abstraction layer
+ *
+ *  @details Mutexes, condition variables with timeouts and threads, enough
+ *  to build blocking data structures and thread pools. The backend is chosen at build time: ThreadX,
+ *  FreeRTOS or POSIX threads when no RTOS is enabled. All objects are
+ *  allocated by the caller.
+ */
+
+#ifndef _EZ_OSAL_H
+#define _EZ_OSAL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*****************************************************************************
+* Includes
+*****************************************************************************/
+#if (EZ_BUILD_WITH_CMAKE == 0U)
+#include "ez_target_config.h"
+#endif
+
+#if (EZ_OSAL == 1)
+#include <stdint.h>
+#include <stdbool.h>
+
+#if (EZ_OSAL_THREADX == 1)
+#include "tx_api.h"
+#elif (EZ_OSAL_FREERTOS == 1)
+#include "FreeRTOS.h"
+#include "semphr.h"
+#include "task.h"
+#else
+#include <pthread.h>
+#endif
+
+/*****************************************************************************
+* Component Preprocessor Macros
+*****************************************************************************/
+#define EZ_OSAL_NO_WAIT         0x00        /* Do not wait */
+#define EZ_OSAL_WAIT_FOREVER    0xFFFFFFFF  /* Wait until the operation succeeds */
+
+
+/*****************************************************************************
+* Component Typedefs
+*****************************************************************************/
+
+/** @brief Return status of the OSAL functions
+ */
+typedef enum
+{
+    EZ_OSAL_OK,         /**< Operation success */
+    EZ_OSAL_TIMEOUT,    /**< Timeout elapsed before the operation succeeded */
+    EZ_OSAL_ERR,        /**< Generic error */
+    EZ_OSAL_ERR_ARG,    /**< Invalid input arguments */
+}ezOsalStatus;
+
+
+/** @brief Entry function of a thread
+ *  @param[in]  arg: argument given to ezOsal_ThreadCreate
+ */
+typedef void (*ezOsalThreadFunc)(void *arg);
+
+
+#if (EZ_OSAL_THREADX == 1)
+/** @brief Mutex, ThreadX backend
+ */
+typedef struct
+{
+    TX_MUTEX mutex;             /**< ThreadX mutex */
+}ezOsalMutex;
+
+
+/** @brief Condition variable, ThreadX backend
+ */
+typedef struct
+{
+    TX_SEMAPHORE sem;           /**< Counting semaphore waking the waiters */
+    uint32_t num_of_waiter;     /**< Waiters not signaled yet, protected by the mutex */
+}ezOsalCond;
+
+
+/** @brief Thread, ThreadX backend
+ */
+typedef struct
+{
+    TX_THREAD thread;           /**< ThreadX thread */
+    ezOsalThreadFunc func;      /**< Entry function */
+    void *arg;                  /**< Argument of the entry function */
+}ezOsalThread;
+
+#elif (EZ_OSAL_FREERTOS == 1)
+/** @brief Mutex, FreeRTOS backend
+ */
+typedef struct
+{
+    SemaphoreHandle_t handle;   /**< FreeRTOS mutex handle */
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+    StaticSemaphore_t buff;     /**< Memory of the mutex */
+#endif
+}ezOsalMutex;
+
+
+/** @brief Condition variable, FreeRTOS backend
+ */
+typedef struct
+{
+    SemaphoreHandle_t handle;   /**< Counting semaphore waking the waiters */
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+    StaticSemaphore_t buff;     /**< Memory of the semaphore */
+#endif
+    uint32_t num_of_waiter;     /**< Waiters not signaled yet, protected by the mutex */
+}ezOsalCond;
+
+
+/** @brief Thread, FreeRTOS backend
+ */
+typedef struct
+{
+    TaskHandle_t handle;        /**< FreeRTOS task handle */
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+    StaticTask_t buff;          /**< Memory of the task control block */
+#endif
+    ezOsalThreadFunc func;      /**< Entry function */
+    void *arg;                  /**< Argument of the entry function */
+}ezOsalThread;
+
+#else
+/** @brief Mutex, POSIX backend
+ */
+typedef struct
+{
+    pthread_mutex_t mutex;      /**< POSIX mutex */
+}ezOsalMutex;
+
+
+/** @brief Condition variable, POSIX backend
+ */
+typedef struct
+{
+    pthread_cond_t cond;        /**< POSIX condition variable, on the monotonic clock */
+}ezOsalCond;
+
+
+/** @brief Thread, POSIX backend
+ */
+typedef struct
+{
+    pthread_t thread;           /**< POSIX thread, detached */
+    ezOsalThreadFunc func;      /**< Entry function */
+    void *arg;                  /**< Argument of the entry function */
+}ezOsalThread;
+#endif /* EZ_OSAL_THREADX == 1 */
+
+
+/*****************************************************************************
+* Component Variable Definitions
+*****************************************************************************/
+/* None */
+
+/*****************************************************************************
+* Function Prototypes
+*****************************************************************************/
+
+/*****************************************************************************
+* Function: ezOsal_MutexCreate
+*//**
+* @brief Create a mutex
+*
+* @details
+*
+* @param[in]    mutex: mutex to be created
+* @return       EZ_OSAL_OK if success, else one of the error codes
+*
+* @pre None
+* @post None
+*
+* \b Example
+* @code
+* static ezOsalMutex lock;
+* ezOsal_MutexCreate(&lock);
+* @endcode
+*
+* @see ezOsal_MutexLock
+*
+*****************************************************************************/
+ezOsalStatus ezOsal_MutexCreate(ezOsalMutex *mutex);
+
+
+/*****************************************************************************
+* Function: ezOsal_MutexLock
+*//**
+* @brief Lock a mutex, waiting as long as needed
+*
+* @details
+*
+* @param[in]    mutex: mutex to be locked
+* @return       EZ_OSAL_OK if success, else one of the error codes
+*
+* @pre mutex must be created
+* @post None
+*
+* \b Example
+* @code
+* ezOsal_MutexLock(&lock);
+* counter++;
+* ezOsal_MutexUnlock(&lock);
+* @endcode
+*
+* @see ezOsal_MutexUnlock
+*
+*****************************************************************************/
+ezOsalStatus ezOsal_MutexLock(ezOsalMutex *mutex);
+
+
+/*****************************************************************************
+* Function: ezOsal_MutexUnlock
+*//**
+* @brief Unlock a mutex
+*
+* @details
+*
+* @param[in]    mutex: mutex locked by the calling thread
+* @return       EZ_OSAL_OK if success, else one of the error codes
+*
+* @pre mutex must be locked by the calling thread
+* @post None
+*
+* \b Example
+* @code
+* ezOsal_MutexUnlock(&lock);
+* @endcode
+*
+* @see ezOsal_MutexLock
+*
+*****************************************************************************/
+ezOsalStatus ezOsal_MutexUnlock(ezOsalMutex *mutex);
+
+
+/*****************************************************************************
+* Function: ezOsal_CondCreate
+*//**
+* @brief Create a condition variable
+*
+* @details
+*
+* @param[in]    cond: condition variable to be created
+* @return       EZ_OSAL_OK if success, else one of the error codes
+*
+* @pre None
+* @post None
+*
+* \b Example
+* @code
+* static ezOsalCond not_empty;
+* ezOsal_CondCreate(&not_empty);
+* @endcode
+*
+* @see ezOsal_CondWait
+*
+*****************************************************************************/
+ezOsalStatus ezOsal_CondCreate(ezOsalCond *cond);
+
+
+/*****************************************************************************
+* Function: ezOsal_CondWait
+*//**
+* @brief Unlock the mutex, wait for the condition variable to be signaled,
+* then lock the mutex again
+*
+* @details The wakeup may be spurious, so the caller must check its
+* condition again in a loop.
+*
+* @param[in]    cond: condition variable
+* @param[in]    mutex: mutex locked by the calling thread
+* @param[in]    timeout_ms: time to wait in milliseconds, EZ_OSAL_NO_WAIT
+*               or EZ_OSAL_WAIT_FOREVER
+* @return       EZ_OSAL_OK: woken up
+*               EZ_OSAL_TIMEOUT: timeout elapsed
+*               EZ_OSAL_ERR, EZ_OSAL_ERR_ARG: error
+*
+* @pre mutex must be locked by the calling thread
+* @post mutex is locked by the calling thread
+*
+* \b Example
+* @code
+* ezOsal_MutexLock(&lock);
+* while (is_ready == false)
+* {
+*     ezOsal_CondWait(&not_empty, &lock, EZ_OSAL_WAIT_FOREVER);
+* }
+* ezOsal_MutexUnlock(&lock);
+* @endcode
+*
+* @see ezOsal_CondSignal, ezOsal_CondBroadcast
+*
+*****************************************************************************/
+ezOsalStatus ezOsal_CondWait(ezOsalCond *cond, ezOsalMutex *mutex, uint32_t timeout_ms);
+
+
+/*****************************************************************************
+* Function: ezOsal_CondSignal
+*//**
+* @brief Wake up one thread waiting on the condition variable
+*
+* @details
+*
+* @param[in]    cond: condition variable
+* @return       EZ_OSAL_OK if success, else one of the error codes
+*
+* @pre the mutex given to ezOsal_CondWait must be locked by the calling thread
+* @post None
+*
+* \b Example
+* @code
+* ezOsal_MutexLock(&lock);
+* is_ready = true;
+* ezOsal_CondSignal(&not_empty);
+* ezOsal_MutexUnlock(&lock);
+* @endcode
+*
+* @see ezOsal_CondWait
+*
+*****************************************************************************/
+ezOsalStatus ezOsal_CondSignal(ezOsalCond *cond);
+
+
+/*****************************************************************************
+* Function: ezOsal_CondBroadcast
+*//**
+* @brief Wake up all threads waiting on the condition variable
+*
+* @details
+*
+* @param[in]    cond: condition variable
+* @return       EZ_OSAL_OK if success, else one of the error codes
+*
+* @pre the mutex given to ezOsal_CondWait must be locked by the calling thread
+* @post None
+*
+* \b Example
+* @code
+* ezOsal_CondBroadcast(&not_full);
+* @endcode
+*
+* @see ezOsal_CondWait
+*
+*****************************************************************************/
+ezOsalStatus ezOsal_CondBroadcast(ezOsalCond *cond);
+
+
+/*****************************************************************************
+* Function: ezOsal_GetTimeMs
+*//**
+* @brief Return a monotonic time in milliseconds
+*
+* @details The value wraps around, only differences are meaningful
+*
+* @param        None
+* @return       Time in milliseconds
+*
+* @pre None
+* @post None
+*
+* \b Example
+* @code
+* uint32_t start = ezOsal_GetTimeMs();
+* DoSomething();
+* uint32_t elapsed = ezOsal_GetTimeMs() - start;
+* @endcode
+*
+* @see None
+*
+*****************************************************************************/
+uint32_t ezOsal_GetTimeMs(void);
+
+
+/*****************************************************************************
+* Function: ezOsal_ThreadCreate
+*//**
+* @brief Create a thread and start it
+*
+* @details The thread ends when func returns, nobody joins it. The POSIX
+* backend ignores stack, stack_size and priority and uses the defaults of
+* the system. The RTOS backends require a stack.
+*
+* @param[in]    thread: thread to be created, must outlive the thread
+* @param[in]    name: name of the thread
+* @param[in]    func: entry function
+* @param[in]    arg: argument of the entry function
+* @param[in]    stack: memory of the stack
+* @param[in]    stack_size: size of the stack in bytes
+* @param[in]    priority: priority, in the numbering of the RTOS
+* @return       EZ_OSAL_OK if success, else one of the error codes
+*
+* @pre None
+* @post None
+*
+* \b Example
+* @code
+* static ezOsalThread thread;
+* static uint8_t stack[1024];
+* ezOsal_ThreadCreate(&thread, "worker", Worker_Run, &ctx, stack, sizeof(stack), 10);
+* @endcode
+*
+* @see None
+*
+*****************************************************************************/
+ezOsalStatus ezOsal_ThreadCreate(ezOsalThread *thread,
+                                 const char *name,
+                                 ezOsalThreadFunc func,
+                                 void *arg,
+                                 void *stack,
+                                 uint32_t stack_size,
+                                 uint32_t priority);
+
+#endif /* EZ_OSAL == 1 */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _EZ_OSAL_H */
+
+
+/* End of file */
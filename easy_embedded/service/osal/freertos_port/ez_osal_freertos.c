@@ -0,0 +1,304 @@
+/*****************************************************************************
+* Filename:         ez_osal_freertos.c
+* Author:           Hai Nguyen
+* Original Date:    18.10.2026
+*
+* ----------------------------------------------------------------------------
+* Contact:          Hai Nguyen
+*                   hainguyen.eeit@gmail.com
+*
+* ----------------------------------------------------------------------------
+* License: This file is published under the license described in LICENSE.md
+*
+*****************************************************************************/
+
+/** @file   ez_osal_freertos.c
+ *  @author Hai Nguyen
+ *  @date   18.10.2026
+ *  @brief  FreeRTOS backend of the operating system abstraction layer
+ *
+ *  @details FreeRTOS has no condition variable. A counting semaphore holds
+ *  one token per signaled waiter, the number of waiters which are not
+ *  signaled yet is protected by the mutex given to ezOsal_CondWait.
+ */
+
+/*****************************************************************************
+* Includes
+*****************************************************************************/
+#include "ez_osal.h"
+
+#if (EZ_OSAL == 1) && (EZ_OSAL_FREERTOS == 1)
+#include "task.h"
+
+/*****************************************************************************
+* Component Preprocessor Macros
+*****************************************************************************/
+#define COND_MAX_COUNT      0xFFFF  /**< Upper bound of the tokens of a condition variable */
+
+
+/*****************************************************************************
+* Component Typedefs
+*****************************************************************************/
+/* None */
+
+
+/*****************************************************************************
+* Component Variable Definitions
+*****************************************************************************/
+/* None */
+
+
+/*****************************************************************************
+* Function Definitions
+*****************************************************************************/
+static TickType_t ezOsal_ToTicks(uint32_t timeout_ms);
+static void ezOsal_ThreadEntry(void *thread);
+
+
+/*****************************************************************************
+* Public functions
+*****************************************************************************/
+ezOsalStatus ezOsal_MutexCreate(ezOsalMutex *mutex)
+{
+    ezOsalStatus status = EZ_OSAL_ERR_ARG;
+
+    if (mutex != NULL)
+    {
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+        mutex->handle = xSemaphoreCreateMutexStatic(&mutex->buff);
+#else
+        mutex->handle = xSemaphoreCreateMutex();
+#endif
+        status = (mutex->handle != NULL) ? EZ_OSAL_OK : EZ_OSAL_ERR;
+    }
+
+    return status;
+}
+
+
+ezOsalStatus ezOsal_MutexLock(ezOsalMutex *mutex)
+{
+    ezOsalStatus status = EZ_OSAL_ERR_ARG;
+
+    if (mutex != NULL)
+    {
+        status = (xSemaphoreTake(mutex->handle, portMAX_DELAY) == pdTRUE) ? EZ_OSAL_OK : EZ_OSAL_ERR;
+    }
+
+    return status;
+}
+
+
+ezOsalStatus ezOsal_MutexUnlock(ezOsalMutex *mutex)
+{
+    ezOsalStatus status = EZ_OSAL_ERR_ARG;
+
+    if (mutex != NULL)
+    {
+        status = (xSemaphoreGive(mutex->handle) == pdTRUE) ? EZ_OSAL_OK : EZ_OSAL_ERR;
+    }
+
+    return status;
+}
+
+
+ezOsalStatus ezOsal_CondCreate(ezOsalCond *cond)
+{
+    ezOsalStatus status = EZ_OSAL_ERR_ARG;
+
+    if (cond != NULL)
+    {
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+        cond->handle = xSemaphoreCreateCountingStatic(COND_MAX_COUNT, 0, &cond->buff);
+#else
+        cond->handle = xSemaphoreCreateCounting(COND_MAX_COUNT, 0);
+#endif
+        cond->num_of_waiter = 0;
+        status = (cond->handle != NULL) ? EZ_OSAL_OK : EZ_OSAL_ERR;
+    }
+
+    return status;
+}
+
+
+ezOsalStatus ezOsal_CondWait(ezOsalCond *cond, ezOsalMutex *mutex, uint32_t timeout_ms)
+{
+    ezOsalStatus status = EZ_OSAL_ERR_ARG;
+    BaseType_t is_taken = pdFALSE;
+
+    if (cond != NULL && mutex != NULL)
+    {
+        cond->num_of_waiter++;
+        (void)xSemaphoreGive(mutex->handle);
+
+        /* A token given before this point is not lost, the semaphore keeps it */
+        is_taken = xSemaphoreTake(cond->handle, ezOsal_ToTicks(timeout_ms));
+
+        (void)xSemaphoreTake(mutex->handle, portMAX_DELAY);
+        if (is_taken == pdFALSE)
+        {
+            /* Signaled between the timeout and the lock: the token is ours */
+            is_taken = xSemaphoreTake(cond->handle, 0);
+            if (is_taken == pdFALSE)
+            {
+                cond->num_of_waiter--;
+            }
+        }
+
+        status = (is_taken == pdTRUE) ? EZ_OSAL_OK : EZ_OSAL_TIMEOUT;
+    }
+
+    return status;
+}
+
+
+ezOsalStatus ezOsal_CondSignal(ezOsalCond *cond)
+{
+    ezOsalStatus status = EZ_OSAL_ERR_ARG;
+
+    if (cond != NULL)
+    {
+        if (cond->num_of_waiter > 0)
+        {
+            cond->num_of_waiter--;
+            (void)xSemaphoreGive(cond->handle);
+        }
+        status = EZ_OSAL_OK;
+    }
+
+    return status;
+}
+
+
+ezOsalStatus ezOsal_CondBroadcast(ezOsalCond *cond)
+{
+    ezOsalStatus status = EZ_OSAL_ERR_ARG;
+
+    if (cond != NULL)
+    {
+        while (cond->num_of_waiter > 0)
+        {
+            cond->num_of_waiter--;
+            (void)xSemaphoreGive(cond->handle);
+        }
+        status = EZ_OSAL_OK;
+    }
+
+    return status;
+}
+
+
+uint32_t ezOsal_GetTimeMs(void)
+{
+    return (uint32_t)((uint64_t)xTaskGetTickCount() * 1000U / configTICK_RATE_HZ);
+}
+
+
+ezOsalStatus ezOsal_ThreadCreate(ezOsalThread *thread,
+                                 const char *name,
+                                 ezOsalThreadFunc func,
+                                 void *arg,
+                                 void *stack,
+                                 uint32_t stack_size,
+                                 uint32_t priority)
+{
+    ezOsalStatus status = EZ_OSAL_ERR_ARG;
+
+    if (thread != NULL && func != NULL && stack_size > 0)
+    {
+        thread->func = func;
+        thread->arg = arg;
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+        if (stack != NULL)
+        {
+            thread->handle = xTaskCreateStatic(ezOsal_ThreadEntry,
+                                               name,
+                                               stack_size / sizeof(StackType_t),
+                                               thread,
+                                               (UBaseType_t)priority,
+                                               (StackType_t *)stack,
+                                               &thread->buff);
+            status = (thread->handle != NULL) ? EZ_OSAL_OK : EZ_OSAL_ERR;
+        }
+#else
+        (void)stack;
+        status = (xTaskCreate(ezOsal_ThreadEntry,
+                              name,
+                              stack_size / sizeof(StackType_t),
+                              thread,
+                              (UBaseType_t)priority,
+                              &thread->handle) == pdPASS) ? EZ_OSAL_OK : EZ_OSAL_ERR;
+#endif
+    }
+
+    return status;
+}
+
+
+/*****************************************************************************
+* Local functions
+*****************************************************************************/
+
+/*****************************************************************************
+* Function: ezOsal_ToTicks
+*//**
+* @brief Convert a timeout in milliseconds to FreeRTOS ticks, rounded up
+*
+* @details
+*
+* @param[in]    timeout_ms: timeout in milliseconds
+* @return       Number of ticks
+*
+* @pre None
+* @post None
+*
+* \b Example
+* @code
+* @endcode
+*
+* @see None
+*
+*****************************************************************************/
+static TickType_t ezOsal_ToTicks(uint32_t timeout_ms)
+{
+    TickType_t ticks = portMAX_DELAY;
+
+    if (timeout_ms != EZ_OSAL_WAIT_FOREVER)
+    {
+        ticks = (TickType_t)(((uint64_t)timeout_ms * configTICK_RATE_HZ + 999U) / 1000U);
+    }
+
+    return ticks;
+}
+
+
+/*****************************************************************************
+* Function: ezOsal_ThreadEntry
+*//**
+* @brief Run the entry function of a thread, then delete the task since a
+* FreeRTOS task must not return
+*
+* @details
+*
+* @param[in]    thread: thread being started
+* @return       None
+*
+* @pre None
+* @post None
+*
+* \b Example
+* @code
+* @endcode
+*
+* @see None
+*
+*****************************************************************************/
+static void ezOsal_ThreadEntry(void *thread)
+{
+    ((ezOsalThread *)thread)->func(((ezOsalThread *)thread)->arg);
+    vTaskDelete(NULL);
+}
+
+#endif /* (EZ_OSAL == 1) && (EZ_OSAL_FREERTOS == 1) */
+
+/* End of file */
@@ -0,0 +1,275 @@
+/*****************************************************************************
+* Filename:         ez_osal_posix.c
+* Author:           Hai Nguyen
+* Original Date:    18.10.2026
+*
+* ----------------------------------------------------------------------------
+* Contact:          Hai Nguyen
+*                   hainguyen.eeit@gmail.com
+*
+* ----------------------------------------------------------------------------
+* License: This file is published under the license described in LICENSE.md
+*
+*****************************************************************************/
+
+/** @file   ez_osal_posix.c
+ *  @author Hai Nguyen
+ *  @date   18.10.2026
+ *  @brief  POSIX threads backend of the operating system abstraction layer
+ *
+ *  @details
+ */
+
+/*****************************************************************************
+* Includes
+*****************************************************************************/
+#include "ez_osal.h"
+
+#if (EZ_OSAL == 1) && (EZ_OSAL_THREADX == 0) && (EZ_OSAL_FREERTOS == 0)
+#include <time.h>
+#include <errno.h>
+
+
+/*****************************************************************************
+* Component Preprocessor Macros
+*****************************************************************************/
+#define NS_PER_MS       1000000L
+#define NS_PER_SEC      1000000000L
+
+
+/*****************************************************************************
+* Component Typedefs
+*****************************************************************************/
+/* None */
+
+
+/*****************************************************************************
+* Component Variable Definitions
+*****************************************************************************/
+/* None */
+
+
+/*****************************************************************************
+* Function Definitions
+*****************************************************************************/
+static void *ezOsal_ThreadEntry(void *thread);
+
+
+/*****************************************************************************
+* Public functions
+*****************************************************************************/
+ezOsalStatus ezOsal_MutexCreate(ezOsalMutex *mutex)
+{
+    ezOsalStatus status = EZ_OSAL_ERR_ARG;
+
+    if (mutex != NULL)
+    {
+        status = (pthread_mutex_init(&mutex->mutex, NULL) == 0) ? EZ_OSAL_OK : EZ_OSAL_ERR;
+    }
+
+    return status;
+}
+
+
+ezOsalStatus ezOsal_MutexLock(ezOsalMutex *mutex)
+{
+    ezOsalStatus status = EZ_OSAL_ERR_ARG;
+
+    if (mutex != NULL)
+    {
+        status = (pthread_mutex_lock(&mutex->mutex) == 0) ? EZ_OSAL_OK : EZ_OSAL_ERR;
+    }
+
+    return status;
+}
+
+
+ezOsalStatus ezOsal_MutexUnlock(ezOsalMutex *mutex)
+{
+    ezOsalStatus status = EZ_OSAL_ERR_ARG;
+
+    if (mutex != NULL)
+    {
+        status = (pthread_mutex_unlock(&mutex->mutex) == 0) ? EZ_OSAL_OK : EZ_OSAL_ERR;
+    }
+
+    return status;
+}
+
+
+ezOsalStatus ezOsal_CondCreate(ezOsalCond *cond)
+{
+    ezOsalStatus status = EZ_OSAL_ERR_ARG;
+    pthread_condattr_t attr;
+
+    if (cond != NULL)
+    {
+        status = EZ_OSAL_ERR;
+
+        /* Timeouts must not depend on changes of the wall clock */
+        if (pthread_condattr_init(&attr) == 0)
+        {
+            if (pthread_condattr_setclock(&attr, CLOCK_MONOTONIC) == 0
+                && pthread_cond_init(&cond->cond, &attr) == 0)
+            {
+                status = EZ_OSAL_OK;
+            }
+            (void)pthread_condattr_destroy(&attr);
+        }
+    }
+
+    return status;
+}
+
+
+ezOsalStatus ezOsal_CondWait(ezOsalCond *cond, ezOsalMutex *mutex, uint32_t timeout_ms)
+{
+    ezOsalStatus status = EZ_OSAL_ERR_ARG;
+    struct timespec deadline;
+    int ret = 0;
+
+    if (cond != NULL && mutex != NULL)
+    {
+        if (timeout_ms == EZ_OSAL_WAIT_FOREVER)
+        {
+            ret = pthread_cond_wait(&cond->cond, &mutex->mutex);
+        }
+        else
+        {
+            (void)clock_gettime(CLOCK_MONOTONIC, &deadline);
+            deadline.tv_sec += (time_t)(timeout_ms / 1000U);
+            deadline.tv_nsec += (long)(timeout_ms % 1000U) * NS_PER_MS;
+            if (deadline.tv_nsec >= NS_PER_SEC)
+            {
+                deadline.tv_sec++;
+                deadline.tv_nsec -= NS_PER_SEC;
+            }
+
+            ret = pthread_cond_timedwait(&cond->cond, &mutex->mutex, &deadline);
+        }
+
+        if (ret == 0)
+        {
+            status = EZ_OSAL_OK;
+        }
+        else if (ret == ETIMEDOUT)
+        {
+            status = EZ_OSAL_TIMEOUT;
+        }
+        else
+        {
+            status = EZ_OSAL_ERR;
+        }
+    }
+
+    return status;
+}
+
+
+ezOsalStatus ezOsal_CondSignal(ezOsalCond *cond)
+{
+    ezOsalStatus status = EZ_OSAL_ERR_ARG;
+
+    if (cond != NULL)
+    {
+        status = (pthread_cond_signal(&cond->cond) == 0) ? EZ_OSAL_OK : EZ_OSAL_ERR;
+    }
+
+    return status;
+}
+
+
+ezOsalStatus ezOsal_CondBroadcast(ezOsalCond *cond)
+{
+    ezOsalStatus status = EZ_OSAL_ERR_ARG;
+
+    if (cond != NULL)
+    {
+        status = (pthread_cond_broadcast(&cond->cond) == 0) ? EZ_OSAL_OK : EZ_OSAL_ERR;
+    }
+
+    return status;
+}
+
+
+uint32_t ezOsal_GetTimeMs(void)
+{
+    struct timespec now;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (uint32_t)((uint64_t)now.tv_sec * 1000U + (uint64_t)(now.tv_nsec / NS_PER_MS));
+}
+
+
+ezOsalStatus ezOsal_ThreadCreate(ezOsalThread *thread,
+                                 const char *name,
+                                 ezOsalThreadFunc func,
+                                 void *arg,
+                                 void *stack,
+                                 uint32_t stack_size,
+                                 uint32_t priority)
+{
+    ezOsalStatus status = EZ_OSAL_ERR_ARG;
+    pthread_attr_t attr;
+
+    (void)name;
+    (void)stack;
+    (void)stack_size;
+    (void)priority;
+
+    if (thread != NULL && func != NULL)
+    {
+        status = EZ_OSAL_ERR;
+        thread->func = func;
+        thread->arg = arg;
+
+        if (pthread_attr_init(&attr) == 0)
+        {
+            if (pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED) == 0
+                && pthread_create(&thread->thread, &attr, ezOsal_ThreadEntry, thread) == 0)
+            {
+                status = EZ_OSAL_OK;
+            }
+            (void)pthread_attr_destroy(&attr);
+        }
+    }
+
+    return status;
+}
+
+
+/*****************************************************************************
+* Local functions
+*****************************************************************************/
+
+/*****************************************************************************
+* Function: ezOsal_ThreadEntry
+*//**
+* @brief Adapt the entry function of a thread to the POSIX signature
+*
+* @details
+*
+* @param[in]    thread: thread being started
+* @return       NULL
+*
+* @pre None
+* @post None
+*
+* \b Example
+* @code
+* @endcode
+*
+* @see None
+*
+*****************************************************************************/
+static void *ezOsal_ThreadEntry(void *thread)
+{
+    ((ezOsalThread *)thread)->func(((ezOsalThread *)thread)->arg);
+
+    return NULL;
+}
+
+#endif /* (EZ_OSAL == 1) && (EZ_OSAL_THREADX == 0) && (EZ_OSAL_FREERTOS == 0) */
+
+/* End of file */
@@ -0,0 +1,285 @@
+/*****************************************************************************
+* Filename:         ez_osal_threadx.c
+* Author:           Hai Nguyen
+* Original Date:    18.10.2026
+*
+* ----------------------------------------------------------------------------
+* Contact:          Hai Nguyen
+*                   hainguyen.eeit@gmail.com
+*
+* ----------------------------------------------------------------------------
+* License: This file is published under the license described in LICENSE.md
+*
+*****************************************************************************/
+
+/** @file   ez_osal_threadx.c
+ *  @author Hai Nguyen
+ *  @date   18.10.2026
+ *  @brief  ThreadX backend of the operating system abstraction layer
+ *
+ *  @details Condition variables are emulated the same way as in the
+ *  FreeRTOS backend, on top of a ThreadX counting semaphore.
+ */
+
+/*****************************************************************************
+* Includes
+*****************************************************************************/
+#include "ez_osal.h"
+
+#if (EZ_OSAL == 1) && (EZ_OSAL_THREADX == 1)
+
+
+/*****************************************************************************
+* Component Preprocessor Macros
+*****************************************************************************/
+/* None */
+
+
+/*****************************************************************************
+* Component Typedefs
+*****************************************************************************/
+/* None */
+
+
+/*****************************************************************************
+* Component Variable Definitions
+*****************************************************************************/
+/* None */
+
+
+/*****************************************************************************
+* Function Definitions
+*****************************************************************************/
+static ULONG ezOsal_ToTicks(uint32_t timeout_ms);
+static void ezOsal_ThreadEntry(ULONG thread);
+
+
+/*****************************************************************************
+* Public functions
+*****************************************************************************/
+ezOsalStatus ezOsal_MutexCreate(ezOsalMutex *mutex)
+{
+    ezOsalStatus status = EZ_OSAL_ERR_ARG;
+
+    if (mutex != NULL)
+    {
+        status = (tx_mutex_create(&mutex->mutex, "ez_osal", TX_INHERIT) == TX_SUCCESS)
+                 ? EZ_OSAL_OK : EZ_OSAL_ERR;
+    }
+
+    return status;
+}
+
+
+ezOsalStatus ezOsal_MutexLock(ezOsalMutex *mutex)
+{
+    ezOsalStatus status = EZ_OSAL_ERR_ARG;
+
+    if (mutex != NULL)
+    {
+        status = (tx_mutex_get(&mutex->mutex, TX_WAIT_FOREVER) == TX_SUCCESS)
+                 ? EZ_OSAL_OK : EZ_OSAL_ERR;
+    }
+
+    return status;
+}
+
+
+ezOsalStatus ezOsal_MutexUnlock(ezOsalMutex *mutex)
+{
+    ezOsalStatus status = EZ_OSAL_ERR_ARG;
+
+    if (mutex != NULL)
+    {
+        status = (tx_mutex_put(&mutex->mutex) == TX_SUCCESS) ? EZ_OSAL_OK : EZ_OSAL_ERR;
+    }
+
+    return status;
+}
+
+
+ezOsalStatus ezOsal_CondCreate(ezOsalCond *cond)
+{
+    ezOsalStatus status = EZ_OSAL_ERR_ARG;
+
+    if (cond != NULL)
+    {
+        cond->num_of_waiter = 0;
+        status = (tx_semaphore_create(&cond->sem, "ez_osal_cond", 0) == TX_SUCCESS)
+                 ? EZ_OSAL_OK : EZ_OSAL_ERR;
+    }
+
+    return status;
+}
+
+
+ezOsalStatus ezOsal_CondWait(ezOsalCond *cond, ezOsalMutex *mutex, uint32_t timeout_ms)
+{
+    ezOsalStatus status = EZ_OSAL_ERR_ARG;
+    UINT threadx_status = TX_NO_INSTANCE;
+
+    if (cond != NULL && mutex != NULL)
+    {
+        cond->num_of_waiter++;
+        (void)tx_mutex_put(&mutex->mutex);
+
+        /* A token given before this point is not lost, the semaphore keeps it */
+        threadx_status = tx_semaphore_get(&cond->sem, ezOsal_ToTicks(timeout_ms));
+
+        (void)tx_mutex_get(&mutex->mutex, TX_WAIT_FOREVER);
+        if (threadx_status != TX_SUCCESS)
+        {
+            /* Signaled between the timeout and the lock: the token is ours */
+            threadx_status = tx_semaphore_get(&cond->sem, TX_NO_WAIT);
+            if (threadx_status != TX_SUCCESS)
+            {
+                cond->num_of_waiter--;
+            }
+        }
+
+        status = (threadx_status == TX_SUCCESS) ? EZ_OSAL_OK : EZ_OSAL_TIMEOUT;
+    }
+
+    return status;
+}
+
+
+ezOsalStatus ezOsal_CondSignal(ezOsalCond *cond)
+{
+    ezOsalStatus status = EZ_OSAL_ERR_ARG;
+
+    if (cond != NULL)
+    {
+        if (cond->num_of_waiter > 0)
+        {
+            cond->num_of_waiter--;
+            (void)tx_semaphore_put(&cond->sem);
+        }
+        status = EZ_OSAL_OK;
+    }
+
+    return status;
+}
+
+
+ezOsalStatus ezOsal_CondBroadcast(ezOsalCond *cond)
+{
+    ezOsalStatus status = EZ_OSAL_ERR_ARG;
+
+    if (cond != NULL)
+    {
+        while (cond->num_of_waiter > 0)
+        {
+            cond->num_of_waiter--;
+            (void)tx_semaphore_put(&cond->sem);
+        }
+        status = EZ_OSAL_OK;
+    }
+
+    return status;
+}
+
+
+uint32_t ezOsal_GetTimeMs(void)
+{
+    return (uint32_t)((uint64_t)tx_time_get() * 1000U / TX_TIMER_TICKS_PER_SECOND);
+}
+
+
+ezOsalStatus ezOsal_ThreadCreate(ezOsalThread *thread,
+                                 const char *name,
+                                 ezOsalThreadFunc func,
+                                 void *arg,
+                                 void *stack,
+                                 uint32_t stack_size,
+                                 uint32_t priority)
+{
+    ezOsalStatus status = EZ_OSAL_ERR_ARG;
+
+    if (thread != NULL && func != NULL && stack != NULL && stack_size > 0)
+    {
+        thread->func = func;
+        thread->arg = arg;
+        status = (tx_thread_create(&thread->thread,
+                                   (CHAR *)name,
+                                   ezOsal_ThreadEntry,
+                                   (ULONG)(uintptr_t)thread,
+                                   stack,
+                                   (ULONG)stack_size,
+                                   (UINT)priority,
+                                   (UINT)priority,
+                                   TX_NO_TIME_SLICE,
+                                   TX_AUTO_START) == TX_SUCCESS) ? EZ_OSAL_OK : EZ_OSAL_ERR;
+    }
+
+    return status;
+}
+
+
+/*****************************************************************************
+* Local functions
+*****************************************************************************/
+
+/*****************************************************************************
+* Function: ezOsal_ToTicks
+*//**
+* @brief Convert a timeout in milliseconds to ThreadX ticks, rounded up
+*
+* @details
+*
+* @param[in]    timeout_ms: timeout in milliseconds
+* @return       Number of ticks
+*
+* @pre None
+* @post None
+*
+* \b Example
+* @code
+* @endcode
+*
+* @see None
+*
+*****************************************************************************/
+static ULONG ezOsal_ToTicks(uint32_t timeout_ms)
+{
+    ULONG ticks = TX_WAIT_FOREVER;
+
+    if (timeout_ms != EZ_OSAL_WAIT_FOREVER)
+    {
+        ticks = (ULONG)(((uint64_t)timeout_ms * TX_TIMER_TICKS_PER_SECOND + 999U) / 1000U);
+    }
+
+    return ticks;
+}
+
+
+/*****************************************************************************
+* Function: ezOsal_ThreadEntry
+*//**
+* @brief Adapt the entry function of a thread to the ThreadX signature
+*
+* @details
+*
+* @param[in]    thread: address of the thread being started
+* @return       None
+*
+* @pre None
+* @post None
+*
+* \b Example
+* @code
+* @endcode
+*
+* @see None
+*
+*****************************************************************************/
+static void ezOsal_ThreadEntry(ULONG thread)
+{
+    ezOsalThread *osal_thread = (ezOsalThread *)(uintptr_t)thread;
+
+    osal_thread->func(osal_thread->arg);
+}
+
+#endif /* (EZ_OSAL == 1) && (EZ_OSAL_THREADX == 1) */
+
+/* End of file */
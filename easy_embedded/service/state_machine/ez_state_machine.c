@@ -68,9 +68,10 @@ bool ezSM_Init(ezStateMachine_t *sm,
     if((NULL != sm)
         && (NULL != init_state)
         && (NULL != event_buff)
-        && (event_buff_size > 0))
+        && (event_buff_size > 0)
+        && (event_buff_size <= EZ_RING_BUFFER_SIZE_MAX))
     {
-        success = ezRingBuffer_Init(&sm->events, event_buff, event_buff_size);
+        success = ezRingBuffer_Init(&sm->events, event_buff, (ezRingBufferSize)event_buff_size);
         if(false == success)
         {
             EZERROR("  init ring buffer error");
@@ -120,7 +121,7 @@ bool ezSM_Run(ezStateMachine_t *sm)
         /* If we have the handle_event function, we handle the event */
         if(NULL != sm->curr_state->handle_event)
         {
-            if(ezRingBuffer_Pop(&sm->events, &event, 1) == 1)
+            if(ezRingBuffer_PopByte(&sm->events, &event) == true)
             {
                 EZDEBUG("  New event = %d, calling handling function...", event);
                 sm->next_state = sm->curr_state->handle_event(event);
@@ -181,7 +182,7 @@ bool ezSM_SetEvent(ezStateMachine_t *sm, uint8_t event)
     bool success = false;
 
     if((NULL != sm)
-       && (ezRingBuffer_Push(&sm->events, &event, 1) == 1))
+       && (ezRingBuffer_PushByte(&sm->events, event) == true))
     {
         success = true;
     }
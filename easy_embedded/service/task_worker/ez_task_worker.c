@@ -57,6 +57,8 @@ struct ezTaskBlockCommon
 {
     ezTaskWorkerTaskFunc task;          /* Task that will be executed by the worker */
     ezTaskWorkerCallbackFunc callback;  /* Callback function to notify the result of the task execution */
+    void *context_ref;                  /* Context owned by the caller, NULL if the context follows this block */
+    uint32_t enqueue_time;              /* Time when the task is enqueued, for the latency counters */
 };
 
 
@@ -65,11 +67,265 @@ struct ezTaskBlockCommon
 *****************************************************************************/
 static struct Node worker_list = EZ_LINKEDLIST_INIT_NODE(worker_list);
 static struct ezTaskWorkerThreadInterfaces *rtos_interfaces = NULL;
+static ezTaskWorkerTimestampFunc get_timestamp = NULL;
 
 /*****************************************************************************
 * Function Definitions
 *****************************************************************************/
 
+/*****************************************************************************
+* Function: ezTaskWorker_GetLaneQueue
+*//** 
+* @brief Return the queue of a lane
+*
+* @details
+*
+* @param[in]    worker: pointer to the worker
+* @param[in]    lane: lane, lower than CONFIG_EZ_TASK_WORKER_NUM_OF_LANE
+* @return       pointer to the queue
+*
+* @pre None
+* @post None
+*
+* \b Example
+* @code
+* @endcode
+*
+* @see
+*
+*****************************************************************************/
+static ezQueue *ezTaskWorker_GetLaneQueue(struct ezTaskWorker *worker, uint32_t lane);
+
+
+/*****************************************************************************
+* Function: ezTaskWorker_GetNextTask
+*//** 
+* @brief Get the front task of the most urgent non-empty lane and update the
+*        counters of the lane
+*
+* @details The task stays in the queue, the caller pops it after executing
+*          it. If common is NULL, the function only checks if a task is
+*          pending and the counters are not updated.
+*
+* @param[in]    worker: pointer to the worker
+* @param[out]   common: front task, can be NULL
+* @param[out]   queue: queue containing the task, NULL if no task is found
+* @return       true if a task is found, else false
+*
+* @pre The caller owns the worker semaphore when RTOS is used
+* @post None
+*
+* \b Example
+* @code
+* @endcode
+*
+* @see
+*
+*****************************************************************************/
+static bool ezTaskWorker_GetNextTask(struct ezTaskWorker *worker,
+                                     struct ezTaskBlockCommon **common,
+                                     ezQueue **queue);
+
+
+/*****************************************************************************
+* Function: ezTaskWorker_Lock
+*//** 
+* @brief Take the semaphore protecting the queues of a worker
+*
+* @details Without RTOS, there is nothing to lock
+*
+* @param[in]    worker: pointer to the worker
+* @param[in]    ticks_to_wait: number of tick to wait for the semaphore
+* @return       true if the semaphore is taken, else false
+*
+* @pre None
+* @post None
+*
+* \b Example
+* @code
+* @endcode
+*
+* @see ezTaskWorker_Unlock
+*
+*****************************************************************************/
+static bool ezTaskWorker_Lock(struct ezTaskWorker *worker, uint32_t ticks_to_wait);
+
+
+/*****************************************************************************
+* Function: ezTaskWorker_Unlock
+*//** 
+* @brief Give the semaphore taken by ezTaskWorker_Lock
+*
+* @details
+*
+* @param[in]    worker: pointer to the worker
+* @return       None
+*
+* @pre None
+* @post None
+*
+* \b Example
+* @code
+* @endcode
+*
+* @see ezTaskWorker_Lock
+*
+*****************************************************************************/
+static void ezTaskWorker_Unlock(struct ezTaskWorker *worker);
+
+
+/*****************************************************************************
+* Function: ezTaskWorker_ReserveBlock
+*//** 
+* @brief Reserve a task block in the queue of a lane and set its common data
+*
+* @details
+*
+* @param[in]    worker: pointer to the worker
+* @param[in]    lane: lane of the task
+* @param[in]    task: task function
+* @param[in]    callback: callback of the task
+* @param[in]    context_size: size of the context stored in the block
+* @param[in]    context_ref: context passed to the task instead of the stored
+*                            one, NULL to use the stored context
+* @param[out]   task_block: reserved block
+* @return       address of the context in the block, NULL if error
+*
+* @pre The caller owns the worker semaphore when RTOS is used
+* @post None
+*
+* \b Example
+* @code
+* @endcode
+*
+* @see ezTaskWorker_PushBlock
+*
+*****************************************************************************/
+static void *ezTaskWorker_ReserveBlock(struct ezTaskWorker *worker,
+                                       uint32_t lane,
+                                       ezTaskWorkerTaskFunc task,
+                                       ezTaskWorkerCallbackFunc callback,
+                                       uint32_t context_size,
+                                       void *context_ref,
+                                       ezTaskBlock_t *task_block);
+
+
+/*****************************************************************************
+* Function: ezTaskWorker_PushBlock
+*//** 
+* @brief Push a reserved task block to the queue of its lane and notify the
+*        worker
+*
+* @details The block is released if it cannot be pushed
+*
+* @param[in]    worker: pointer to the worker
+* @param[in]    lane: lane of the task
+* @param[in]    task_block: block reserved by ezTaskWorker_ReserveBlock
+* @return       true if success, else false
+*
+* @pre The caller owns the worker semaphore when RTOS is used
+* @post None
+*
+* \b Example
+* @code
+* @endcode
+*
+* @see ezTaskWorker_ReserveBlock
+*
+*****************************************************************************/
+static bool ezTaskWorker_PushBlock(struct ezTaskWorker *worker,
+                                   uint32_t lane,
+                                   ezTaskBlock_t task_block);
+
+
+/*****************************************************************************
+* Function: ezTaskWorker_ProcessTimers
+*//** 
+* @brief Enqueue the due delayed and periodic tasks of a worker
+*
+* @details
+*
+* @param[in]    worker: pointer to the worker
+* @param[in]    max_wait: number of tick the caller wants to wait
+* @return       max_wait, or less if a timer is due earlier
+*
+* @pre The caller does not own the worker semaphore
+* @post None
+*
+* \b Example
+* @code
+* @endcode
+*
+* @see
+*
+*****************************************************************************/
+static uint32_t ezTaskWorker_ProcessTimers(struct ezTaskWorker *worker, uint32_t max_wait);
+
+#if (EZ_TIMING_WHEEL == 1U)
+/*****************************************************************************
+* Function: ezTaskWorker_StartTimer
+*//** 
+* @brief Add a delayed or periodic task to the timing wheel of a worker
+*
+* @details
+*
+* @param[in]    worker: pointer to the worker
+* @param[in]    timer: storage of the task
+* @param[in]    lane: lane the task is enqueued to
+* @param[in]    task: task function
+* @param[in]    callback: callback of the task
+* @param[in]    context: context passed to the task, not copied
+* @param[in]    delay: ticks until the first occurrence
+* @param[in]    period: ticks between occurrences, 0 for a single one
+* @param[in]    ticks_to_wait: number of tick to wait for the semaphore
+* @return       true if success, false if error or the timer is active
+*
+* @pre The timer is zero-initialized or was used before
+* @post None
+*
+* \b Example
+* @code
+* @endcode
+*
+* @see
+*
+*****************************************************************************/
+static bool ezTaskWorker_StartTimer(struct ezTaskWorker *worker,
+                                    struct ezTaskWorkerTimer *timer,
+                                    uint32_t lane,
+                                    ezTaskWorkerTaskFunc task,
+                                    ezTaskWorkerCallbackFunc callback,
+                                    void *context,
+                                    uint32_t delay,
+                                    uint32_t period,
+                                    uint32_t ticks_to_wait);
+
+
+/*****************************************************************************
+* Function: ezTaskWorker_OnTimerExpired
+*//** 
+* @brief Enqueue the task of an expired timer and restart a periodic timer
+*
+* @details
+*
+* @param[in]    wheel_timer: expired timer
+* @param[in]    arg: worker owning the timer
+* @return       None
+*
+* @pre The caller owns the worker semaphore when RTOS is used
+* @post None
+*
+* \b Example
+* @code
+* @endcode
+*
+* @see
+*
+*****************************************************************************/
+static void ezTaskWorker_OnTimerExpired(struct ezTimingWheelTimer *wheel_timer, void *arg);
+#endif /* EZ_TIMING_WHEEL == 1U */
+
+
 #if ((EZ_THREADX_PORT_ENABLE == 1) || (EZ_FREERTOS_PORT_ENABLE == 1))
 /*****************************************************************************
 * Function: ezTaskWorker_CheckRtosInterfaceSanity
@@ -108,7 +364,30 @@ bool ezTaskWorker_CreateWorker(struct ezTaskWorker *worker,
 
     if(worker != NULL)
     {
+        /* Everything the thread reads is set before the thread is created */
+        worker->drain_limit = CONFIG_EZ_TASK_WORKER_DRAIN_LIMIT;
+#if (CONFIG_EZ_TASK_WORKER_NUM_OF_LANE > 1U)
+        memset(worker->lane_queues, 0, sizeof(worker->lane_queues));
+#endif
+        memset(worker->lane_stats, 0, sizeof(worker->lane_stats));
+#if (EZ_TIMING_WHEEL == 1U)
+        (void)ezTimingWheel_Init(&worker->timer_wheel, (get_timestamp != NULL) ? get_timestamp() : 0);
+#endif
         status = ezQueue_CreateQueue(&worker->msg_queue, queue_buffer, queue_buffer_size);
+#if (EZ_TASK_WORKER_ITEM_POOL == 1U)
+        if((status == ezSUCCESS)
+            && (ezObjPool_Init(&worker->item_pool,
+                               worker->item_slots,
+                               sizeof(worker->item_slots[0]),
+                               CONFIG_EZ_TASK_WORKER_NUM_OF_QUEUE_ITEM) == true))
+        {
+            status = ezQueue_SetItemPool(&worker->msg_queue, &worker->item_pool);
+        }
+        else
+        {
+            status = ezFAIL;
+        }
+#endif /* EZ_TASK_WORKER_ITEM_POOL == 1U */
         if(status == ezSUCCESS)
         {
 #if ((EZ_THREADX_PORT_ENABLE == 1) || (EZ_FREERTOS_PORT_ENABLE == 1))
@@ -135,6 +414,71 @@ bool ezTaskWorker_CreateWorker(struct ezTaskWorker *worker,
     return bRet;
 }
 
+
+bool ezTaskWorker_SetDrainLimit(struct ezTaskWorker *worker, uint32_t drain_limit)
+{
+    bool ret = false;
+    EZTRACE("ezTaskWorker_SetDrainLimit(drain_limit = %d)", drain_limit);
+
+    if(worker != NULL)
+    {
+        worker->drain_limit = drain_limit;
+        ret = true;
+    }
+
+    return ret;
+}
+
+
+bool ezTaskWorker_AddLane(struct ezTaskWorker *worker,
+                          uint32_t lane,
+                          uint8_t *queue_buffer,
+                          uint32_t queue_buffer_size)
+{
+    bool ret = false;
+    EZTRACE("ezTaskWorker_AddLane(lane = %d)", lane);
+
+    if((worker != NULL) && (lane < EZ_TASK_WORKER_LANE_DEFAULT))
+    {
+        ret = (ezQueue_CreateQueue(ezTaskWorker_GetLaneQueue(worker, lane),
+                                   queue_buffer,
+                                   queue_buffer_size) == ezSUCCESS);
+#if (EZ_TASK_WORKER_ITEM_POOL == 1U)
+        /* Lanes are only accessed under the worker semaphore, like the pool */
+        ret = ret && (ezQueue_SetItemPool(ezTaskWorker_GetLaneQueue(worker, lane),
+                                          &worker->item_pool) == ezSUCCESS);
+#endif /* EZ_TASK_WORKER_ITEM_POOL == 1U */
+    }
+    else
+    {
+        EZWARNING("Wrong input parameters");
+    }
+
+    return ret;
+}
+
+
+bool ezTaskWorker_GetLaneStats(struct ezTaskWorker *worker,
+                               uint32_t lane,
+                               struct ezTaskWorkerLaneStats *stats)
+{
+    bool ret = false;
+
+    if((worker != NULL) && (lane < CONFIG_EZ_TASK_WORKER_NUM_OF_LANE) && (stats != NULL))
+    {
+        *stats = worker->lane_stats[lane];
+        ret = true;
+    }
+
+    return ret;
+}
+
+
+void ezTaskWorker_SetTimestampFunc(ezTaskWorkerTimestampFunc timestamp_func)
+{
+    get_timestamp = timestamp_func;
+}
+
 #if ((EZ_THREADX_PORT_ENABLE == 1) || (EZ_FREERTOS_PORT_ENABLE == 1))
 bool ezTaskWorker_SetRtosInterface(struct ezTaskWorkerThreadInterfaces *interfaces)
 {
@@ -155,96 +499,51 @@ bool ezTaskWorker_EnqueueTask(struct ezTaskWorker *worker,
                               void *context,
                               uint32_t context_size,
                               uint32_t ticks_to_wait)
+{
+    return ezTaskWorker_EnqueueTaskToLane(worker,
+                                          EZ_TASK_WORKER_LANE_DEFAULT,
+                                          task,
+                                          callback,
+                                          context,
+                                          context_size,
+                                          ticks_to_wait);
+}
+
+
+bool ezTaskWorker_EnqueueTaskToLane(struct ezTaskWorker *worker,
+                                    uint32_t lane,
+                                    ezTaskWorkerTaskFunc task,
+                                    ezTaskWorkerCallbackFunc callback,
+                                    void *context,
+                                    uint32_t context_size,
+                                    uint32_t ticks_to_wait)
 {
     bool ret = false;
     void *buff = NULL;
     ezTaskBlock_t task_block = NULL;
-    ezSTATUS status = ezFAIL;
-#if ((EZ_THREADX_PORT_ENABLE == 1) || (EZ_FREERTOS_PORT_ENABLE == 1))
-    EZ_RTOS_STATUS rtos_status = RTOS_STATUS_ERR;
-#endif /* (EZ_THREADX_PORT_ENABLE == 1) || (EZ_FREERTOS_PORT_ENABLE == 1) */
 
-    EZTRACE("ezTaskWorker_EnqueueTask()");
+    EZTRACE("ezTaskWorker_EnqueueTaskToLane(lane = %d)", lane);
 
-    if((worker != NULL) && (task != NULL) && (callback != NULL))
+    if((worker != NULL) && (task != NULL) && (callback != NULL)
+        && ((context != NULL) || (context_size == 0))
+        && (ezTaskWorker_Lock(worker, ticks_to_wait) == true))
     {
-        ret = true;
-#if ((EZ_THREADX_PORT_ENABLE == 1) || (EZ_FREERTOS_PORT_ENABLE == 1))
-        if(rtos_interfaces != NULL && rtos_interfaces->take_semaphore != NULL)
-        {
-            EZTRACE("Getting semaphore from worker = %s", worker->worker_name);
-            rtos_status = rtos_interfaces->take_semaphore(worker, ticks_to_wait);
-            if(rtos_status == RTOS_STATUS_OK)
-            {
-                ret = true;
-            }
-        }
-        else
-        {
-            ret = false;
-        }
-#endif /* (EZ_THREADX_PORT_ENABLE == 1) || (EZ_FREERTOS_PORT_ENABLE == 1) */
-
-        if(ret == true)
+        /**The idea to store common data and context data is we reserve a buffer
+         * with the size = common size + context size. Then, the buffer is convert to
+         * ezTaskBlockCommon to store common data. After that it is offseted to the
+         * address = common address + sizeof(ezTaskBlockCommon). Then the context
+         * is copied to that address.
+         */
+        buff = ezTaskWorker_ReserveBlock(worker, lane, task, callback, context_size, NULL, &task_block);
+        if(buff != NULL)
         {
-            /**The idea to store common data and context data is we reserve a buffer
-             * with the size = common size + context size. Then, the buffer is convert to
-             * ezTaskBlockCommon to store common data. After that it is offseted to the
-             * address = common address + sizeof(ezTaskBlockCommon). Then the context
-             * is copied to that address.
-             */
-            task_block = (ezTaskBlock_t)ezQueue_ReserveElement(&worker->msg_queue,
-                                                               &buff,
-                                                               sizeof(struct ezTaskBlockCommon) + context_size);
-            if((task_block != NULL) && (buff != NULL))
-            {
-                /* Set common data */
-                ((struct ezTaskBlockCommon*)buff)->callback = callback;
-                ((struct ezTaskBlockCommon*)buff)->task = task;
-
-                /* Offset the pointer */
-                buff += sizeof(struct ezTaskBlockCommon);
-
-                /* Copy context data */
-                memcpy(buff, context, context_size);
-                status = ezQueue_PushReservedElement(&worker->msg_queue,
-                                                    (ezReservedElement)task_block);
-                if(status == ezSUCCESS)
-                {
-                    ret = true;
-                    EZINFO("Add new task to %s",worker->worker_name);
-#if ((EZ_THREADX_PORT_ENABLE == 1) || (EZ_FREERTOS_PORT_ENABLE == 1))
-                    if(rtos_interfaces->set_events != NULL)
-                    {
-                        rtos_status = rtos_interfaces->set_events(worker, EZ_EVENT_TASK_AVAIL);
-                        if(rtos_status != RTOS_STATUS_OK)
-                        {
-                            ret = false;
-                        }
-                    }
-                    else
-                    {
-                        ret = false;
-                    }
-#endif /* (EZ_THREADX_PORT_ENABLE == 1) || (EZ_FREERTOS_PORT_ENABLE == 1) */
-                }
-                else
-                {
-                    ret = false;
-                    ezQueue_ReleaseReservedElement(&worker->msg_queue,
-                                                   (ezReservedElement)task_block);
-                    EZERROR("Cannot add task to %s",worker->worker_name);
-                }
-            }
-#if ((EZ_THREADX_PORT_ENABLE == 1) || (EZ_FREERTOS_PORT_ENABLE == 1))
-            /* Expect nothing wrong when giving semaphore */
-            if(rtos_interfaces->give_semaphore != NULL)
-            {
-                (void)rtos_interfaces->give_semaphore(worker);
-            }
-#endif /* (EZ_THREADX_PORT_ENABLE == 1) || (EZ_FREERTOS_PORT_ENABLE == 1) */
+            /* Copy context data */
+            memcpy(buff, context, context_size);
+            ret = ezTaskWorker_PushBlock(worker, lane, task_block);
         }
+        ezTaskWorker_Unlock(worker);
     }
+
     if(ret == false)
     {
         EZERROR("Enqueue task error");
@@ -253,32 +552,222 @@ bool ezTaskWorker_EnqueueTask(struct ezTaskWorker *worker,
     return ret;
 }
 
-#if ((EZ_THREADX_PORT_ENABLE == 1) || (EZ_FREERTOS_PORT_ENABLE == 1))
-void ezTaskWorker_ExecuteTask(struct ezTaskWorker *worker, uint32_t ticks_to_wait)
+
+bool ezTaskWorker_EnqueueTaskRef(struct ezTaskWorker *worker,
+                                 uint32_t lane,
+                                 ezTaskWorkerTaskFunc task,
+                                 ezTaskWorkerCallbackFunc callback,
+                                 void *context,
+                                 uint32_t ticks_to_wait)
 {
-    ezSTATUS status = ezFAIL;
-    void *context = NULL;
-    struct ezTaskBlockCommon *common = NULL;
-    uint32_t data_size = 0;
-    EZ_RTOS_STATUS rtos_status = RTOS_STATUS_ERR;
+    bool ret = false;
+    ezTaskBlock_t task_block = NULL;
 
-    if((rtos_interfaces != NULL) && (worker != NULL))
+    EZTRACE("ezTaskWorker_EnqueueTaskRef(lane = %d)", lane);
+
+    if((worker != NULL) && (task != NULL) && (callback != NULL) && (context != NULL)
+        && (ezTaskWorker_Lock(worker, ticks_to_wait) == true))
     {
-        EZTRACE("ezTaskWorker_ExecuteTask(woker = %s)", worker->worker_name);
-        if(rtos_interfaces->get_events != NULL)
+        if(ezTaskWorker_ReserveBlock(worker, lane, task, callback, 0, context, &task_block) != NULL)
         {
-            rtos_status = rtos_interfaces->get_events(worker, EZ_EVENT_TASK_AVAIL, ticks_to_wait);
+            ret = ezTaskWorker_PushBlock(worker, lane, task_block);
         }
+        ezTaskWorker_Unlock(worker);
+    }
 
-        if(rtos_status == RTOS_STATUS_OK)
-        {
-            EZDEBUG("Receive EZ_EVENT_TASK_AVAIL");
-            EZTRACE("Getting semaphore from worker = %s", worker->worker_name);
-            rtos_status = RTOS_STATUS_ERR;
-            if(rtos_interfaces->get_events != NULL)
-            {
-                rtos_status = rtos_interfaces->take_semaphore(worker, ticks_to_wait);
+    if(ret == false)
+    {
+        EZERROR("Enqueue task error");
+    }
+
+    return ret;
+}
+
+
+void *ezTaskWorker_ReserveTask(struct ezTaskWorker *worker,
+                               uint32_t lane,
+                               ezTaskWorkerTaskFunc task,
+                               ezTaskWorkerCallbackFunc callback,
+                               uint32_t context_size,
+                               struct ezTaskWorkerReservation *reservation,
+                               uint32_t ticks_to_wait)
+{
+    void *context = NULL;
+
+    EZTRACE("ezTaskWorker_ReserveTask(lane = %d, size = %d)", lane, context_size);
+
+    if((worker != NULL) && (task != NULL) && (callback != NULL)
+        && (context_size > 0) && (reservation != NULL)
+        && (ezTaskWorker_Lock(worker, ticks_to_wait) == true))
+    {
+        context = ezTaskWorker_ReserveBlock(worker, lane, task, callback, context_size, NULL, &reservation->element);
+        reservation->lane = lane;
+        ezTaskWorker_Unlock(worker);
+    }
+
+    if(context == NULL)
+    {
+        EZERROR("Reserve task error");
+    }
+
+    return context;
+}
+
+
+bool ezTaskWorker_SubmitTask(struct ezTaskWorker *worker,
+                             struct ezTaskWorkerReservation *reservation,
+                             uint32_t ticks_to_wait)
+{
+    bool ret = false;
+
+    EZTRACE("ezTaskWorker_SubmitTask()");
+
+    if((worker != NULL) && (reservation != NULL) && (reservation->element != NULL)
+        && (ezTaskWorker_Lock(worker, ticks_to_wait) == true))
+    {
+        ret = ezTaskWorker_PushBlock(worker, reservation->lane, reservation->element);
+        reservation->element = NULL;
+        ezTaskWorker_Unlock(worker);
+    }
+
+    if(ret == false)
+    {
+        EZERROR("Submit task error");
+    }
+
+    return ret;
+}
+
+
+bool ezTaskWorker_CancelTask(struct ezTaskWorker *worker,
+                             struct ezTaskWorkerReservation *reservation,
+                             uint32_t ticks_to_wait)
+{
+    bool ret = false;
+
+    EZTRACE("ezTaskWorker_CancelTask()");
+
+    if((worker != NULL) && (reservation != NULL) && (reservation->element != NULL)
+        && (ezTaskWorker_Lock(worker, ticks_to_wait) == true))
+    {
+        ret = (ezQueue_ReleaseReservedElement(ezTaskWorker_GetLaneQueue(worker, reservation->lane),
+                                              reservation->element) == ezSUCCESS);
+        reservation->element = NULL;
+        ezTaskWorker_Unlock(worker);
+    }
+
+    return ret;
+}
+
+#if (EZ_TIMING_WHEEL == 1U)
+bool ezTaskWorker_EnqueueDelayed(struct ezTaskWorker *worker,
+                                 struct ezTaskWorkerTimer *timer,
+                                 uint32_t lane,
+                                 ezTaskWorkerTaskFunc task,
+                                 ezTaskWorkerCallbackFunc callback,
+                                 void *context,
+                                 uint32_t delay,
+                                 uint32_t ticks_to_wait)
+{
+    bool ret = false;
+
+    EZTRACE("ezTaskWorker_EnqueueDelayed(lane = %d, delay = %d)", lane, delay);
+
+    if((timer != NULL) && (task != NULL) && (callback != NULL) && (context != NULL))
+    {
+        ret = ezTaskWorker_StartTimer(worker, timer, lane, task, callback, context,
+                                      delay, 0, ticks_to_wait);
+    }
+
+    return ret;
+}
+
+
+bool ezTaskWorker_EnqueuePeriodic(struct ezTaskWorker *worker,
+                                  struct ezTaskWorkerTimer *timer,
+                                  uint32_t lane,
+                                  ezTaskWorkerTaskFunc task,
+                                  ezTaskWorkerCallbackFunc callback,
+                                  void *context,
+                                  uint32_t period,
+                                  uint32_t ticks_to_wait)
+{
+    bool ret = false;
+
+    EZTRACE("ezTaskWorker_EnqueuePeriodic(lane = %d, period = %d)", lane, period);
+
+    if((timer != NULL) && (task != NULL) && (callback != NULL) && (context != NULL) && (period > 0))
+    {
+        ret = ezTaskWorker_StartTimer(worker, timer, lane, task, callback, context,
+                                      period, period, ticks_to_wait);
+    }
+
+    return ret;
+}
+
+
+bool ezTaskWorker_CancelTimer(struct ezTaskWorker *worker,
+                              struct ezTaskWorkerTimer *timer,
+                              uint32_t ticks_to_wait)
+{
+    bool ret = false;
+
+    EZTRACE("ezTaskWorker_CancelTimer()");
+
+    /* A zeroed timer has never been started */
+    if((worker != NULL) && (timer != NULL) && (timer->wheel_timer.node.next != NULL)
+        && (ezTaskWorker_Lock(worker, ticks_to_wait) == true))
+    {
+        ret = ezTimingWheel_RemoveTimer(&worker->timer_wheel, &timer->wheel_timer);
+        ezTaskWorker_Unlock(worker);
+    }
+
+    return ret;
+}
+#endif /* EZ_TIMING_WHEEL == 1U */
+
+#if ((EZ_THREADX_PORT_ENABLE == 1) || (EZ_FREERTOS_PORT_ENABLE == 1))
+void ezTaskWorker_ExecuteTask(struct ezTaskWorker *worker, uint32_t ticks_to_wait)
+{
+    void *context = NULL;
+    struct ezTaskBlockCommon *common = NULL;
+    ezQueue *executed_queue = NULL;
+    uint32_t num_of_executed_task = 0;
+    bool is_task_found = false;
+    uint32_t start_time = 0;
+    uint32_t remaining_ticks = ticks_to_wait;
+    uint32_t wait_ticks = 0;
+    EZ_RTOS_STATUS rtos_status = RTOS_STATUS_ERR;
+
+    if((rtos_interfaces != NULL) && (worker != NULL))
+    {
+        EZTRACE("ezTaskWorker_ExecuteTask(woker = %s)", worker->worker_name);
+        start_time = (get_timestamp != NULL) ? get_timestamp() : 0;
+        while(rtos_interfaces->get_events != NULL)
+        {
+            /* Wake up in time for the next due timer, and go back to sleep
+             * if it enqueued nothing */
+            wait_ticks = ezTaskWorker_ProcessTimers(worker, remaining_ticks);
+            rtos_status = rtos_interfaces->get_events(worker, EZ_EVENT_TASK_AVAIL, wait_ticks);
+            if((rtos_status != RTOS_STATUS_OK_TIMEOUT) || (wait_ticks == remaining_ticks))
+            {
+                break;
             }
+
+            if(ticks_to_wait != EZ_THREAD_WAIT_FOREVER)
+            {
+                wait_ticks = get_timestamp() - start_time;
+                if(wait_ticks >= ticks_to_wait)
+                {
+                    break;
+                }
+                remaining_ticks = ticks_to_wait - wait_ticks;
+            }
+        }
+
+        if(rtos_status == RTOS_STATUS_OK)
+        {
+            EZDEBUG("Receive EZ_EVENT_TASK_AVAIL");
         }
         else if (rtos_status == RTOS_STATUS_OK_TIMEOUT)
         {
@@ -289,35 +778,88 @@ void ezTaskWorker_ExecuteTask(struct ezTaskWorker *worker, uint32_t ticks_to_wai
             EZERROR("Receive event error");
         }
 
-        if(rtos_status == RTOS_STATUS_OK)
+        while((rtos_status == RTOS_STATUS_OK)
+            && ((worker->drain_limit == EZ_TASK_WORKER_DRAIN_ALL)
+                || (num_of_executed_task < worker->drain_limit)))
         {
-            EZTRACE("Got semaphore from worker = %s OK", worker->worker_name);
-            status = ezQueue_GetFront(&worker->msg_queue, (void**)&common, &data_size);
+            EZTRACE("Getting semaphore from worker = %s", worker->worker_name);
+            rtos_status = RTOS_STATUS_ERR;
+            if(rtos_interfaces->take_semaphore != NULL)
+            {
+                /* Once a task is executed, its element must be popped, so
+                 * the following takes wait as long as needed */
+                rtos_status = rtos_interfaces->take_semaphore(worker,
+                    (num_of_executed_task == 0) ? ticks_to_wait : EZ_THREAD_WAIT_FOREVER);
+            }
 
-            if((status == ezSUCCESS) && (common->task != NULL))
+            if(rtos_status != RTOS_STATUS_OK)
             {
-                context = common;
-                context += sizeof(struct ezTaskBlockCommon);
-                common->task(context, common->callback);
+                if (rtos_status == RTOS_STATUS_OK_TIMEOUT)
+                {
+                    EZDEBUG("Cannot get semaphore within %d ticks", ticks_to_wait);
+                }
+                else
+                {
+                    EZERROR("get semaphore error");
+                }
+                break;
             }
-            else
+
+            EZTRACE("Got semaphore from worker = %s OK", worker->worker_name);
+            if(executed_queue != NULL)
             {
-                EZERROR("Get data from queue failed");
+                (void)ezQueue_PopFront(executed_queue);
             }
 
-            status = ezQueue_PopFront(&worker->msg_queue);
+            /* Lanes are checked again for every task, so an urgent task
+             * enqueued during the drain is executed next */
+            is_task_found = ezTaskWorker_GetNextTask(worker, &common, &executed_queue);
+
             if(rtos_interfaces->give_semaphore != NULL)
             {
                 (void)rtos_interfaces->give_semaphore(worker);
             }
+
+            if(is_task_found == false)
+            {
+                break;
+            }
+
+            /* Only this worker pops the queue, so the element stays valid
+             * while the task runs without the semaphore */
+            if(common->task != NULL)
+            {
+                context = common->context_ref;
+                if(context == NULL)
+                {
+                    context = common;
+                    context += sizeof(struct ezTaskBlockCommon);
+                }
+                common->task(context, common->callback);
+            }
+            num_of_executed_task++;
         }
-        else if (rtos_status == RTOS_STATUS_OK_TIMEOUT)
-        {
-            EZDEBUG("Cannot get semaphore within %d ticks", ticks_to_wait);
-        }
-        else
+
+        if(executed_queue != NULL)
         {
-            EZERROR("get semaphore error");
+            /* Drain limit reached, pop the last task and set the event
+             * again if tasks are left, because they may have been enqueued
+             * while the event was already set */
+            if(rtos_interfaces->take_semaphore(worker, EZ_THREAD_WAIT_FOREVER) == RTOS_STATUS_OK)
+            {
+                (void)ezQueue_PopFront(executed_queue);
+                is_task_found = ezTaskWorker_GetNextTask(worker, NULL, NULL);
+                (void)rtos_interfaces->give_semaphore(worker);
+
+                if(is_task_found == true)
+                {
+                    (void)rtos_interfaces->set_events(worker, EZ_EVENT_TASK_AVAIL);
+                }
+            }
+            else
+            {
+                EZERROR("get semaphore error");
+            }
         }
     }
 }
@@ -328,24 +870,32 @@ void ezTaskWorker_ExecuteTaskNoRTOS(void)
     struct ezTaskBlockCommon *common = NULL;
     void *context = NULL;
     struct ezTaskWorker *worker = NULL;
-    ezSTATUS status = ezFAIL;
-    uint32_t data_size = 0;
+    ezQueue *queue = NULL;
+    uint32_t num_of_executed_task = 0;
 
     EZTRACE("ezTaskWorker_Run()");
 
     EZ_LINKEDLIST_FOR_EACH(it, &worker_list)
     {
         worker = EZ_LINKEDLIST_GET_PARENT_OF(it, node, struct ezTaskWorker);
-        if(ezQueue_GetNumOfElement(&worker->msg_queue) > 0)
+        (void)ezTaskWorker_ProcessTimers(worker, 0);
+        num_of_executed_task = 0;
+        while(((worker->drain_limit == EZ_TASK_WORKER_DRAIN_ALL)
+                || (num_of_executed_task < worker->drain_limit))
+            && (ezTaskWorker_GetNextTask(worker, &common, &queue) == true))
         {
-            status = ezQueue_GetFront(&worker->msg_queue, (void**)&common, &data_size);
-            if(status == ezSUCCESS && common->task != NULL)
+            if(common->task != NULL)
             {
-                context = common;
-                context += sizeof(struct ezTaskBlockCommon);
+                context = common->context_ref;
+                if(context == NULL)
+                {
+                    context = common;
+                    context += sizeof(struct ezTaskBlockCommon);
+                }
                 common->task(context, common->callback);
             }
-            status = ezQueue_PopFront(&worker->msg_queue);
+            (void)ezQueue_PopFront(queue);
+            num_of_executed_task++;
         }
     }
 }
@@ -354,6 +904,297 @@ void ezTaskWorker_ExecuteTaskNoRTOS(void)
 /*****************************************************************************
 * Local functions
 *****************************************************************************/
+static ezQueue *ezTaskWorker_GetLaneQueue(struct ezTaskWorker *worker, uint32_t lane)
+{
+    ezQueue *queue = &worker->msg_queue;
+
+#if (CONFIG_EZ_TASK_WORKER_NUM_OF_LANE > 1U)
+    if(lane < EZ_TASK_WORKER_LANE_DEFAULT)
+    {
+        queue = &worker->lane_queues[lane];
+    }
+#endif
+
+    return queue;
+}
+
+
+static bool ezTaskWorker_GetNextTask(struct ezTaskWorker *worker,
+                                     struct ezTaskBlockCommon **common,
+                                     ezQueue **queue)
+{
+    bool is_found = false;
+    ezQueue *lane_queue = NULL;
+    struct ezTaskWorkerLaneStats *stats = NULL;
+    uint32_t data_size = 0;
+    uint32_t latency = 0;
+    uint32_t lane = 0;
+
+    for(lane = 0; (lane < CONFIG_EZ_TASK_WORKER_NUM_OF_LANE) && (is_found == false); lane++)
+    {
+        lane_queue = ezTaskWorker_GetLaneQueue(worker, lane);
+        if((ezQueue_IsQueueReady(lane_queue) == true)
+            && (ezQueue_IsEmpty(lane_queue) == false))
+        {
+            if(common == NULL)
+            {
+                is_found = true;
+            }
+            else if(ezQueue_GetFront(lane_queue, (void**)common, &data_size) == ezSUCCESS)
+            {
+                is_found = true;
+                stats = &worker->lane_stats[lane];
+                stats->num_of_executed_task++;
+                if(get_timestamp != NULL)
+                {
+                    latency = get_timestamp() - (*common)->enqueue_time;
+                    stats->last_latency = latency;
+                    if(latency > stats->max_latency)
+                    {
+                        stats->max_latency = latency;
+                    }
+                }
+            }
+            else
+            {
+                EZERROR("Get data from queue failed");
+            }
+        }
+    }
+
+    if(queue != NULL)
+    {
+        *queue = (is_found == true) ? lane_queue : NULL;
+    }
+
+    return is_found;
+}
+
+
+static bool ezTaskWorker_Lock(struct ezTaskWorker *worker, uint32_t ticks_to_wait)
+{
+    bool ret = true;
+#if ((EZ_THREADX_PORT_ENABLE == 1) || (EZ_FREERTOS_PORT_ENABLE == 1))
+    ret = false;
+    if(rtos_interfaces != NULL && rtos_interfaces->take_semaphore != NULL)
+    {
+        EZTRACE("Getting semaphore from worker = %s", worker->worker_name);
+        ret = (rtos_interfaces->take_semaphore(worker, ticks_to_wait) == RTOS_STATUS_OK);
+    }
+#else
+    (void)worker;
+    (void)ticks_to_wait;
+#endif /* (EZ_THREADX_PORT_ENABLE == 1) || (EZ_FREERTOS_PORT_ENABLE == 1) */
+
+    return ret;
+}
+
+
+static void ezTaskWorker_Unlock(struct ezTaskWorker *worker)
+{
+#if ((EZ_THREADX_PORT_ENABLE == 1) || (EZ_FREERTOS_PORT_ENABLE == 1))
+    /* Expect nothing wrong when giving semaphore */
+    if(rtos_interfaces->give_semaphore != NULL)
+    {
+        (void)rtos_interfaces->give_semaphore(worker);
+    }
+#else
+    (void)worker;
+#endif /* (EZ_THREADX_PORT_ENABLE == 1) || (EZ_FREERTOS_PORT_ENABLE == 1) */
+}
+
+
+static void *ezTaskWorker_ReserveBlock(struct ezTaskWorker *worker,
+                                       uint32_t lane,
+                                       ezTaskWorkerTaskFunc task,
+                                       ezTaskWorkerCallbackFunc callback,
+                                       uint32_t context_size,
+                                       void *context_ref,
+                                       ezTaskBlock_t *task_block)
+{
+    void *buff = NULL;
+    ezQueue *queue = NULL;
+    struct ezTaskBlockCommon *common = NULL;
+
+    *task_block = NULL;
+    if(lane < CONFIG_EZ_TASK_WORKER_NUM_OF_LANE)
+    {
+        queue = ezTaskWorker_GetLaneQueue(worker, lane);
+    }
+
+    if((queue != NULL) && (ezQueue_IsQueueReady(queue) == true))
+    {
+        *task_block = (ezTaskBlock_t)ezQueue_ReserveElement(queue,
+                                                            &buff,
+                                                            sizeof(struct ezTaskBlockCommon) + context_size);
+    }
+
+    if((*task_block != NULL) && (buff != NULL))
+    {
+        /* Set common data */
+        common = (struct ezTaskBlockCommon*)buff;
+        common->callback = callback;
+        common->task = task;
+        common->context_ref = context_ref;
+        common->enqueue_time = (get_timestamp != NULL) ? get_timestamp() : 0;
+
+        /* Offset the pointer */
+        buff += sizeof(struct ezTaskBlockCommon);
+    }
+    else
+    {
+        buff = NULL;
+    }
+
+    return buff;
+}
+
+
+static bool ezTaskWorker_PushBlock(struct ezTaskWorker *worker,
+                                   uint32_t lane,
+                                   ezTaskBlock_t task_block)
+{
+    bool ret = false;
+    ezQueue *queue = ezTaskWorker_GetLaneQueue(worker, lane);
+    struct ezTaskWorkerLaneStats *stats = &worker->lane_stats[lane];
+    uint32_t depth = 0;
+
+    if(ezQueue_PushReservedElement(queue, (ezReservedElement)task_block) == ezSUCCESS)
+    {
+        ret = true;
+        stats->num_of_enqueued_task++;
+        depth = ezQueue_GetNumOfElement(queue);
+        if(depth > stats->max_depth)
+        {
+            stats->max_depth = depth;
+        }
+        EZINFO("Add new task to %s",worker->worker_name);
+#if ((EZ_THREADX_PORT_ENABLE == 1) || (EZ_FREERTOS_PORT_ENABLE == 1))
+        if((rtos_interfaces->set_events == NULL)
+            || (rtos_interfaces->set_events(worker, EZ_EVENT_TASK_AVAIL) != RTOS_STATUS_OK))
+        {
+            ret = false;
+        }
+#endif /* (EZ_THREADX_PORT_ENABLE == 1) || (EZ_FREERTOS_PORT_ENABLE == 1) */
+    }
+    else
+    {
+        ezQueue_ReleaseReservedElement(queue, (ezReservedElement)task_block);
+        EZERROR("Cannot add task to %s",worker->worker_name);
+    }
+
+    return ret;
+}
+
+
+static uint32_t ezTaskWorker_ProcessTimers(struct ezTaskWorker *worker, uint32_t max_wait)
+{
+    uint32_t wait = max_wait;
+#if (EZ_TIMING_WHEEL == 1U)
+    uint32_t now = 0;
+    uint32_t next_tick = 0;
+
+    if((get_timestamp != NULL)
+        && (ezTimingWheel_GetNumOfTimer(&worker->timer_wheel) > 0)
+        && (ezTaskWorker_Lock(worker, EZ_THREAD_WAIT_FOREVER) == true))
+    {
+        now = get_timestamp();
+        (void)ezTimingWheel_Advance(&worker->timer_wheel, now, ezTaskWorker_OnTimerExpired, worker);
+        if((ezTimingWheel_GetNextTick(&worker->timer_wheel, &next_tick) == true)
+            && (next_tick - now < wait))
+        {
+            wait = next_tick - now;
+        }
+        ezTaskWorker_Unlock(worker);
+    }
+#else
+    (void)worker;
+#endif /* EZ_TIMING_WHEEL == 1U */
+
+    return wait;
+}
+
+#if (EZ_TIMING_WHEEL == 1U)
+static bool ezTaskWorker_StartTimer(struct ezTaskWorker *worker,
+                                    struct ezTaskWorkerTimer *timer,
+                                    uint32_t lane,
+                                    ezTaskWorkerTaskFunc task,
+                                    ezTaskWorkerCallbackFunc callback,
+                                    void *context,
+                                    uint32_t delay,
+                                    uint32_t period,
+                                    uint32_t ticks_to_wait)
+{
+    bool ret = false;
+    uint32_t now = 0;
+
+    if((worker != NULL) && (get_timestamp != NULL)
+        && (lane < CONFIG_EZ_TASK_WORKER_NUM_OF_LANE)
+        && (ezQueue_IsQueueReady(ezTaskWorker_GetLaneQueue(worker, lane)) == true)
+        && (ezTaskWorker_Lock(worker, ticks_to_wait) == true))
+    {
+        /* Catch up first, so the delay counts from now even if the wheel
+         * has been idle */
+        now = get_timestamp();
+        (void)ezTimingWheel_Advance(&worker->timer_wheel, now, ezTaskWorker_OnTimerExpired, worker);
+
+        /* A zeroed timer has never been used */
+        if(timer->wheel_timer.node.next == NULL)
+        {
+            ezTimingWheel_InitTimer(&timer->wheel_timer);
+        }
+
+        if(ezTimingWheel_IsTimerActive(&timer->wheel_timer) == false)
+        {
+            timer->lane = lane;
+            timer->period = period;
+            timer->task = task;
+            timer->callback = callback;
+            timer->context = context;
+            ret = ezTimingWheel_AddTimer(&worker->timer_wheel, &timer->wheel_timer, now + delay);
+        }
+#if ((EZ_THREADX_PORT_ENABLE == 1) || (EZ_FREERTOS_PORT_ENABLE == 1))
+        /* Wake the worker up, so it waits for the new timer */
+        if(ret == true)
+        {
+            (void)rtos_interfaces->set_events(worker, EZ_EVENT_TASK_AVAIL);
+        }
+#endif /* (EZ_THREADX_PORT_ENABLE == 1) || (EZ_FREERTOS_PORT_ENABLE == 1) */
+        ezTaskWorker_Unlock(worker);
+    }
+
+    if(ret == false)
+    {
+        EZERROR("Start timer error");
+    }
+
+    return ret;
+}
+
+
+static void ezTaskWorker_OnTimerExpired(struct ezTimingWheelTimer *wheel_timer, void *arg)
+{
+    struct ezTaskWorker *worker = (struct ezTaskWorker*)arg;
+    struct ezTaskWorkerTimer *timer = EZ_TIMING_WHEEL_GET_PARENT_OF(wheel_timer, wheel_timer, struct ezTaskWorkerTimer);
+    ezTaskBlock_t task_block = NULL;
+
+    if(ezTaskWorker_ReserveBlock(worker, timer->lane, timer->task, timer->callback,
+                                 0, timer->context, &task_block) != NULL)
+    {
+        (void)ezTaskWorker_PushBlock(worker, timer->lane, task_block);
+    }
+    else
+    {
+        EZERROR("Cannot enqueue timer task to %s", worker->worker_name);
+    }
+
+    if(timer->period > 0)
+    {
+        (void)ezTimingWheel_AddTimer(&worker->timer_wheel, wheel_timer, wheel_timer->expiry + timer->period);
+    }
+}
+#endif /* EZ_TIMING_WHEEL == 1U */
+
 
 #if ((EZ_THREADX_PORT_ENABLE == 1) || (EZ_FREERTOS_PORT_ENABLE == 1))
 static bool ezTaskWorker_CheckRtosInterfaceSanity(struct ezTaskWorkerThreadInterfaces *rtos_interfaces)
@@ -38,6 +38,10 @@ extern "C" {
 #include "ez_linked_list.h"
 #include "ez_queue.h"
 
+#if (EZ_TIMING_WHEEL == 1U)
+#include "ez_timing_wheel.h"
+#endif
+
 #if (EZ_THREADX_PORT_ENABLE == 1)
 #include "tx_api.h"
 #elif (EZ_FREERTOS_PORT_ENABLE == 1)
@@ -53,6 +57,31 @@ extern "C" {
 #define EZ_THREAD_WAIT_NO       0x00        /* Thread does not wait for event, semaphore */
 #define EZ_THREAD_WAIT_FOREVER  0xFFFFFFFF  /* Thread waits for event, semaphore forever */
 #define EZ_EVENT_TASK_AVAIL     0x01        /* Task avaialble event */
+#define EZ_TASK_WORKER_DRAIN_ALL    0U      /* Execute all pending tasks per wakeup */
+
+#ifndef CONFIG_EZ_TASK_WORKER_DRAIN_LIMIT
+#define CONFIG_EZ_TASK_WORKER_DRAIN_LIMIT   1U  /* Default number of tasks executed per wakeup */
+#endif
+
+#ifndef CONFIG_EZ_TASK_WORKER_NUM_OF_LANE
+#define CONFIG_EZ_TASK_WORKER_NUM_OF_LANE   2U  /* Number of priority lanes per worker, lane 0 is the most urgent */
+#endif
+
+#if (CONFIG_EZ_TASK_WORKER_NUM_OF_LANE < 1U)
+#error CONFIG_EZ_TASK_WORKER_NUM_OF_LANE must be at least 1
+#endif
+
+#define EZ_TASK_WORKER_LANE_DEFAULT (CONFIG_EZ_TASK_WORKER_NUM_OF_LANE - 1U)    /* Lowest priority lane, used by ezTaskWorker_EnqueueTask */
+
+#ifndef CONFIG_EZ_TASK_WORKER_NUM_OF_QUEUE_ITEM
+#define CONFIG_EZ_TASK_WORKER_NUM_OF_QUEUE_ITEM 8U  /* Queue items kept by each worker for the task blocks of its lanes, 0 to take them from the queue buffers */
+#endif
+
+#if (EZ_QUEUE_ITEM_POOL == 1U) && (CONFIG_EZ_TASK_WORKER_NUM_OF_QUEUE_ITEM > 0U)
+#define EZ_TASK_WORKER_ITEM_POOL    1U
+#else
+#define EZ_TASK_WORKER_ITEM_POOL    0U
+#endif
 
 
 #if (EZ_THREADX_PORT_ENABLE == 1)
@@ -139,13 +168,39 @@ extern "C" {
 * Component Typedefs
 *****************************************************************************/
 
+/** @brief Counters of a priority lane. Latencies are in the unit of the
+ *         function set by ezTaskWorker_SetTimestampFunc and stay 0 without it
+ */
+struct ezTaskWorkerLaneStats
+{
+    uint32_t num_of_enqueued_task;  /**< Number of tasks enqueued to the lane */
+    uint32_t num_of_executed_task;  /**< Number of tasks executed from the lane */
+    uint32_t max_depth;             /**< Highest number of pending tasks in the lane */
+    uint32_t last_latency;          /**< Time from enqueue to start of the last executed task */
+    uint32_t max_latency;           /**< Highest time from enqueue to start of a task */
+};
+
+
 /** @brief definition of an ezTaskWorker
  */
 struct ezTaskWorker
 {
     
-    ezQueue msg_queue;              /**< Queue containing the tasks to be executed */
+    ezQueue msg_queue;              /**< Queue containing the tasks of the lowest priority lane (EZ_TASK_WORKER_LANE_DEFAULT) */
+#if (CONFIG_EZ_TASK_WORKER_NUM_OF_LANE > 1U)
+    ezQueue lane_queues[CONFIG_EZ_TASK_WORKER_NUM_OF_LANE - 1U];    /**< Queues of the higher priority lanes, added by ezTaskWorker_AddLane */
+#endif
+    struct ezTaskWorkerLaneStats lane_stats[CONFIG_EZ_TASK_WORKER_NUM_OF_LANE];    /**< Counters of every lane */
+#if (EZ_TASK_WORKER_ITEM_POOL == 1U)
+    ezObjPool item_pool;            /**< Queue items of all lanes, only used under the worker semaphore */
+    EZ_OBJ_POOL_SLOT(struct ezQueueItemSlot) item_slots[CONFIG_EZ_TASK_WORKER_NUM_OF_QUEUE_ITEM];
+    /**< Storage of item_pool, CONFIG_EZ_TASK_WORKER_NUM_OF_QUEUE_ITEM * sizeof(struct ezQueueItemSlot) bytes */
+#endif
+#if (EZ_TIMING_WHEEL == 1U)
+    struct ezTimingWheel timer_wheel;   /**< Delayed and periodic tasks of the worker */
+#endif
     char* worker_name;              /**< Name of the worker */
+    uint32_t drain_limit;           /**< Max number of tasks executed per wakeup, EZ_TASK_WORKER_DRAIN_ALL for no limit */
 #if (EZ_THREADX_PORT_ENABLE == 1)
     uint8_t priority;               /**< Priority of the worker thread, the value must match the number of the activated RTOS */
     uint32_t stack_size;            /**< Stask size of the worker thread, in bytes */
@@ -170,6 +225,16 @@ struct ezTaskWorker
 };
 
 
+/** @brief Task reserved by ezTaskWorker_ReserveTask, whose context is built
+ *         in place before it is submitted
+ */
+struct ezTaskWorkerReservation
+{
+    uint32_t lane;                  /**< Lane of the task */
+    ezReservedElement element;      /**< Reserved element in the queue of the lane */
+};
+
+
 #if ((EZ_THREADX_PORT_ENABLE == 1) || (EZ_FREERTOS_PORT_ENABLE == 1))
 
 /** @brief Return status of the RTOS interfaces
@@ -277,6 +342,29 @@ typedef void (*ezTaskWorkerCallbackFunc)(uint8_t event, void *ret_data);
 typedef bool (*ezTaskWorkerTaskFunc)(void *context, ezTaskWorkerCallbackFunc callback);
 
 
+/** @brief Definition of the function returning the current time, used to
+ *         measure the latency of the tasks and to run the timers
+ *  @return: current time in ticks, the unit of ticks_to_wait
+ */
+typedef uint32_t (*ezTaskWorkerTimestampFunc)(void);
+
+
+#if (EZ_TIMING_WHEEL == 1U)
+/** @brief Delayed or periodic task, owned by the caller until it is
+ *         cancelled or, for a delayed task, enqueued
+ */
+struct ezTaskWorkerTimer
+{
+    struct ezTimingWheelTimer wheel_timer;  /**< Timer in the wheel of the worker */
+    uint32_t lane;                          /**< Lane the task is enqueued to when it is due */
+    uint32_t period;                        /**< Period in ticks, 0 for a delayed task */
+    ezTaskWorkerTaskFunc task;              /**< Task function */
+    ezTaskWorkerCallbackFunc callback;      /**< Callback of the task */
+    void *context;                          /**< Context passed to the task, not copied */
+};
+#endif /* EZ_TIMING_WHEEL == 1U */
+
+
 /*****************************************************************************
 * Component Variable Definitions
 *****************************************************************************/
@@ -293,7 +381,10 @@ typedef bool (*ezTaskWorkerTaskFunc)(void *context, ezTaskWorkerCallbackFunc cal
 *
 * @details This function create the task queue, add the worker to list
 *          of worker for managing. If an RTOS is activated, it will create a
-*          thread, a semephore, and an event group of the worker.
+*          thread, a semephore, and an event group of the worker. The queue
+*          items of the task blocks are taken from the items kept in the
+*          worker first, see CONFIG_EZ_TASK_WORKER_NUM_OF_QUEUE_ITEM. They are
+*          shared by the lanes of this worker only.
 *
 * @param[in]    worker: Worker to be initialized
 * @param[in]    queue_buffer: buffer to queue task and data
@@ -322,6 +413,133 @@ bool ezTaskWorker_CreateWorker(struct ezTaskWorker *worker,
                                void *thread_func);
 
 
+/*****************************************************************************
+* Function: ezTaskWorker_SetDrainLimit
+*//** 
+* @brief Set how many tasks a worker executes each time it gets processing
+*        time
+*
+* @details With a limit of 1, the worker waits for an event before every
+*          task. A higher limit saves the wakeups when tasks come in bursts,
+*          but delays the other workers sharing the thread (no RTOS case).
+*          The limit is reset to CONFIG_EZ_TASK_WORKER_DRAIN_LIMIT by
+*          ezTaskWorker_CreateWorker.
+*
+* @param[in]    worker: pointer to the worker
+* @param[in]    drain_limit: max number of tasks per wakeup, or
+*                            EZ_TASK_WORKER_DRAIN_ALL to empty the queue
+* @return       Return true if success, otherwise false
+*
+* @pre worker is created by ezTaskWorker_CreateWorker
+* @post None
+*
+* \b Example
+* @code
+*
+* (void)ezTaskWorker_SetDrainLimit(&worker, 8);
+* @endcode
+*
+* @see ezTaskWorker_ExecuteTask, ezTaskWorker_ExecuteTaskNoRTOS
+*
+*****************************************************************************/
+bool ezTaskWorker_SetDrainLimit(struct ezTaskWorker *worker, uint32_t drain_limit);
+
+
+/*****************************************************************************
+* Function: ezTaskWorker_AddLane
+*//** 
+* @brief Add a priority lane to a worker
+*
+* @details A worker always executes the task of the most urgent non-empty
+*          lane first (strict priority), tasks of the same lane are executed
+*          in FIFO order. The lowest priority lane EZ_TASK_WORKER_LANE_DEFAULT
+*          uses the queue of ezTaskWorker_CreateWorker, the other lanes must
+*          be added before tasks are enqueued to them.
+*
+* @param[in]    worker: pointer to the worker
+* @param[in]    lane: lane to add, lower than EZ_TASK_WORKER_LANE_DEFAULT
+* @param[in]    queue_buffer: buffer storing the tasks of the lane
+* @param[in]    queue_buffer_size: size of the buffer
+* @return       Return true if success, otherwise false
+*
+* @pre worker is created by ezTaskWorker_CreateWorker and is not executing
+*      tasks
+* @post None
+*
+* \b Example
+* @code
+*
+* static uint8_t urgent_buff[64];
+* (void)ezTaskWorker_AddLane(&worker, 0, urgent_buff, sizeof(urgent_buff));
+* @endcode
+*
+* @see ezTaskWorker_EnqueueTaskToLane
+*
+*****************************************************************************/
+bool ezTaskWorker_AddLane(struct ezTaskWorker *worker,
+                          uint32_t lane,
+                          uint8_t *queue_buffer,
+                          uint32_t queue_buffer_size);
+
+
+/*****************************************************************************
+* Function: ezTaskWorker_GetLaneStats
+*//** 
+* @brief Get the counters of a priority lane
+*
+* @details
+*
+* @param[in]    worker: pointer to the worker
+* @param[in]    lane: lane to get the counters
+* @param[out]   stats: copy of the counters
+* @return       Return true if success, otherwise false
+*
+* @pre worker is created by ezTaskWorker_CreateWorker
+* @post None
+*
+* \b Example
+* @code
+*
+* struct ezTaskWorkerLaneStats stats;
+* (void)ezTaskWorker_GetLaneStats(&worker, EZ_TASK_WORKER_LANE_DEFAULT, &stats);
+* @endcode
+*
+* @see ezTaskWorker_SetTimestampFunc
+*
+*****************************************************************************/
+bool ezTaskWorker_GetLaneStats(struct ezTaskWorker *worker,
+                               uint32_t lane,
+                               struct ezTaskWorkerLaneStats *stats);
+
+
+/*****************************************************************************
+* Function: ezTaskWorker_SetTimestampFunc
+*//** 
+* @brief Set the function returning the current time, so that the latency
+*        of the tasks is measured and delayed tasks can be used
+*
+* @details The time is taken when a task is enqueued and when it starts.
+*          Delayed and periodic tasks count in the same unit, which must be
+*          the RTOS tick when RTOS is used. Pass NULL to stop measuring.
+*
+* @param[in]    timestamp_func: function returning the current time
+* @return       None
+*
+* @pre None
+* @post None
+*
+* \b Example
+* @code
+*
+* ezTaskWorker_SetTimestampFunc(xTaskGetTickCount);
+* @endcode
+*
+* @see ezTaskWorker_GetLaneStats
+*
+*****************************************************************************/
+void ezTaskWorker_SetTimestampFunc(ezTaskWorkerTimestampFunc timestamp_func);
+
+
 #if ((EZ_THREADX_PORT_ENABLE == 1) || (EZ_FREERTOS_PORT_ENABLE == 1))
 /*****************************************************************************
 * Function: ezTaskWorker_SetRtosInterface
@@ -356,7 +574,7 @@ bool ezTaskWorker_SetRtosInterface(struct ezTaskWorkerThreadInterfaces *interfac
 *//** 
 * @brief Enqueue a task and its data so that they can be executed later
 *
-* @details
+* @details The task is enqueued to the lane EZ_TASK_WORKER_LANE_DEFAULT
 *
 * @param[in]    worker: worker that will execute the task
 * @param[in]    task: pointing to the task function
@@ -388,6 +606,315 @@ bool ezTaskWorker_EnqueueTask(struct ezTaskWorker *worker,
                               uint32_t context_size,
                               uint32_t ticks_to_wait);
 
+
+/*****************************************************************************
+* Function: ezTaskWorker_EnqueueTaskToLane
+*//** 
+* @brief Enqueue a task and its data to a priority lane
+*
+* @details
+*
+* @param[in]    worker: worker that will execute the task
+* @param[in]    lane: lane of the task, 0 is the most urgent
+* @param[in]    task: pointing to the task function
+* @param[in]    callback: callback to return result of the task's execution.
+* @param[in]    context: context data of the task function
+* @param[in]    contex_size: size of the context
+* @param[in]    ticks_to_wait: number of tick to wait for the semaphore
+* @return       Return true if success, otherwise false
+*
+* @pre The lane is added by ezTaskWorker_AddLane, except
+*      EZ_TASK_WORKER_LANE_DEFAULT
+* @post None
+*
+* \b Example
+* @code
+*
+* bool bResult = ezTaskWorker_EnqueueTaskToLane(&worker, 0, control_task, callback,
+*                                               &context, sizeof(struct Context),
+*                                               EZ_THREAD_WAIT_FOREVER);
+* @endcode
+*
+* @see ezTaskWorker_AddLane, ezTaskWorker_EnqueueTask
+*
+*****************************************************************************/
+bool ezTaskWorker_EnqueueTaskToLane(struct ezTaskWorker *worker,
+                                    uint32_t lane,
+                                    ezTaskWorkerTaskFunc task,
+                                    ezTaskWorkerCallbackFunc callback,
+                                    void *context,
+                                    uint32_t context_size,
+                                    uint32_t ticks_to_wait);
+
+
+/*****************************************************************************
+* Function: ezTaskWorker_EnqueueTaskRef
+*//** 
+* @brief Enqueue a task whose context is not copied
+*
+* @details The task receives the context pointer itself. The caller owns the
+*          context memory and must keep it valid and unchanged until the
+*          task is executed, e.g. until the callback is called.
+*
+* @param[in]    worker: worker that will execute the task
+* @param[in]    lane: lane of the task, 0 is the most urgent
+* @param[in]    task: pointing to the task function
+* @param[in]    callback: callback to return result of the task's execution.
+* @param[in]    context: context passed to the task function
+* @param[in]    ticks_to_wait: number of tick to wait for the semaphore
+* @return       Return true if success, otherwise false
+*
+* @pre None
+* @post None
+*
+* \b Example
+* @code
+*
+* static uint8_t frame[1024];
+* bool bResult = ezTaskWorker_EnqueueTaskRef(&worker, EZ_TASK_WORKER_LANE_DEFAULT,
+*                                            send_frame, callback, frame,
+*                                            EZ_THREAD_WAIT_FOREVER);
+* @endcode
+*
+* @see ezTaskWorker_EnqueueTaskToLane
+*
+*****************************************************************************/
+bool ezTaskWorker_EnqueueTaskRef(struct ezTaskWorker *worker,
+                                 uint32_t lane,
+                                 ezTaskWorkerTaskFunc task,
+                                 ezTaskWorkerCallbackFunc callback,
+                                 void *context,
+                                 uint32_t ticks_to_wait);
+
+
+/*****************************************************************************
+* Function: ezTaskWorker_ReserveTask
+*//** 
+* @brief Reserve a task in the queue of a lane and return its context
+*        storage, so that the context is built in place instead of copied
+*
+* @details The task is not visible to the worker until
+*          ezTaskWorker_SubmitTask is called. Every reservation must be
+*          submitted or cancelled. With EZ_QUEUE_RING, tasks enqueued to the
+*          same lane after the reservation are held back until it is
+*          submitted or cancelled, so keep it short.
+*
+* @param[in]    worker: worker that will execute the task
+* @param[in]    lane: lane of the task, 0 is the most urgent
+* @param[in]    task: pointing to the task function
+* @param[in]    callback: callback to return result of the task's execution.
+* @param[in]    context_size: size of the context
+* @param[out]   reservation: reserved task, passed to ezTaskWorker_SubmitTask
+* @param[in]    ticks_to_wait: number of tick to wait for the semaphore
+* @return       Address of the context storage, NULL if error
+*
+* @pre None
+* @post None
+*
+* \b Example
+* @code
+*
+* struct ezTaskWorkerReservation reservation;
+* struct Context *context = ezTaskWorker_ReserveTask(&worker, EZ_TASK_WORKER_LANE_DEFAULT,
+*                                                    worker_task, callback,
+*                                                    sizeof(struct Context), &reservation,
+*                                                    EZ_THREAD_WAIT_FOREVER);
+* if(context != NULL)
+* {
+*     context->a = 1;
+*     (void)ezTaskWorker_SubmitTask(&worker, &reservation, EZ_THREAD_WAIT_FOREVER);
+* }
+* @endcode
+*
+* @see ezTaskWorker_SubmitTask, ezTaskWorker_CancelTask
+*
+*****************************************************************************/
+void *ezTaskWorker_ReserveTask(struct ezTaskWorker *worker,
+                               uint32_t lane,
+                               ezTaskWorkerTaskFunc task,
+                               ezTaskWorkerCallbackFunc callback,
+                               uint32_t context_size,
+                               struct ezTaskWorkerReservation *reservation,
+                               uint32_t ticks_to_wait);
+
+
+/*****************************************************************************
+* Function: ezTaskWorker_SubmitTask
+*//** 
+* @brief Make a reserved task visible to the worker
+*
+* @details
+*
+* @param[in]    worker: worker of the reservation
+* @param[in]    reservation: task reserved by ezTaskWorker_ReserveTask
+* @param[in]    ticks_to_wait: number of tick to wait for the semaphore
+* @return       Return true if success, otherwise false
+*
+* @pre reservation is returned by ezTaskWorker_ReserveTask
+* @post The reservation cannot be used anymore
+*
+* \b Example
+* @code
+*
+* (void)ezTaskWorker_SubmitTask(&worker, &reservation, EZ_THREAD_WAIT_FOREVER);
+* @endcode
+*
+* @see ezTaskWorker_ReserveTask
+*
+*****************************************************************************/
+bool ezTaskWorker_SubmitTask(struct ezTaskWorker *worker,
+                             struct ezTaskWorkerReservation *reservation,
+                             uint32_t ticks_to_wait);
+
+
+/*****************************************************************************
+* Function: ezTaskWorker_CancelTask
+*//** 
+* @brief Release a reserved task without executing it
+*
+* @details
+*
+* @param[in]    worker: worker of the reservation
+* @param[in]    reservation: task reserved by ezTaskWorker_ReserveTask
+* @param[in]    ticks_to_wait: number of tick to wait for the semaphore
+* @return       Return true if success, otherwise false
+*
+* @pre reservation is returned by ezTaskWorker_ReserveTask
+* @post The reservation cannot be used anymore
+*
+* \b Example
+* @code
+*
+* (void)ezTaskWorker_CancelTask(&worker, &reservation, EZ_THREAD_WAIT_FOREVER);
+* @endcode
+*
+* @see ezTaskWorker_ReserveTask
+*
+*****************************************************************************/
+bool ezTaskWorker_CancelTask(struct ezTaskWorker *worker,
+                             struct ezTaskWorkerReservation *reservation,
+                             uint32_t ticks_to_wait);
+
+#if (EZ_TIMING_WHEEL == 1U)
+/*****************************************************************************
+* Function: ezTaskWorker_EnqueueDelayed
+*//** 
+* @brief Enqueue a task after a delay
+*
+* @details The task is enqueued to its lane when the worker processes the
+*          tick now + delay, a delay of 0 means the next tick. Like
+*          ezTaskWorker_EnqueueTaskRef, the context is not copied.
+*
+* @param[in]    worker: worker that will execute the task
+* @param[in]    timer: storage of the delayed task, owned by the caller
+* @param[in]    lane: lane of the task, 0 is the most urgent
+* @param[in]    task: pointing to the task function
+* @param[in]    callback: callback to return result of the task's execution.
+* @param[in]    context: context passed to the task function
+* @param[in]    delay: delay in ticks of the timestamp function
+* @param[in]    ticks_to_wait: number of tick to wait for the semaphore
+* @return       Return true if success, otherwise false
+*
+* @pre The timestamp function is set by ezTaskWorker_SetTimestampFunc, the
+*      timer is zero-initialized or not running
+* @post None
+*
+* \b Example
+* @code
+*
+* static struct ezTaskWorkerTimer retry_timer;
+* bool bResult = ezTaskWorker_EnqueueDelayed(&worker, &retry_timer, EZ_TASK_WORKER_LANE_DEFAULT,
+*                                            retry_task, callback, &retry_context,
+*                                            100, EZ_THREAD_WAIT_FOREVER);
+* @endcode
+*
+* @see ezTaskWorker_EnqueuePeriodic, ezTaskWorker_CancelTimer
+*
+*****************************************************************************/
+bool ezTaskWorker_EnqueueDelayed(struct ezTaskWorker *worker,
+                                 struct ezTaskWorkerTimer *timer,
+                                 uint32_t lane,
+                                 ezTaskWorkerTaskFunc task,
+                                 ezTaskWorkerCallbackFunc callback,
+                                 void *context,
+                                 uint32_t delay,
+                                 uint32_t ticks_to_wait);
+
+
+/*****************************************************************************
+* Function: ezTaskWorker_EnqueuePeriodic
+*//** 
+* @brief Enqueue a task every period, the first time after one period
+*
+* @details The period does not drift with the time the worker needs to
+*          process the timers. If the queue of the lane is full when the
+*          task is due, this occurrence is skipped.
+*
+* @param[in]    worker: worker that will execute the task
+* @param[in]    timer: storage of the periodic task, owned by the caller
+* @param[in]    lane: lane of the task, 0 is the most urgent
+* @param[in]    task: pointing to the task function
+* @param[in]    callback: callback to return result of the task's execution.
+* @param[in]    context: context passed to the task function
+* @param[in]    period: period in ticks of the timestamp function, not 0
+* @param[in]    ticks_to_wait: number of tick to wait for the semaphore
+* @return       Return true if success, otherwise false
+*
+* @pre The timestamp function is set by ezTaskWorker_SetTimestampFunc, the
+*      timer is zero-initialized or not running
+* @post None
+*
+* \b Example
+* @code
+*
+* static struct ezTaskWorkerTimer control_timer;
+* bool bResult = ezTaskWorker_EnqueuePeriodic(&worker, &control_timer, 0,
+*                                             control_task, callback, &control_context,
+*                                             10, EZ_THREAD_WAIT_FOREVER);
+* @endcode
+*
+* @see ezTaskWorker_EnqueueDelayed, ezTaskWorker_CancelTimer
+*
+*****************************************************************************/
+bool ezTaskWorker_EnqueuePeriodic(struct ezTaskWorker *worker,
+                                  struct ezTaskWorkerTimer *timer,
+                                  uint32_t lane,
+                                  ezTaskWorkerTaskFunc task,
+                                  ezTaskWorkerCallbackFunc callback,
+                                  void *context,
+                                  uint32_t period,
+                                  uint32_t ticks_to_wait);
+
+
+/*****************************************************************************
+* Function: ezTaskWorker_CancelTimer
+*//** 
+* @brief Stop a delayed or periodic task
+*
+* @details An occurrence already enqueued is still executed
+*
+* @param[in]    worker: worker of the timer
+* @param[in]    timer: timer to stop
+* @param[in]    ticks_to_wait: number of tick to wait for the semaphore
+* @return       Return true if success, false if the timer is not running
+*
+* @pre None
+* @post None
+*
+* \b Example
+* @code
+*
+* (void)ezTaskWorker_CancelTimer(&worker, &control_timer, EZ_THREAD_WAIT_FOREVER);
+* @endcode
+*
+* @see ezTaskWorker_EnqueueDelayed, ezTaskWorker_EnqueuePeriodic
+*
+*****************************************************************************/
+bool ezTaskWorker_CancelTimer(struct ezTaskWorker *worker,
+                              struct ezTaskWorkerTimer *timer,
+                              uint32_t ticks_to_wait);
+#endif /* EZ_TIMING_WHEEL == 1U */
+
 #if ((EZ_THREADX_PORT_ENABLE == 1) || (EZ_FREERTOS_PORT_ENABLE == 1))
 /*****************************************************************************
 * Function: ezTaskWorker_ExecuteTask
@@ -395,7 +922,15 @@ bool ezTaskWorker_EnqueueTask(struct ezTaskWorker *worker,
 * @brief This function is call within the THREAD_FUNC to let the worker execute
 *        available task
 *
-* @details This function is used when RTOS is activated
+* @details This function is used when RTOS is activated. After the event,
+*          the worker executes up to drain_limit tasks. Each task is taken
+*          from the queue under the semaphore and executed without it, so
+*          enqueuing is not blocked by a running task. If tasks are left
+*          when the limit is reached, the event is set again so the next
+*          call does not wait. Due delayed and periodic tasks are enqueued
+*          first, and the wait for the event ends at the next due one, so
+*          the thread can wait forever with sleep_ticks = 0 instead of
+*          polling.
 *
 * @param[in]    worker: pointer to the worker which execute the task
 * @param[in]    ticks_to_wait: number of tick to wait for task available
@@ -428,7 +963,9 @@ void ezTaskWorker_ExecuteTask(struct ezTaskWorker *worker, uint32_t ticks_to_wai
 * @brief If no RTOS is used, this function provides the processing time to
 *        the worker
 *
-* @details This function must be called periodically to provide processing time
+* @details This function must be called periodically to provide processing time.
+*          Every worker enqueues its due delayed and periodic tasks, then
+*          executes up to drain_limit tasks per call.
 *
 * @param    None
 * @return   None
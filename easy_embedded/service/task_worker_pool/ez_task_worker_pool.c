@@ -0,0 +1,499 @@
+/*****************************************************************************
+* Filename:         ez_task_worker_pool.c
+* Author:           Hai Nguyen
+* Original Date:    18.10.2026
+*
+* ----------------------------------------------------------------------------
+* Contact:          Hai Nguyen
+*                   hainguyen.eeit@gmail.com
+*
+* ----------------------------------------------------------------------------
+* License: This file is published under the license described in LICENSE.md
+*
+*****************************************************************************/
+
+/** @file   ez_task_worker_pool.c
+ *  @author Hai Nguyen
+ *  @date   18.10.2026
+ *  @brief  Implementation of the task worker pool component
+ *
+ *  @details num_of_task counts the tasks which are in a queue and not
+ *  claimed yet. A thread first claims a task by decrementing it, then
+ *  searches the queues until it finds one. A task is pushed before it is
+ *  counted, so a thread holding a claim always finds a task. Producers
+ *  only take the pool lock to wake up a sleeping thread.
+ *
+ *  A producer increments num_of_enqueuing before it checks is_stopping.
+ *  A stopping thread only exits when no enqueue is in progress, so a task
+ *  accepted while the pool stops is still executed.
+ */
+
+/*****************************************************************************
+* Includes
+*****************************************************************************/
+#include "ez_task_worker_pool.h"
+
+#if (EZ_TASK_WORKER_POOL == 1)
+
+#define DEBUG_LVL   LVL_INFO                /**< logging level */
+#define MOD_NAME    "ez_task_worker_pool"   /**< module name */
+
+#include "ez_logging.h"
+#include <string.h>
+
+
+/*****************************************************************************
+* Component Preprocessor Macros
+*****************************************************************************/
+#define TASK_BLOCK_SIZE     (sizeof(struct ezTaskBlockCommon) + CONFIG_EZ_TASK_WORKER_POOL_MAX_CONTEXT_SIZE)
+
+
+/*****************************************************************************
+* Component Typedefs
+*****************************************************************************/
+
+/** @brief Common data stored in front of the context of a task
+ */
+struct ezTaskBlockCommon
+{
+    ezTaskWorkerTaskFunc task;          /**< Task that will be executed */
+    ezTaskWorkerCallbackFunc callback;  /**< Callback to notify the result of the task */
+};
+
+
+/*****************************************************************************
+* Component Variable Definitions
+*****************************************************************************/
+/* None */
+
+
+/*****************************************************************************
+* Function Definitions
+*****************************************************************************/
+static void ezTaskWorkerPool_Run(void *arg);
+static bool ezTaskWorkerPool_ClaimTask(struct ezTaskWorkerPool *pool);
+static void ezTaskWorkerPool_FindTask(struct ezTaskWorkerPoolThread *self, void *task_block);
+static bool ezTaskWorkerPool_TakeTask(struct ezTaskWorkerPoolThread *thread,
+                                      bool is_stealing,
+                                      void *task_block);
+
+
+/*****************************************************************************
+* Public functions
+*****************************************************************************/
+bool ezTaskWorkerPool_Create(struct ezTaskWorkerPool *pool,
+                             struct ezTaskWorkerPoolThread *threads,
+                             uint32_t num_of_thread,
+                             uint8_t *queue_buffer,
+                             uint32_t queue_buffer_size,
+                             uint8_t *stack_buffer,
+                             uint32_t stack_size,
+                             uint32_t priority)
+{
+    bool is_success = false;
+    uint32_t queue_size = 0;
+    uint32_t i = 0;
+
+    EZTRACE("ezTaskWorkerPool_Create()");
+
+    if (pool != NULL && threads != NULL && num_of_thread > 0 && queue_buffer != NULL)
+    {
+        pool->threads = threads;
+        pool->num_of_thread = num_of_thread;
+        pool->num_of_running_thread = 0;
+        atomic_init(&pool->num_of_task, 0U);
+        atomic_init(&pool->num_of_sleeper, 0U);
+        atomic_init(&pool->next_thread, 0U);
+        atomic_init(&pool->num_of_enqueuing, 0U);
+        atomic_init(&pool->is_stopping, false);
+
+        is_success = (ezOsal_MutexCreate(&pool->lock) == EZ_OSAL_OK
+                      && ezOsal_CondCreate(&pool->task_avail) == EZ_OSAL_OK
+                      && ezOsal_CondCreate(&pool->thread_exit) == EZ_OSAL_OK);
+
+        queue_size = queue_buffer_size / num_of_thread;
+        for (i = 0; i < num_of_thread && is_success == true; i++)
+        {
+            threads[i].pool = pool;
+            threads[i].num_of_executed_task = 0;
+            threads[i].num_of_stolen_task = 0;
+            /* Each queue is only protected by its thread lock, it must not
+             * share block headers with the other queues */
+            is_success = (ezQueue_CreateLocalQueue(&threads[i].task_queue,
+                                                   queue_buffer + i * queue_size,
+                                                   queue_size) == ezSUCCESS
+                          && ezOsal_MutexCreate(&threads[i].lock) == EZ_OSAL_OK);
+        }
+
+        for (i = 0; i < num_of_thread && is_success == true; i++)
+        {
+            (void)ezOsal_MutexLock(&pool->lock);
+            pool->num_of_running_thread++;
+            (void)ezOsal_MutexUnlock(&pool->lock);
+
+            if (ezOsal_ThreadCreate(&threads[i].thread,
+                                    "ez_task_worker_pool",
+                                    ezTaskWorkerPool_Run,
+                                    &threads[i],
+                                    (stack_buffer != NULL) ? stack_buffer + i * stack_size : NULL,
+                                    stack_size,
+                                    priority) != EZ_OSAL_OK)
+            {
+                (void)ezOsal_MutexLock(&pool->lock);
+                pool->num_of_running_thread--;
+                (void)ezOsal_MutexUnlock(&pool->lock);
+
+                /* Let the threads already started exit */
+                ezTaskWorkerPool_Stop(pool);
+                is_success = false;
+            }
+        }
+    }
+
+    if (is_success == false)
+    {
+        EZERROR("Create task worker pool failed");
+    }
+
+    return is_success;
+}
+
+
+bool ezTaskWorkerPool_EnqueueTask(struct ezTaskWorkerPool *pool,
+                                  ezTaskWorkerTaskFunc task,
+                                  ezTaskWorkerCallbackFunc callback,
+                                  void *context,
+                                  uint32_t context_size)
+{
+    bool is_success = false;
+    uint32_t start = 0;
+    uint32_t i = 0;
+
+    if (pool != NULL && pool->num_of_thread > 0)
+    {
+        start = atomic_fetch_add(&pool->next_thread, 1U);
+        for (i = 0; i < pool->num_of_thread && is_success == false; i++)
+        {
+            is_success = ezTaskWorkerPool_EnqueueTaskTo(pool,
+                                                        (start + i) % pool->num_of_thread,
+                                                        task,
+                                                        callback,
+                                                        context,
+                                                        context_size);
+        }
+    }
+
+    return is_success;
+}
+
+
+bool ezTaskWorkerPool_EnqueueTaskTo(struct ezTaskWorkerPool *pool,
+                                    uint32_t thread_index,
+                                    ezTaskWorkerTaskFunc task,
+                                    ezTaskWorkerCallbackFunc callback,
+                                    void *context,
+                                    uint32_t context_size)
+{
+    bool is_success = false;
+    struct ezTaskWorkerPoolThread *thread = NULL;
+    struct ezTaskBlockCommon *common = NULL;
+    ezReservedElement task_block = NULL;
+
+    if (pool != NULL && thread_index < pool->num_of_thread
+        && task != NULL && callback != NULL
+        && (context != NULL || context_size == 0)
+        && context_size <= CONFIG_EZ_TASK_WORKER_POOL_MAX_CONTEXT_SIZE)
+    {
+        /* Pairs with ezTaskWorkerPool_Stop setting is_stopping before the
+         * threads check num_of_enqueuing, one of both sides sees the other */
+        (void)atomic_fetch_add(&pool->num_of_enqueuing, 1U);
+        if (atomic_load(&pool->is_stopping) == false)
+        {
+            thread = &pool->threads[thread_index];
+
+            (void)ezOsal_MutexLock(&thread->lock);
+            task_block = ezQueue_ReserveElement(&thread->task_queue,
+                                                (void **)&common,
+                                                sizeof(struct ezTaskBlockCommon) + context_size);
+            if (task_block != NULL && common != NULL)
+            {
+                common->task = task;
+                common->callback = callback;
+                if (context_size > 0)
+                {
+                    memcpy((uint8_t *)common + sizeof(struct ezTaskBlockCommon), context, context_size);
+                }
+                is_success = (ezQueue_PushReservedElement(&thread->task_queue, task_block) == ezSUCCESS);
+            }
+            (void)ezOsal_MutexUnlock(&thread->lock);
+        }
+
+        if (is_success == true)
+        {
+            (void)atomic_fetch_add(&pool->num_of_task, 1U);
+        }
+        (void)atomic_fetch_sub(&pool->num_of_enqueuing, 1U);
+
+        /* Pairs with the sleeper incrementing num_of_sleeper before checking
+         * num_of_task and num_of_enqueuing, one of both sides sees the other.
+         * While stopping, every sleeper may wait for this enqueue to end */
+        if (atomic_load(&pool->num_of_sleeper) > 0U
+            && (is_success == true || atomic_load(&pool->is_stopping) == true))
+        {
+            (void)ezOsal_MutexLock(&pool->lock);
+            if (atomic_load(&pool->is_stopping) == true)
+            {
+                (void)ezOsal_CondBroadcast(&pool->task_avail);
+            }
+            else
+            {
+                (void)ezOsal_CondSignal(&pool->task_avail);
+            }
+            (void)ezOsal_MutexUnlock(&pool->lock);
+        }
+    }
+
+    return is_success;
+}
+
+
+uint32_t ezTaskWorkerPool_GetNumOfPendingTask(struct ezTaskWorkerPool *pool)
+{
+    uint32_t num_of_task = 0;
+
+    if (pool != NULL)
+    {
+        num_of_task = atomic_load(&pool->num_of_task);
+    }
+
+    return num_of_task;
+}
+
+
+void ezTaskWorkerPool_Stop(struct ezTaskWorkerPool *pool)
+{
+    EZTRACE("ezTaskWorkerPool_Stop()");
+
+    if (pool != NULL)
+    {
+        atomic_store(&pool->is_stopping, true);
+
+        (void)ezOsal_MutexLock(&pool->lock);
+        (void)ezOsal_CondBroadcast(&pool->task_avail);
+        while (pool->num_of_running_thread > 0U)
+        {
+            (void)ezOsal_CondWait(&pool->thread_exit, &pool->lock, EZ_OSAL_WAIT_FOREVER);
+        }
+        (void)ezOsal_MutexUnlock(&pool->lock);
+    }
+}
+
+
+/*****************************************************************************
+* Local functions
+*****************************************************************************/
+
+/*****************************************************************************
+* Function: ezTaskWorkerPool_Run
+*//**
+* @brief Body of a thread of the pool
+*
+* @details Claim a task, find it, execute it. Exit when the pool is stopping
+* and no task is left.
+*
+* @param[in]    arg: the ezTaskWorkerPoolThread of the thread
+* @return       None
+*
+* @pre None
+* @post None
+*
+* \b Example
+* @code
+* @endcode
+*
+* @see None
+*
+*****************************************************************************/
+static void ezTaskWorkerPool_Run(void *arg)
+{
+    struct ezTaskWorkerPoolThread *self = (struct ezTaskWorkerPoolThread *)arg;
+    struct ezTaskWorkerPool *pool = self->pool;
+    uint64_t task_block[(TASK_BLOCK_SIZE + sizeof(uint64_t) - 1U) / sizeof(uint64_t)];
+    struct ezTaskBlockCommon *common = (struct ezTaskBlockCommon *)task_block;
+
+    while (ezTaskWorkerPool_ClaimTask(pool) == true)
+    {
+        ezTaskWorkerPool_FindTask(self, task_block);
+        (void)common->task((uint8_t *)task_block + sizeof(struct ezTaskBlockCommon), common->callback);
+        self->num_of_executed_task++;
+    }
+
+    (void)ezOsal_MutexLock(&pool->lock);
+    pool->num_of_running_thread--;
+    if (pool->num_of_running_thread == 0U)
+    {
+        (void)ezOsal_CondBroadcast(&pool->thread_exit);
+    }
+    (void)ezOsal_MutexUnlock(&pool->lock);
+}
+
+
+/*****************************************************************************
+* Function: ezTaskWorkerPool_ClaimTask
+*//**
+* @brief Claim one of the enqueued tasks, sleeping while there is none
+*
+* @details
+*
+* @param[in]    pool: pool
+* @return       true if a task is claimed, false if the pool is stopping
+*               and no task is left
+*
+* @pre None
+* @post None
+*
+* \b Example
+* @code
+* @endcode
+*
+* @see None
+*
+*****************************************************************************/
+static bool ezTaskWorkerPool_ClaimTask(struct ezTaskWorkerPool *pool)
+{
+    bool is_claimed = false;
+    bool is_exiting = false;
+    uint_least32_t num_of_task = 0;
+
+    while (is_claimed == false && is_exiting == false)
+    {
+        num_of_task = atomic_load(&pool->num_of_task);
+        if (num_of_task > 0U)
+        {
+            is_claimed = atomic_compare_exchange_weak(&pool->num_of_task,
+                                                      &num_of_task,
+                                                      num_of_task - 1U);
+        }
+        else
+        {
+            (void)ezOsal_MutexLock(&pool->lock);
+            (void)atomic_fetch_add(&pool->num_of_sleeper, 1U);
+            while (atomic_load(&pool->num_of_task) == 0U
+                   && (atomic_load(&pool->is_stopping) == false
+                       || atomic_load(&pool->num_of_enqueuing) > 0U))
+            {
+                (void)ezOsal_CondWait(&pool->task_avail, &pool->lock, EZ_OSAL_WAIT_FOREVER);
+            }
+            is_exiting = (atomic_load(&pool->num_of_task) == 0U);
+            (void)atomic_fetch_sub(&pool->num_of_sleeper, 1U);
+            (void)ezOsal_MutexUnlock(&pool->lock);
+        }
+    }
+
+    return is_claimed;
+}
+
+
+/*****************************************************************************
+* Function: ezTaskWorkerPool_FindTask
+*//**
+* @brief Take a claimed task, from the own queue first, then from the
+* other threads
+*
+* @details
+*
+* @param[in]    self: thread holding the claim
+* @param[out]   task_block: copy of the task block
+* @return       None
+*
+* @pre a task is claimed by ezTaskWorkerPool_ClaimTask
+* @post None
+*
+* \b Example
+* @code
+* @endcode
+*
+* @see None
+*
+*****************************************************************************/
+static void ezTaskWorkerPool_FindTask(struct ezTaskWorkerPoolThread *self, void *task_block)
+{
+    struct ezTaskWorkerPool *pool = self->pool;
+    struct ezTaskWorkerPoolThread *victim = NULL;
+    uint32_t self_index = (uint32_t)(self - pool->threads);
+    uint32_t i = 0;
+    bool is_found = false;
+
+    while (is_found == false)
+    {
+        victim = &pool->threads[(self_index + i) % pool->num_of_thread];
+        is_found = ezTaskWorkerPool_TakeTask(victim, (victim != self), task_block);
+        if (is_found == true && victim != self)
+        {
+            self->num_of_stolen_task++;
+        }
+        i = (i + 1U) % pool->num_of_thread;
+    }
+}
+
+
+/*****************************************************************************
+* Function: ezTaskWorkerPool_TakeTask
+*//**
+* @brief Copy a task out of the queue of a thread and remove it
+*
+* @details The owner takes the oldest task, a thief takes the newest one,
+* so they work on the opposite ends of the queue.
+*
+* @param[in]    thread: thread owning the queue
+* @param[in]    is_stealing: true if the caller is not the owner
+* @param[out]   task_block: copy of the task block
+* @return       true if a task is taken, false if the queue is empty
+*
+* @pre None
+* @post None
+*
+* \b Example
+* @code
+* @endcode
+*
+* @see None
+*
+*****************************************************************************/
+static bool ezTaskWorkerPool_TakeTask(struct ezTaskWorkerPoolThread *thread,
+                                      bool is_stealing,
+                                      void *task_block)
+{
+    bool is_taken = false;
+    void *data = NULL;
+    uint32_t data_size = 0;
+    ezSTATUS status = ezFAIL;
+
+    (void)ezOsal_MutexLock(&thread->lock);
+
+    if (is_stealing == true)
+    {
+        status = ezQueue_GetBack(&thread->task_queue, &data, &data_size);
+    }
+    else
+    {
+        status = ezQueue_GetFront(&thread->task_queue, &data, &data_size);
+    }
+
+    if (status == ezSUCCESS)
+    {
+        /* Enqueueing bounds the size to TASK_BLOCK_SIZE */
+        memcpy(task_block, data, data_size);
+        (void)((is_stealing == true) ? ezQueue_PopBack(&thread->task_queue)
+                                     : ezQueue_PopFront(&thread->task_queue));
+        is_taken = true;
+    }
+
+    (void)ezOsal_MutexUnlock(&thread->lock);
+
+    return is_taken;
+}
+
+#endif /* EZ_TASK_WORKER_POOL == 1 */
+
+/* End of file */
@@ -0,0 +1,277 @@
+/*****************************************************************************
+* Filename:         ez_task_worker_pool.h
+* Author:           Hai Nguyen
+* Original Date:    18.10.2026
+*
+* ----------------------------------------------------------------------------
+* Contact:          Hai Nguyen
+*                   hainguyen.eeit@gmail.com
+*
+* ----------------------------------------------------------------------------
+* License: This file is published under the license described in LICENSE.md
+*
+*****************************************************************************/
+
+/** @file   ez_task_worker_pool.h
+ *  @author Hai Nguyen
+ *  @date   18.10.2026
+ *  @brief  Public API of the task worker pool component
+ *
+ *  @details A pool of threads executing tasks of the same form as the ones
+ *  of ezTaskWorker. Every thread has its own task queue. A thread executes
+ *  the tasks of its queue from the front and, when its queue is empty,
+ *  steals from the back of the queues of the other threads, so a burst
+ *  sent to one thread is spread over the whole pool. Threads, mutexes and
+ *  condition variables come from the OS abstraction layer.
+ */
+
+#ifndef _EZ_TASK_WORKER_POOL_H
+#define _EZ_TASK_WORKER_POOL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*****************************************************************************
+* Includes
+*****************************************************************************/
+#if (EZ_BUILD_WITH_CMAKE == 0U)
+#include "ez_target_config.h"
+#endif
+
+#if (EZ_TASK_WORKER_POOL == 1)
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+#include "ez_queue.h"
+#include "ez_osal.h"
+#include "ez_task_worker.h"
+
+
+/*****************************************************************************
+* Component Preprocessor Macros
+*****************************************************************************/
+#ifndef CONFIG_EZ_TASK_WORKER_POOL_MAX_CONTEXT_SIZE
+#define CONFIG_EZ_TASK_WORKER_POOL_MAX_CONTEXT_SIZE     64U /**< Largest context of a task, in bytes */
+#endif
+
+
+/*****************************************************************************
+* Component Typedefs
+*****************************************************************************/
+struct ezTaskWorkerPool;
+
+/** @brief One thread of the pool and its task queue
+ */
+struct ezTaskWorkerPoolThread
+{
+    struct ezTaskWorkerPool *pool;  /**< Pool owning the thread */
+    ezOsalThread thread;            /**< OS thread */
+    ezOsalMutex lock;               /**< Protects task_queue */
+    ezQueue task_queue;             /**< Tasks enqueued to this thread */
+    uint32_t num_of_executed_task;  /**< Tasks executed by this thread, written by the thread only */
+    uint32_t num_of_stolen_task;    /**< Tasks stolen from the other threads, written by the thread only */
+};
+
+
+/** @brief Pool of task worker threads
+ */
+struct ezTaskWorkerPool
+{
+    struct ezTaskWorkerPoolThread *threads; /**< Threads of the pool */
+    uint32_t num_of_thread;                 /**< Number of threads */
+    ezOsalMutex lock;                       /**< Protects sleeping and exiting of the threads */
+    ezOsalCond task_avail;                  /**< Signaled when a task is enqueued and a thread sleeps */
+    ezOsalCond thread_exit;                 /**< Signaled when the last thread exits */
+    uint32_t num_of_running_thread;         /**< Threads not exited yet, protected by lock */
+    atomic_uint_least32_t num_of_task;      /**< Enqueued tasks not claimed by a thread yet */
+    atomic_uint_least32_t num_of_sleeper;   /**< Threads waiting for task_avail */
+    atomic_uint_least32_t next_thread;      /**< Round robin index of ezTaskWorkerPool_EnqueueTask */
+    atomic_uint_least32_t num_of_enqueuing; /**< Enqueue calls in progress, threads do not exit before they end */
+    atomic_bool is_stopping;                /**< Set by ezTaskWorkerPool_Stop */
+};
+
+
+/*****************************************************************************
+* Component Variable Definitions
+*****************************************************************************/
+/* None */
+
+/*****************************************************************************
+* Function Prototypes
+*****************************************************************************/
+
+/*****************************************************************************
+* Function: ezTaskWorkerPool_Create
+*//**
+* @brief Create a pool and start its threads
+*
+* @details queue_buffer is divided equally between the task queues of the
+* threads, stack_buffer holds one stack of stack_size bytes per thread.
+* The stacks are only used by the RTOS backends and can be NULL on POSIX.
+*
+* @param[in]    pool: pool to be created
+* @param[in]    threads: array of num_of_thread threads
+* @param[in]    num_of_thread: number of threads
+* @param[in]    queue_buffer: buffer of the task queues
+* @param[in]    queue_buffer_size: size of queue_buffer
+* @param[in]    stack_buffer: stacks of the threads
+* @param[in]    stack_size: size of the stack of one thread
+* @param[in]    priority: priority of the threads
+* @return       true if success, otherwise false
+*
+* @pre None
+* @post None
+*
+* \b Example
+* @code
+* static struct ezTaskWorkerPool pool;
+* static struct ezTaskWorkerPoolThread threads[4];
+* static uint8_t queue_buff[4 * 256];
+*
+* ezTaskWorkerPool_Create(&pool, threads, 4, queue_buff, sizeof(queue_buff), NULL, 0, 0);
+* @endcode
+*
+* @see ezTaskWorkerPool_Stop
+*
+*****************************************************************************/
+bool ezTaskWorkerPool_Create(struct ezTaskWorkerPool *pool,
+                             struct ezTaskWorkerPoolThread *threads,
+                             uint32_t num_of_thread,
+                             uint8_t *queue_buffer,
+                             uint32_t queue_buffer_size,
+                             uint8_t *stack_buffer,
+                             uint32_t stack_size,
+                             uint32_t priority);
+
+
+/*****************************************************************************
+* Function: ezTaskWorkerPool_EnqueueTask
+*//**
+* @brief Enqueue a task to the pool
+*
+* @details The threads are chosen in turn. If the queue of a thread is
+* full, the next one is tried. The context is copied.
+*
+* @param[in]    pool: pool that will execute the task
+* @param[in]    task: task function
+* @param[in]    callback: callback to return the result of the task
+* @param[in]    context: context data of the task function
+* @param[in]    context_size: size of the context, at most
+*               CONFIG_EZ_TASK_WORKER_POOL_MAX_CONTEXT_SIZE
+* @return       true if success, false if all queues are full or the pool
+*               is stopping
+*
+* @pre pool is created by ezTaskWorkerPool_Create
+* @post None
+*
+* \b Example
+* @code
+* struct Context context;
+* ezTaskWorkerPool_EnqueueTask(&pool, worker_task, callback, &context, sizeof(context));
+* @endcode
+*
+* @see ezTaskWorker_EnqueueTask
+*
+*****************************************************************************/
+bool ezTaskWorkerPool_EnqueueTask(struct ezTaskWorkerPool *pool,
+                                  ezTaskWorkerTaskFunc task,
+                                  ezTaskWorkerCallbackFunc callback,
+                                  void *context,
+                                  uint32_t context_size);
+
+
+/*****************************************************************************
+* Function: ezTaskWorkerPool_EnqueueTaskTo
+*//**
+* @brief Enqueue a task to the queue of a given thread
+*
+* @details Useful to keep related tasks on the same thread. The task can
+* still be stolen by another thread when that one runs out of work.
+*
+* @param[in]    pool: pool that will execute the task
+* @param[in]    thread_index: index of the thread in the pool
+* @param[in]    task: task function
+* @param[in]    callback: callback to return the result of the task
+* @param[in]    context: context data of the task function
+* @param[in]    context_size: size of the context
+* @return       true if success, otherwise false
+*
+* @pre pool is created by ezTaskWorkerPool_Create
+* @post None
+*
+* \b Example
+* @code
+* ezTaskWorkerPool_EnqueueTaskTo(&pool, 0, worker_task, callback, &context, sizeof(context));
+* @endcode
+*
+* @see ezTaskWorkerPool_EnqueueTask
+*
+*****************************************************************************/
+bool ezTaskWorkerPool_EnqueueTaskTo(struct ezTaskWorkerPool *pool,
+                                    uint32_t thread_index,
+                                    ezTaskWorkerTaskFunc task,
+                                    ezTaskWorkerCallbackFunc callback,
+                                    void *context,
+                                    uint32_t context_size);
+
+
+/*****************************************************************************
+* Function: ezTaskWorkerPool_GetNumOfPendingTask
+*//**
+* @brief Return the number of enqueued tasks that no thread started yet
+*
+* @details
+*
+* @param[in]    pool: pool
+* @return       number of tasks
+*
+* @pre None
+* @post None
+*
+* \b Example
+* @code
+* while (ezTaskWorkerPool_GetNumOfPendingTask(&pool) > 0) {}
+* @endcode
+*
+* @see None
+*
+*****************************************************************************/
+uint32_t ezTaskWorkerPool_GetNumOfPendingTask(struct ezTaskWorkerPool *pool);
+
+
+/*****************************************************************************
+* Function: ezTaskWorkerPool_Stop
+*//**
+* @brief Stop the pool
+*
+* @details New tasks are rejected. The threads execute the tasks already
+* enqueued, then exit. A task enqueued while the pool stops is either
+* rejected or executed. The function returns when all threads have exited.
+*
+* @param[in]    pool: pool to be stopped
+* @return       None
+*
+* @pre pool is created by ezTaskWorkerPool_Create
+* @post None
+*
+* \b Example
+* @code
+* ezTaskWorkerPool_Stop(&pool);
+* @endcode
+*
+* @see ezTaskWorkerPool_Create
+*
+*****************************************************************************/
+void ezTaskWorkerPool_Stop(struct ezTaskWorkerPool *pool);
+
+#endif /* EZ_TASK_WORKER_POOL == 1 */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _EZ_TASK_WORKER_POOL_H */
+
+
+/* End of file */
@@ -0,0 +1,380 @@
+/*****************************************************************************
+* Filename:         ez_hash_table.c
+* Author:           Hai Nguyen
+* Original Date:    18.10.2026
+*
+* ----------------------------------------------------------------------------
+* Contact:          Hai Nguyen
+*                   hainguyen.eeit@gmail.com
+*
+* ----------------------------------------------------------------------------
+* License: This file is published under the license described in LICENSE.md
+*
+*****************************************************************************/
+
+/** @file   ez_hash_table.c
+ *  @author Hai Nguyen
+ *  @date   18.10.2026
+ *  @brief  Implementation of the hash table
+ *
+ *  @details A node sits in the first empty slot at or after its home slot
+ *  (hash & mask). There is no empty slot between the home slot of a node
+ *  and the node itself, which is what removal preserves when it shifts the
+ *  following nodes back.
+ */
+
+
+/*****************************************************************************
+* Includes
+*****************************************************************************/
+#include "ez_hash_table.h"
+
+#if (EZ_HASH_TABLE == 1U)
+#include <string.h>
+
+
+/*****************************************************************************
+* Component Preprocessor Macros
+*****************************************************************************/
+#define FNV_OFFSET_BASIS    2166136261UL
+#define FNV_PRIME           16777619UL
+
+
+/*****************************************************************************
+* Component Typedefs
+*****************************************************************************/
+/* None */
+
+
+/*****************************************************************************
+* Component Variable Definitions
+*****************************************************************************/
+/* None */
+
+
+/*****************************************************************************
+* Function Definitions
+*****************************************************************************/
+static uint32_t ezHashTable_HashInteger(uint32_t key);
+static uint32_t ezHashTable_HashString(const char *key);
+static bool ezHashTable_Insert(struct ezHashTable *table, struct ezHashNode *node);
+static bool ezHashTable_IsKeyEqual(struct ezHashTable *table,
+                                   const struct ezHashNode *a,
+                                   const struct ezHashNode *b);
+
+
+/*****************************************************************************
+* External functions
+*****************************************************************************/
+bool ezHashTable_Init(struct ezHashTable *table,
+                      struct ezHashNode **slots,
+                      uint32_t num_of_slot,
+                      ezHashKeyType key_type)
+{
+    bool is_success = false;
+
+    if (table != NULL && slots != NULL && num_of_slot >= 2U
+        && (key_type == EZ_HASH_KEY_INTEGER || key_type == EZ_HASH_KEY_STRING))
+    {
+        /* Round down to a power of two */
+        while ((num_of_slot & (num_of_slot - 1U)) != 0U)
+        {
+            num_of_slot &= num_of_slot - 1U;
+        }
+
+        memset(slots, 0, num_of_slot * sizeof(struct ezHashNode*));
+        table->slots = slots;
+        table->mask = num_of_slot - 1U;
+        table->num_of_node = 0;
+        table->key_type = key_type;
+        is_success = true;
+    }
+
+    return is_success;
+}
+
+
+bool ezHashTable_InsertInteger(struct ezHashTable *table,
+                               struct ezHashNode *node,
+                               uint32_t key)
+{
+    bool is_success = false;
+
+    if (table != NULL && node != NULL && table->key_type == EZ_HASH_KEY_INTEGER)
+    {
+        node->key.integer = key;
+        node->hash = ezHashTable_HashInteger(key);
+        is_success = ezHashTable_Insert(table, node);
+    }
+
+    return is_success;
+}
+
+
+bool ezHashTable_InsertString(struct ezHashTable *table,
+                              struct ezHashNode *node,
+                              const char *key)
+{
+    bool is_success = false;
+
+    if (table != NULL && node != NULL && key != NULL && table->key_type == EZ_HASH_KEY_STRING)
+    {
+        node->key.string = key;
+        node->hash = ezHashTable_HashString(key);
+        is_success = ezHashTable_Insert(table, node);
+    }
+
+    return is_success;
+}
+
+
+struct ezHashNode *ezHashTable_FindInteger(struct ezHashTable *table, uint32_t key)
+{
+    struct ezHashNode *found_node = NULL;
+    struct ezHashNode *slot_node = NULL;
+    uint32_t hash = 0;
+    uint32_t i = 0;
+
+    if (table != NULL && table->key_type == EZ_HASH_KEY_INTEGER)
+    {
+        hash = ezHashTable_HashInteger(key);
+        for (i = hash & table->mask; (slot_node = table->slots[i]) != NULL; i = (i + 1U) & table->mask)
+        {
+            if (slot_node->hash == hash && slot_node->key.integer == key)
+            {
+                found_node = slot_node;
+                break;
+            }
+        }
+    }
+
+    return found_node;
+}
+
+
+struct ezHashNode *ezHashTable_FindString(struct ezHashTable *table, const char *key)
+{
+    struct ezHashNode *found_node = NULL;
+    struct ezHashNode *slot_node = NULL;
+    uint32_t hash = 0;
+    uint32_t i = 0;
+
+    if (table != NULL && key != NULL && table->key_type == EZ_HASH_KEY_STRING)
+    {
+        hash = ezHashTable_HashString(key);
+        for (i = hash & table->mask; (slot_node = table->slots[i]) != NULL; i = (i + 1U) & table->mask)
+        {
+            if (slot_node->hash == hash && strcmp(slot_node->key.string, key) == 0)
+            {
+                found_node = slot_node;
+                break;
+            }
+        }
+    }
+
+    return found_node;
+}
+
+
+bool ezHashTable_Remove(struct ezHashTable *table, struct ezHashNode *node)
+{
+    bool is_success = false;
+    uint32_t hole = 0;
+    uint32_t i = 0;
+    uint32_t home = 0;
+
+    if (table != NULL && node != NULL)
+    {
+        for (hole = node->hash & table->mask; table->slots[hole] != NULL; hole = (hole + 1U) & table->mask)
+        {
+            if (table->slots[hole] == node)
+            {
+                is_success = true;
+                break;
+            }
+        }
+    }
+
+    if (is_success == true)
+    {
+        /* Move back every following node whose home slot is not between
+         * the hole and the node, so it stays reachable from its home slot */
+        i = hole;
+        while (true)
+        {
+            i = (i + 1U) & table->mask;
+            if (table->slots[i] == NULL)
+            {
+                break;
+            }
+
+            home = table->slots[i]->hash & table->mask;
+            if (((i - home) & table->mask) >= ((i - hole) & table->mask))
+            {
+                table->slots[hole] = table->slots[i];
+                hole = i;
+            }
+        }
+
+        table->slots[hole] = NULL;
+        table->num_of_node--;
+    }
+
+    return is_success;
+}
+
+
+uint32_t ezHashTable_GetNumOfNode(struct ezHashTable *table)
+{
+    uint32_t num_of_node = 0;
+
+    if (table != NULL)
+    {
+        num_of_node = table->num_of_node;
+    }
+
+    return num_of_node;
+}
+
+
+/*****************************************************************************
+* Local functions
+*****************************************************************************/
+
+/*****************************************************************************
+* Function : ezHashTable_Insert
+*//**
+* @brief Insert a node whose key and hash are set
+*
+* @details
+*
+* @param    table: (IN)pointer to the table
+* @param    node: (IN)node to insert
+* @return   true if success, false if the key exists or the table is full
+*
+* @pre None
+* @post None
+*
+*****************************************************************************/
+static bool ezHashTable_Insert(struct ezHashTable *table, struct ezHashNode *node)
+{
+    bool is_success = false;
+    uint32_t i = 0;
+
+    /* Keep one empty slot so a probe sequence always ends */
+    if (table->num_of_node < table->mask)
+    {
+        for (i = node->hash & table->mask; table->slots[i] != NULL; i = (i + 1U) & table->mask)
+        {
+            if (table->slots[i]->hash == node->hash
+                && ezHashTable_IsKeyEqual(table, table->slots[i], node) == true)
+            {
+                break;
+            }
+        }
+
+        if (table->slots[i] == NULL)
+        {
+            table->slots[i] = node;
+            table->num_of_node++;
+            is_success = true;
+        }
+    }
+
+    return is_success;
+}
+
+
+/*****************************************************************************
+* Function : ezHashTable_IsKeyEqual
+*//**
+* @brief Compare the keys of two nodes
+*
+* @details
+*
+* @param    table: (IN)pointer to the table, for the type of the keys
+* @param    a: (IN)first node
+* @param    b: (IN)second node
+* @return   true if the keys are equal
+*
+* @pre None
+* @post None
+*
+*****************************************************************************/
+static bool ezHashTable_IsKeyEqual(struct ezHashTable *table,
+                                   const struct ezHashNode *a,
+                                   const struct ezHashNode *b)
+{
+    bool is_equal = false;
+
+    if (table->key_type == EZ_HASH_KEY_INTEGER)
+    {
+        is_equal = (a->key.integer == b->key.integer);
+    }
+    else
+    {
+        is_equal = (strcmp(a->key.string, b->key.string) == 0);
+    }
+
+    return is_equal;
+}
+
+
+/*****************************************************************************
+* Function : ezHashTable_HashInteger
+*//**
+* @brief Hash an integer key
+*
+* @details Finalizer of MurmurHash3, so consecutive keys such as tags and
+* ids spread over the whole table
+*
+* @param    key: (IN)key
+* @return   hash
+*
+* @pre None
+* @post None
+*
+*****************************************************************************/
+static uint32_t ezHashTable_HashInteger(uint32_t key)
+{
+    key ^= key >> 16;
+    key *= 0x85EBCA6BUL;
+    key ^= key >> 13;
+    key *= 0xC2B2AE35UL;
+    key ^= key >> 16;
+
+    return key;
+}
+
+
+/*****************************************************************************
+* Function : ezHashTable_HashString
+*//**
+* @brief Hash a string key
+*
+* @details 32-bit FNV-1a
+*
+* @param    key: (IN)null-terminated key
+* @return   hash
+*
+* @pre None
+* @post None
+*
+*****************************************************************************/
+static uint32_t ezHashTable_HashString(const char *key)
+{
+    uint32_t hash = FNV_OFFSET_BASIS;
+
+    while (*key != '\0')
+    {
+        hash ^= (uint8_t)*key;
+        hash *= FNV_PRIME;
+        key++;
+    }
+
+    return hash;
+}
+
+#endif /* EZ_HASH_TABLE == 1U */
+
+/* End of file */
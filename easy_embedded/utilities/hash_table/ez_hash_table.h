@@ -0,0 +1,288 @@
+/*****************************************************************************
+* Filename:         ez_hash_table.h
+* Author:           Hai Nguyen
+* Original Date:    18.10.2026
+*
+* ----------------------------------------------------------------------------
+* Contact:          Hai Nguyen
+*                   hainguyen.eeit@gmail.com
+*
+* ----------------------------------------------------------------------------
+* License: This file is published under the license described in LICENSE.md
+*
+*****************************************************************************/
+
+/** @file   ez_hash_table.h
+ *  @author Hai Nguyen
+ *  @date   18.10.2026
+ *  @brief  Public functions of the hash table component
+ *
+ *  @details Intrusive hash table with open addressing (linear probing). A
+ *  struct ezHashNode is embedded in the user's data structure and the
+ *  table is an array of node pointers owned by the caller, so nothing is
+ *  allocated. A table is keyed either by integers or by strings. String
+ *  keys are not copied and must live as long as the node is in the table.
+ *  Removal shifts the following entries back instead of leaving
+ *  tombstones, so lookups do not degrade over time.
+ */
+
+#ifndef _EZ_HASH_TABLE_H
+#define _EZ_HASH_TABLE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*****************************************************************************
+* Includes
+*****************************************************************************/
+#if (EZ_BUILD_WITH_CMAKE == 0U)
+#include "ez_target_config.h"
+#endif
+
+#if (EZ_HASH_TABLE == 1U)
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+
+/*****************************************************************************
+* Component Preprocessor Macros
+*****************************************************************************/
+
+/*@brief Get the parent of the data structure, where the node is embedded
+ *
+ */
+#define EZ_HASH_TABLE_GET_PARENT_OF(ptr, member, type) \
+    ((type*)((char*)(ptr) - offsetof(type, member)))
+
+/*@brief Static initializer of an empty table, instead of ezHashTable_Init.
+ * slots is a zero-initialized array whose size is a power of two
+ */
+#define EZ_HASH_TABLE_INIT(slots, key_type) \
+    {(slots), (uint32_t)(sizeof(slots) / sizeof((slots)[0])) - 1U, 0U, (key_type)}
+
+
+/*****************************************************************************
+* Component Typedefs
+*****************************************************************************/
+
+/** @brief Type of the keys of a table
+ */
+typedef enum
+{
+    EZ_HASH_KEY_INTEGER,    /**< uint32_t keys */
+    EZ_HASH_KEY_STRING,     /**< null-terminated string keys */
+}ezHashKeyType;
+
+
+/** @brief Node of the hash table, embedded in the user's data structure
+ */
+struct ezHashNode
+{
+    union
+    {
+        uint32_t integer;       /**< Key of an integer table */
+        const char *string;     /**< Key of a string table, not copied */
+    } key;
+    uint32_t hash;              /**< Cached hash of the key */
+};
+
+
+/** @brief Hash table
+ */
+struct ezHashTable
+{
+    struct ezHashNode **slots;  /**< Slots, owned by the caller */
+    uint32_t mask;              /**< Number of slots - 1 */
+    uint32_t num_of_node;       /**< Number of nodes in the table */
+    ezHashKeyType key_type;     /**< Type of the keys */
+};
+
+
+/*****************************************************************************
+* Component Variable Definitions
+*****************************************************************************/
+/* None */
+
+
+/*****************************************************************************
+* Function Prototypes
+*****************************************************************************/
+
+/*****************************************************************************
+* Function : ezHashTable_Init
+*//**
+* @brief Initialize an empty hash table
+*
+* @details The number of slots is rounded down to a power of two. One slot
+* always stays empty, so a table of n slots holds up to n - 1 nodes. Keep
+* the load under 75% for short probe sequences.
+*
+* @param    table: (IN)pointer to the table
+* @param    slots: (IN)array of node pointers used as slots
+* @param    num_of_slot: (IN)number of elements of slots, at least 2
+* @param    key_type: (IN)type of the keys
+* @return   true if success, else false
+*
+* @pre None
+* @post None
+*
+* @code
+* static struct ezHashNode *cmd_slots[64];
+* static struct ezHashTable cmd_table;
+* ezHashTable_Init(&cmd_table, cmd_slots, 64, EZ_HASH_KEY_STRING);
+* @endcode
+*
+*****************************************************************************/
+bool ezHashTable_Init(struct ezHashTable *table,
+                      struct ezHashNode **slots,
+                      uint32_t num_of_slot,
+                      ezHashKeyType key_type);
+
+
+/*****************************************************************************
+* Function : ezHashTable_InsertInteger
+*//**
+* @brief Insert a node with an integer key
+*
+* @details
+*
+* @param    table: (IN)pointer to an integer table
+* @param    node: (IN)node to insert
+* @param    key: (IN)key of the node
+* @return   true if success, false if the key exists or the table is full
+*
+* @pre None
+* @post None
+*
+* @code
+* ezHashTable_InsertInteger(&service_table, &service->hash_node, service->tag);
+* @endcode
+*
+*****************************************************************************/
+bool ezHashTable_InsertInteger(struct ezHashTable *table,
+                               struct ezHashNode *node,
+                               uint32_t key);
+
+
+/*****************************************************************************
+* Function : ezHashTable_InsertString
+*//**
+* @brief Insert a node with a string key
+*
+* @details
+*
+* @param    table: (IN)pointer to a string table
+* @param    node: (IN)node to insert
+* @param    key: (IN)key of the node, must outlive the node in the table
+* @return   true if success, false if the key exists or the table is full
+*
+* @pre None
+* @post None
+*
+* @code
+* ezHashTable_InsertString(&cmd_table, &cmd->hash_node, cmd->name);
+* @endcode
+*
+*****************************************************************************/
+bool ezHashTable_InsertString(struct ezHashTable *table,
+                              struct ezHashNode *node,
+                              const char *key);
+
+
+/*****************************************************************************
+* Function : ezHashTable_FindInteger
+*//**
+* @brief Find the node of an integer key
+*
+* @details
+*
+* @param    table: (IN)pointer to an integer table
+* @param    key: (IN)key to look up
+* @return   pointer to the node or NULL if not found
+*
+* @pre None
+* @post None
+*
+* @code
+* struct ezHashNode *node = ezHashTable_FindInteger(&service_table, tag);
+* @endcode
+*
+*****************************************************************************/
+struct ezHashNode *ezHashTable_FindInteger(struct ezHashTable *table, uint32_t key);
+
+
+/*****************************************************************************
+* Function : ezHashTable_FindString
+*//**
+* @brief Find the node of a string key
+*
+* @details
+*
+* @param    table: (IN)pointer to a string table
+* @param    key: (IN)key to look up
+* @return   pointer to the node or NULL if not found
+*
+* @pre None
+* @post None
+*
+* @code
+* struct ezHashNode *node = ezHashTable_FindString(&cmd_table, "help");
+* @endcode
+*
+*****************************************************************************/
+struct ezHashNode *ezHashTable_FindString(struct ezHashTable *table, const char *key);
+
+
+/*****************************************************************************
+* Function : ezHashTable_Remove
+*//**
+* @brief Remove a node from the table
+*
+* @details
+*
+* @param    table: (IN)pointer to the table
+* @param    node: (IN)node to remove
+* @return   true if success, false if the node is not in the table
+*
+* @pre None
+* @post None
+*
+* @code
+* ezHashTable_Remove(&cmd_table, &cmd->hash_node);
+* @endcode
+*
+*****************************************************************************/
+bool ezHashTable_Remove(struct ezHashTable *table, struct ezHashNode *node);
+
+
+/*****************************************************************************
+* Function : ezHashTable_GetNumOfNode
+*//**
+* @brief Return the number of nodes in the table
+*
+* @details
+*
+* @param    table: (IN)pointer to the table
+* @return   number of nodes
+*
+* @pre None
+* @post None
+*
+* @code
+* uint32_t num_of_cmd = ezHashTable_GetNumOfNode(&cmd_table);
+* @endcode
+*
+*****************************************************************************/
+uint32_t ezHashTable_GetNumOfNode(struct ezHashTable *table);
+
+#endif /* EZ_HASH_TABLE == 1U */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _EZ_HASH_TABLE_H */
+
+/* End of file */
@@ -147,6 +147,138 @@ bool ezLinkedList_IsNodeInList(struct Node* head, struct Node* searched_node)
 }
 
 
+bool ezLinkedList_InsertSorted(struct Node *list_head,
+                               struct Node *new_node,
+                               ezLinkedList_LessFunc less)
+{
+    bool is_success = false;
+    struct Node *it_node = NULL;
+
+    if (list_head != NULL && new_node != NULL && less != NULL)
+    {
+        EZ_LINKEDLIST_FOR_EACH(it_node, list_head)
+        {
+            if (less(new_node, it_node) == true)
+            {
+                break;
+            }
+        }
+
+        /* it_node is the first greater node, or the head at the end */
+        is_success = ezLinkedList_AppendNode(new_node, it_node->prev);
+    }
+
+    return is_success;
+}
+
+
+void ezLinkedList_SpliceTail(struct Node *to_list_head, struct Node *from_list_head)
+{
+    if (to_list_head != NULL && from_list_head != NULL && !IS_LIST_EMPTY(from_list_head))
+    {
+        from_list_head->next->prev = to_list_head->prev;
+        to_list_head->prev->next = from_list_head->next;
+        from_list_head->prev->next = to_list_head;
+        to_list_head->prev = from_list_head->prev;
+
+        ezLinkedList_InitNode(from_list_head);
+    }
+}
+
+
+void ezLinkedList_MergeSorted(struct Node *to_list_head,
+                              struct Node *from_list_head,
+                              ezLinkedList_LessFunc less)
+{
+    struct Node *it_node = NULL;
+    struct Node *merged_node = NULL;
+
+    if (to_list_head != NULL && from_list_head != NULL && less != NULL)
+    {
+        it_node = to_list_head->next;
+        while (!IS_LIST_EMPTY(from_list_head) && it_node != to_list_head)
+        {
+            merged_node = from_list_head->next;
+            if (less(merged_node, it_node) == true)
+            {
+                EZ_LINKEDLIST_UNLINK_NODE(merged_node);
+                (void)ezLinkedList_AppendNode(merged_node, it_node->prev);
+            }
+            else
+            {
+                it_node = it_node->next;
+            }
+        }
+
+        /* The rest is greater than any node of to_list_head */
+        ezLinkedList_SpliceTail(to_list_head, from_list_head);
+    }
+}
+
+
+void ezLinkedList_InitCountedList(struct ezCountedList *list)
+{
+    ezLinkedList_InitNode(&list->head);
+    list->size = 0;
+}
+
+
+bool ezLinkedList_CountedAddHead(struct ezCountedList *list, struct Node *node)
+{
+    bool is_success = false;
+
+    if (list != NULL && ezLinkedList_AppendNode(node, &list->head) == true)
+    {
+        list->size++;
+        is_success = true;
+    }
+
+    return is_success;
+}
+
+
+bool ezLinkedList_CountedAddTail(struct ezCountedList *list, struct Node *node)
+{
+    bool is_success = false;
+
+    if (list != NULL && ezLinkedList_AppendNode(node, list->head.prev) == true)
+    {
+        list->size++;
+        is_success = true;
+    }
+
+    return is_success;
+}
+
+
+bool ezLinkedList_CountedUnlink(struct ezCountedList *list, struct Node *node)
+{
+    bool is_success = false;
+
+    if (list != NULL && node != NULL && node != &list->head && list->size > 0)
+    {
+        EZ_LINKEDLIST_UNLINK_NODE(node);
+        list->size--;
+        is_success = true;
+    }
+
+    return is_success;
+}
+
+
+uint32_t ezLinkedList_GetCountedListSize(struct ezCountedList *list)
+{
+    uint32_t size = 0;
+
+    if (list != NULL)
+    {
+        size = list->size;
+    }
+
+    return size;
+}
+
+
 
 #if 0
 Node* ezmLL_GetFreeNode(void)
@@ -109,6 +109,22 @@ struct Node
 };
 
 
+/** @brief List head which keeps track of the number of nodes, so the size
+ *  is known in O(1). Nodes must be added and removed with the
+ *  ezLinkedList_Counted* functions only.
+ */
+struct ezCountedList
+{
+    struct Node head;   /**< head of the list */
+    uint32_t size;      /**< number of nodes in the list */
+};
+
+
+/** @brief Return true if node a must be placed before node b
+ */
+typedef bool (*ezLinkedList_LessFunc)(const struct Node *a, const struct Node *b);
+
+
 /*****************************************************************************
 * Component Variable Definitions
 *****************************************************************************/
@@ -264,6 +280,190 @@ struct Node *ezLinkedList_UnlinkCurrentHead(struct Node *head);
 *****************************************************************************/
 bool ezLinkedList_IsNodeInList(struct Node *head, struct Node *searched_node);
 
+
+/*****************************************************************************
+* Function : ezLinkedList_InsertSorted
+*//** 
+* @brief Insert a node into a sorted list, keeping it sorted
+*
+* @details The node is placed before the first node which is greater than
+* it, so nodes with equal keys keep their insertion order. O(n).
+*
+* @param    list_head: (IN)pointer to the head of the sorted list
+* @param    new_node: (IN)node to be inserted
+* @param    less: (IN)order of the nodes
+* @return   true if success, else false
+*
+* @pre None
+* @post None
+*
+* @code
+* ezLinkedList_InsertSorted(&timer_list, &timer->node, IsTimerEarlier);
+* @endcode
+*
+*****************************************************************************/
+bool ezLinkedList_InsertSorted(struct Node *list_head,
+                               struct Node *new_node,
+                               ezLinkedList_LessFunc less);
+
+
+/*****************************************************************************
+* Function : ezLinkedList_SpliceTail
+*//** 
+* @brief Move all nodes of a list to the tail of another list
+*
+* @details O(1). from_list_head is empty afterward.
+*
+* @param    to_list_head: (IN)pointer to the head of the receiving list
+* @param    from_list_head: (IN)pointer to the head of the list to be moved
+* @return   None
+*
+* @pre None
+* @post None
+*
+* @code
+* ezLinkedList_SpliceTail(&ready_list, &pending_list);
+* @endcode
+*
+*****************************************************************************/
+void ezLinkedList_SpliceTail(struct Node *to_list_head, struct Node *from_list_head);
+
+
+/*****************************************************************************
+* Function : ezLinkedList_MergeSorted
+*//** 
+* @brief Merge a sorted list into another sorted list
+*
+* @details O(n + m). On equal keys the nodes of to_list_head come first.
+* from_list_head is empty afterward.
+*
+* @param    to_list_head: (IN)pointer to the head of the receiving list
+* @param    from_list_head: (IN)pointer to the head of the list to be merged
+* @param    less: (IN)order of the nodes
+* @return   None
+*
+* @pre Both lists are sorted with less
+* @post None
+*
+* @code
+* ezLinkedList_MergeSorted(&timer_list, &new_timer_list, IsTimerEarlier);
+* @endcode
+*
+*****************************************************************************/
+void ezLinkedList_MergeSorted(struct Node *to_list_head,
+                              struct Node *from_list_head,
+                              ezLinkedList_LessFunc less);
+
+
+/*****************************************************************************
+* Function : ezLinkedList_InitCountedList
+*//** 
+* @brief Initialize an empty counted list
+*
+* @details
+*
+* @param    list: (IN)pointer to the counted list
+* @return   None
+*
+* @pre None
+* @post None
+*
+* @code
+* struct ezCountedList list;
+* ezLinkedList_InitCountedList(&list);
+* @endcode
+*
+*****************************************************************************/
+void ezLinkedList_InitCountedList(struct ezCountedList *list);
+
+
+/*****************************************************************************
+* Function : ezLinkedList_CountedAddHead
+*//** 
+* @brief Insert a node at the head of a counted list
+*
+* @details
+*
+* @param    list: (IN)pointer to the counted list
+* @param    node: (IN)node to be inserted
+* @return   true if success, else false
+*
+* @pre None
+* @post None
+*
+* @code
+* ezLinkedList_CountedAddHead(&list, &new_node);
+* @endcode
+*
+*****************************************************************************/
+bool ezLinkedList_CountedAddHead(struct ezCountedList *list, struct Node *node);
+
+
+/*****************************************************************************
+* Function : ezLinkedList_CountedAddTail
+*//** 
+* @brief Insert a node at the tail of a counted list
+*
+* @details
+*
+* @param    list: (IN)pointer to the counted list
+* @param    node: (IN)node to be inserted
+* @return   true if success, else false
+*
+* @pre None
+* @post None
+*
+* @code
+* ezLinkedList_CountedAddTail(&list, &new_node);
+* @endcode
+*
+*****************************************************************************/
+bool ezLinkedList_CountedAddTail(struct ezCountedList *list, struct Node *node);
+
+
+/*****************************************************************************
+* Function : ezLinkedList_CountedUnlink
+*//** 
+* @brief Unlink a node from a counted list
+*
+* @details The caller guarantees that the node is in the list, it is not
+* searched.
+*
+* @param    list: (IN)pointer to the counted list
+* @param    node: (IN)node to be unlinked
+* @return   true if success, else false
+*
+* @pre node is in list
+* @post node is initialized
+*
+* @code
+* ezLinkedList_CountedUnlink(&list, &node);
+* @endcode
+*
+*****************************************************************************/
+bool ezLinkedList_CountedUnlink(struct ezCountedList *list, struct Node *node);
+
+
+/*****************************************************************************
+* Function : ezLinkedList_GetCountedListSize
+*//** 
+* @brief Return number of node in a counted list, O(1)
+*
+* @details
+*
+* @param    list: (IN)pointer to the counted list
+* @return   number of node
+*
+* @pre None
+* @post None
+*
+* @code
+* uint32_t size = ezLinkedList_GetCountedListSize(&list);
+* @endcode
+*
+*****************************************************************************/
+uint32_t ezLinkedList_GetCountedListSize(struct ezCountedList *list);
+
 #ifdef __cplusplus
 }
 #endif
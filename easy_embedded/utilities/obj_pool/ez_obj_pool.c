@@ -0,0 +1,158 @@
+/*****************************************************************************
+* Filename:         ez_obj_pool.c
+* Author:           Hai Nguyen
+* Original Date:    18.10.2026
+*
+* ----------------------------------------------------------------------------
+* Contact:          Hai Nguyen
+*                   hainguyen.eeit@gmail.com
+*
+* ----------------------------------------------------------------------------
+* License: This file is published under the license described in LICENSE.md
+*
+*****************************************************************************/
+
+
+/** @file   ez_obj_pool.c
+ *  @author Hai Nguyen
+ *  @date   18.10.2026
+ *  @brief  Implementation of the fixed-size object pool
+ *
+ *  @details
+ */
+
+/*****************************************************************************
+* Includes
+*****************************************************************************/
+#include "ez_obj_pool.h"
+
+#if (EZ_OBJ_POOL == 1U)
+#include <stddef.h>
+
+
+/*****************************************************************************
+* Component Preprocessor Macros
+*****************************************************************************/
+#define SLOT_ALIGN_UP(x)    (((x) + (sizeof(void*) - 1U)) & ~(uint32_t)(sizeof(void*) - 1U))
+
+
+/*****************************************************************************
+* Component Typedefs
+*****************************************************************************/
+/* None */
+
+
+/*****************************************************************************
+* Component Variable Definitions
+*****************************************************************************/
+/* None */
+
+
+/*****************************************************************************
+* Function Definitions
+*****************************************************************************/
+/* None */
+
+
+/*****************************************************************************
+* Public functions
+*****************************************************************************/
+bool ezObjPool_Init(ezObjPool *pool, void *buff, uint32_t slot_size, uint32_t num_of_slot)
+{
+    bool is_success = false;
+
+    if (pool != NULL && buff != NULL && slot_size >= sizeof(void*) && num_of_slot > 0U)
+    {
+        pool->buff = (uint8_t*)buff;
+        pool->slot_size = SLOT_ALIGN_UP(slot_size);
+        pool->num_of_slot = num_of_slot;
+        pool->num_of_used_slot = 0U;
+        pool->num_of_alloc_obj = 0U;
+        pool->free_list = NULL;
+        is_success = true;
+    }
+
+    return is_success;
+}
+
+
+void *ezObjPool_Alloc(ezObjPool *pool)
+{
+    void *obj = NULL;
+
+    if (pool != NULL)
+    {
+        if (pool->free_list != NULL)
+        {
+            obj = pool->free_list;
+            pool->free_list = *(void**)obj;
+        }
+        else if (pool->num_of_used_slot < pool->num_of_slot)
+        {
+            obj = pool->buff + (size_t)pool->num_of_used_slot * pool->slot_size;
+            pool->num_of_used_slot++;
+        }
+        else
+        {
+            /* pool is empty */
+        }
+
+        if (obj != NULL)
+        {
+            pool->num_of_alloc_obj++;
+        }
+    }
+
+    return obj;
+}
+
+
+bool ezObjPool_Free(ezObjPool *pool, void *obj)
+{
+    bool is_success = false;
+
+    if (ezObjPool_IsOwner(pool, obj) == true && pool->num_of_alloc_obj > 0U)
+    {
+        *(void**)obj = pool->free_list;
+        pool->free_list = obj;
+        pool->num_of_alloc_obj--;
+        is_success = true;
+    }
+
+    return is_success;
+}
+
+
+bool ezObjPool_IsOwner(ezObjPool *pool, void *obj)
+{
+    bool is_owner = false;
+    size_t offset = 0U;
+
+    if (pool != NULL && obj != NULL && (uint8_t*)obj >= pool->buff)
+    {
+        offset = (size_t)((uint8_t*)obj - pool->buff);
+        if (offset < (size_t)pool->num_of_used_slot * pool->slot_size
+            && (offset % pool->slot_size) == 0U)
+        {
+            is_owner = true;
+        }
+    }
+
+    return is_owner;
+}
+
+
+uint32_t ezObjPool_GetNumOfFreeObj(ezObjPool *pool)
+{
+    uint32_t num_of_free = 0U;
+
+    if (pool != NULL)
+    {
+        num_of_free = pool->num_of_slot - pool->num_of_alloc_obj;
+    }
+
+    return num_of_free;
+}
+
+#endif /* EZ_OBJ_POOL == 1U */
+/* End of file */
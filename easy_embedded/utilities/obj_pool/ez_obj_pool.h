@@ -0,0 +1,236 @@
+/*****************************************************************************
+* Filename:         ez_obj_pool.h
+* Author:           Hai Nguyen
+* Original Date:    18.10.2026
+*
+* ----------------------------------------------------------------------------
+* Contact:          Hai Nguyen
+*                   hainguyen.eeit@gmail.com
+*
+* ----------------------------------------------------------------------------
+* License: This file is published under the license described in LICENSE.md
+*
+*****************************************************************************/
+
+/** @file   ez_obj_pool.h
+ *  @author Hai Nguyen
+ *  @date   18.10.2026
+ *  @brief  Public API of the fixed-size object pool component
+ *
+ *  @details The pool manages an array of equally sized slots. A free slot
+ *  stores the address of the next free slot, an allocated slot carries no
+ *  metadata at all. Slots which have never been allocated are handed out in
+ *  order, so the pool needs no initialization loop and can be initialized
+ *  statically. Allocation and release run in constant time and the pool
+ *  cannot fragment.
+ */
+
+#ifndef _EZ_OBJ_POOL_H
+#define _EZ_OBJ_POOL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/*****************************************************************************
+* Includes
+*****************************************************************************/
+#if (EZ_BUILD_WITH_CMAKE == 0U)
+#include "ez_target_config.h"
+#endif
+
+#if (EZ_OBJ_POOL == 1U)
+#include <stdint.h>
+#include <stdbool.h>
+
+
+/*****************************************************************************
+* Component Preprocessor Macros
+*****************************************************************************/
+
+/** @brief Slot of a pool holding objects of a type. The slot is large
+ *  enough and aligned for both the object and the free list link.
+ */
+#define EZ_OBJ_POOL_SLOT(type)  union { type obj; void *next; }
+
+/** @brief Initial value of a pool working on an array of slots
+ */
+#define EZ_OBJ_POOL_INIT_VALUE(slots, count) \
+    { (uint8_t*)(slots), sizeof((slots)[0]), (count), 0U, 0U, NULL }
+
+/** @brief Define a pool named name holding count objects of type, together
+ *  with its slots. The pool is ready to use, ezObjPool_Init is not needed.
+ */
+#define EZ_OBJ_POOL_DEFINE(name, type, count) \
+    static EZ_OBJ_POOL_SLOT(type) name##_slots[count]; \
+    static ezObjPool name = EZ_OBJ_POOL_INIT_VALUE(name##_slots, count)
+
+/** @brief Allocate an object of type from the pool
+ */
+#define EZ_OBJ_POOL_ALLOC(pool, type)   ((type*)ezObjPool_Alloc(pool))
+
+
+/*****************************************************************************
+* Component Typedefs
+*****************************************************************************/
+
+/** @brief Fixed-size object pool
+ */
+struct ezObjPool
+{
+    uint8_t     *buff;              /**< First slot */
+    uint32_t    slot_size;          /**< Size of a slot, in bytes */
+    uint32_t    num_of_slot;        /**< Number of slots */
+    uint32_t    num_of_used_slot;   /**< Slots below this index have been allocated at least once */
+    uint32_t    num_of_alloc_obj;   /**< Number of allocated objects */
+    void        *free_list;         /**< Released slots, each one stores the address of the next one */
+};
+
+
+/** @brief Define ezObjPool type
+ */
+typedef struct ezObjPool ezObjPool;
+
+
+/******************************************************************************
+* Module Variable Definitions
+*******************************************************************************/
+/* None */
+
+
+/******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+/*****************************************************************************
+* Function : ezObjPool_Init
+*//**
+* @brief Initialize a pool working on a buffer
+*
+* @details The slot size is rounded up to a multiple of the pointer size,
+* buff must be aligned for the stored objects.
+*
+* @param[in]    *pool:          pool to be initialized
+* @param[in]    *buff:          buffer holding the slots
+* @param[in]    slot_size:      size of a slot, at least the size of a pointer
+* @param[in]    num_of_slot:    number of slots, buff must be large enough
+* @return       true if success, else false
+*
+* @pre None
+* @post None
+*
+* \b Example
+* @code
+* static EZ_OBJ_POOL_SLOT(struct Foo) slots[8];
+* ezObjPool pool;
+* bool success = ezObjPool_Init(&pool, slots, sizeof(slots[0]), 8);
+* @endcode
+*
+*****************************************************************************/
+bool ezObjPool_Init(ezObjPool *pool, void *buff, uint32_t slot_size, uint32_t num_of_slot);
+
+
+/*****************************************************************************
+* Function : ezObjPool_Alloc
+*//**
+* @brief Allocate one object from the pool
+*
+* @details The content of the object is undefined
+*
+* @param[in]    *pool: pool
+* @return       address of the object, NULL if the pool is empty
+*
+* @pre pool must be initialized
+* @post None
+*
+* \b Example
+* @code
+* struct Foo *foo = EZ_OBJ_POOL_ALLOC(&pool, struct Foo);
+* @endcode
+*
+* @see ezObjPool_Init, EZ_OBJ_POOL_ALLOC
+*
+*****************************************************************************/
+void *ezObjPool_Alloc(ezObjPool *pool);
+
+
+/*****************************************************************************
+* Function : ezObjPool_Free
+*//**
+* @brief Return an object to the pool
+*
+* @details The address is checked against the slots of the pool, releasing
+* an object twice is not detected.
+*
+* @param[in]    *pool:  pool
+* @param[in]    *obj:   object allocated from this pool
+* @return       true if success, false if the address is not a slot of the pool
+*
+* @pre pool must be initialized
+* @post None
+*
+* \b Example
+* @code
+* ezObjPool_Free(&pool, foo);
+* @endcode
+*
+* @see ezObjPool_Alloc
+*
+*****************************************************************************/
+bool ezObjPool_Free(ezObjPool *pool, void *obj);
+
+
+/*****************************************************************************
+* Function : ezObjPool_IsOwner
+*//**
+* @brief Check if an address is a slot of the pool
+*
+* @details Used by components falling back to another allocator when the pool
+* is empty, to find out where an object has to be returned.
+*
+* @param[in]    *pool:  pool
+* @param[in]    *obj:   address to be checked
+* @return       true if obj is the start of a slot of the pool
+*
+* @pre pool must be initialized
+* @post None
+*
+* \b Example
+* @code
+* bool owned = ezObjPool_IsOwner(&pool, foo);
+* @endcode
+*
+*****************************************************************************/
+bool ezObjPool_IsOwner(ezObjPool *pool, void *obj);
+
+
+/*****************************************************************************
+* Function : ezObjPool_GetNumOfFreeObj
+*//**
+* @brief Return the number of objects which can still be allocated
+*
+* @details
+*
+* @param[in]    *pool:  pool
+* @return       number of free objects
+*
+* @pre pool must be initialized
+* @post None
+*
+* \b Example
+* @code
+* uint32_t num_of_free = ezObjPool_GetNumOfFreeObj(&pool);
+* @endcode
+*
+*****************************************************************************/
+uint32_t ezObjPool_GetNumOfFreeObj(ezObjPool *pool);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* EZ_OBJ_POOL == 1U */
+#endif /* _EZ_OBJ_POOL_H */
+
+/* End of file*/
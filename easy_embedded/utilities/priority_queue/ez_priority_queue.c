@@ -0,0 +1,317 @@
+/*****************************************************************************
+* Filename:         ez_priority_queue.c
+* Author:           Hai Nguyen
+* Original Date:    18.10.2026
+*
+* ----------------------------------------------------------------------------
+* Contact:          Hai Nguyen
+*                   hainguyen.eeit@gmail.com
+*
+* ----------------------------------------------------------------------------
+* License: This file is published under the license described in LICENSE.md
+*
+*****************************************************************************/
+
+/** @file   ez_priority_queue.c
+ *  @author Hai Nguyen
+ *  @date   18.10.2026
+ *  @brief  Implementation of the priority queue (pairing heap)
+ *
+ *  @details Every node is smaller than or equal to its children. The
+ *  children of a node form a list through the sibling pointer. Removing a
+ *  node merges its children with the two-pass pairing, iteratively, so the
+ *  stack usage does not depend on the shape of the heap.
+ */
+
+
+/*****************************************************************************
+* Includes
+*****************************************************************************/
+#include "ez_priority_queue.h"
+
+#if (EZ_PRIORITY_QUEUE == 1U)
+
+/*****************************************************************************
+* Component Preprocessor Macros
+*****************************************************************************/
+/* None */
+
+
+/*****************************************************************************
+* Component Typedefs
+*****************************************************************************/
+/* None */
+
+
+/*****************************************************************************
+* Component Variable Definitions
+*****************************************************************************/
+/* None */
+
+
+/*****************************************************************************
+* Function Definitions
+*****************************************************************************/
+static struct ezPriorityQueueNode *ezPriorityQueue_Meld(struct ezPriorityQueue *queue,
+                                                        struct ezPriorityQueueNode *a,
+                                                        struct ezPriorityQueueNode *b);
+static struct ezPriorityQueueNode *ezPriorityQueue_MergePairs(struct ezPriorityQueue *queue,
+                                                              struct ezPriorityQueueNode *first);
+
+
+/*****************************************************************************
+* External functions
+*****************************************************************************/
+bool ezPriorityQueue_Init(struct ezPriorityQueue *queue, ezPriorityQueue_LessFunc less)
+{
+    bool is_success = false;
+
+    if (queue != NULL && less != NULL)
+    {
+        queue->root = NULL;
+        queue->less = less;
+        queue->num_of_node = 0;
+        is_success = true;
+    }
+
+    return is_success;
+}
+
+
+void ezPriorityQueue_InitNode(struct ezPriorityQueueNode *node)
+{
+    node->child = NULL;
+    node->sibling = NULL;
+    node->prev = NULL;
+}
+
+
+bool ezPriorityQueue_Insert(struct ezPriorityQueue *queue, struct ezPriorityQueueNode *node)
+{
+    bool is_success = false;
+
+    if (queue != NULL && node != NULL
+        && ezPriorityQueue_IsNodeInQueue(queue, node) == false)
+    {
+        ezPriorityQueue_InitNode(node);
+        queue->root = ezPriorityQueue_Meld(queue, queue->root, node);
+        queue->num_of_node++;
+        is_success = true;
+    }
+
+    return is_success;
+}
+
+
+struct ezPriorityQueueNode *ezPriorityQueue_Peek(struct ezPriorityQueue *queue)
+{
+    struct ezPriorityQueueNode *node = NULL;
+
+    if (queue != NULL)
+    {
+        node = queue->root;
+    }
+
+    return node;
+}
+
+
+struct ezPriorityQueueNode *ezPriorityQueue_ExtractMin(struct ezPriorityQueue *queue)
+{
+    struct ezPriorityQueueNode *node = NULL;
+
+    if (queue != NULL && queue->root != NULL)
+    {
+        node = queue->root;
+        queue->root = ezPriorityQueue_MergePairs(queue, node->child);
+        queue->num_of_node--;
+        ezPriorityQueue_InitNode(node);
+    }
+
+    return node;
+}
+
+
+bool ezPriorityQueue_Remove(struct ezPriorityQueue *queue, struct ezPriorityQueueNode *node)
+{
+    bool is_success = false;
+    struct ezPriorityQueueNode *sub_heap = NULL;
+
+    if (queue != NULL && node != NULL && ezPriorityQueue_IsNodeInQueue(queue, node) == true)
+    {
+        if (node == queue->root)
+        {
+            (void)ezPriorityQueue_ExtractMin(queue);
+        }
+        else
+        {
+            /* Unlink the node from its parent or previous sibling */
+            if (node->prev->child == node)
+            {
+                node->prev->child = node->sibling;
+            }
+            else
+            {
+                node->prev->sibling = node->sibling;
+            }
+
+            if (node->sibling != NULL)
+            {
+                node->sibling->prev = node->prev;
+            }
+
+            /* Children of the node are still ordered, merge them back */
+            sub_heap = ezPriorityQueue_MergePairs(queue, node->child);
+            queue->root = ezPriorityQueue_Meld(queue, queue->root, sub_heap);
+            queue->num_of_node--;
+            ezPriorityQueue_InitNode(node);
+        }
+        is_success = true;
+    }
+
+    return is_success;
+}
+
+
+bool ezPriorityQueue_IsNodeInQueue(struct ezPriorityQueue *queue,
+                                   struct ezPriorityQueueNode *node)
+{
+    bool is_in_queue = false;
+
+    if (queue != NULL && node != NULL)
+    {
+        is_in_queue = (node == queue->root) || (node->prev != NULL);
+    }
+
+    return is_in_queue;
+}
+
+
+uint32_t ezPriorityQueue_GetNumOfNode(struct ezPriorityQueue *queue)
+{
+    uint32_t num_of_node = 0;
+
+    if (queue != NULL)
+    {
+        num_of_node = queue->num_of_node;
+    }
+
+    return num_of_node;
+}
+
+
+/*****************************************************************************
+* Local functions
+*****************************************************************************/
+
+/*****************************************************************************
+* Function : ezPriorityQueue_Meld
+*//**
+* @brief Merge two heaps, the root with the lower priority becomes the first
+* child of the other one
+*
+* @details
+*
+* @param    queue: (IN)pointer to the queue, for the comparison
+* @param    a: (IN)root of the first heap, may be NULL
+* @param    b: (IN)root of the second heap, may be NULL
+* @return   root of the merged heap, its sibling and prev are NULL
+*
+* @pre a and b have no sibling
+* @post None
+*
+*****************************************************************************/
+static struct ezPriorityQueueNode *ezPriorityQueue_Meld(struct ezPriorityQueue *queue,
+                                                        struct ezPriorityQueueNode *a,
+                                                        struct ezPriorityQueueNode *b)
+{
+    struct ezPriorityQueueNode *root = a;
+    struct ezPriorityQueueNode *child = b;
+
+    if (a == NULL)
+    {
+        root = b;
+    }
+    else if (b != NULL)
+    {
+        if (queue->less(b, a) == true)
+        {
+            root = b;
+            child = a;
+        }
+
+        child->sibling = root->child;
+        if (root->child != NULL)
+        {
+            root->child->prev = child;
+        }
+        child->prev = root;
+        root->child = child;
+        root->sibling = NULL;
+        root->prev = NULL;
+    }
+
+    return root;
+}
+
+
+/*****************************************************************************
+* Function : ezPriorityQueue_MergePairs
+*//**
+* @brief Merge a list of siblings into one heap
+*
+* @details First pass melds the siblings pair by pair from left to right and
+* pushes the results on a stack linked through sibling. Second pass melds
+* the stack into one heap, i.e. the pairs from right to left.
+*
+* @param    queue: (IN)pointer to the queue, for the comparison
+* @param    first: (IN)first sibling, may be NULL
+* @return   root of the merged heap or NULL
+*
+* @pre None
+* @post None
+*
+*****************************************************************************/
+static struct ezPriorityQueueNode *ezPriorityQueue_MergePairs(struct ezPriorityQueue *queue,
+                                                              struct ezPriorityQueueNode *first)
+{
+    struct ezPriorityQueueNode *pairs = NULL;
+    struct ezPriorityQueueNode *root = NULL;
+    struct ezPriorityQueueNode *a = NULL;
+    struct ezPriorityQueueNode *b = NULL;
+    struct ezPriorityQueueNode *next = NULL;
+
+    while (first != NULL)
+    {
+        a = first;
+        b = a->sibling;
+        next = (b != NULL) ? b->sibling : NULL;
+
+        a->sibling = NULL;
+        a->prev = NULL;
+        if (b != NULL)
+        {
+            b->sibling = NULL;
+            b->prev = NULL;
+        }
+
+        a = ezPriorityQueue_Meld(queue, a, b);
+        a->sibling = pairs;
+        pairs = a;
+        first = next;
+    }
+
+    while (pairs != NULL)
+    {
+        next = pairs->sibling;
+        pairs->sibling = NULL;
+        root = ezPriorityQueue_Meld(queue, root, pairs);
+        pairs = next;
+    }
+
+    return root;
+}
+
+#endif /* EZ_PRIORITY_QUEUE == 1U */
+
+/* End of file */
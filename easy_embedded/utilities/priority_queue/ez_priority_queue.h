@@ -0,0 +1,283 @@
+/*****************************************************************************
+* Filename:         ez_priority_queue.h
+* Author:           Hai Nguyen
+* Original Date:    18.10.2026
+*
+* ----------------------------------------------------------------------------
+* Contact:          Hai Nguyen
+*                   hainguyen.eeit@gmail.com
+*
+* ----------------------------------------------------------------------------
+* License: This file is published under the license described in LICENSE.md
+*
+*****************************************************************************/
+
+/** @file   ez_priority_queue.h
+ *  @author Hai Nguyen
+ *  @date   18.10.2026
+ *  @brief  Public functions of the priority queue component
+ *
+ *  @details Intrusive min-heap (pairing heap). Like struct Node of the
+ *  linked list, a struct ezPriorityQueueNode is embedded in the caller's
+ *  data structure, so the queue never allocates. The order is given by a
+ *  callback comparing two nodes. Insert and peek are O(1), extract-min and
+ *  remove are O(log n) amortized.
+ */
+
+#ifndef _EZ_PRIORITY_QUEUE_H
+#define _EZ_PRIORITY_QUEUE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*****************************************************************************
+* Includes
+*****************************************************************************/
+#if (EZ_BUILD_WITH_CMAKE == 0U)
+#include "ez_target_config.h"
+#endif
+
+#if (EZ_PRIORITY_QUEUE == 1U)
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+
+/*****************************************************************************
+* Component Preprocessor Macros
+*****************************************************************************/
+
+/*@brief Get the parent of the data structure, where the node is embedded
+ *
+ */
+#define EZ_PRIORITY_QUEUE_GET_PARENT_OF(ptr, member, type) \
+    ((type*)((char*)(ptr) - offsetof(type, member)))
+
+
+/*****************************************************************************
+* Component Typedefs
+*****************************************************************************/
+
+/** @brief Node of the priority queue, embedded in the user's data structure
+ */
+struct ezPriorityQueueNode
+{
+    struct ezPriorityQueueNode *child;      /**< First child */
+    struct ezPriorityQueueNode *sibling;    /**< Next sibling */
+    struct ezPriorityQueueNode *prev;       /**< Parent if first child, else previous sibling */
+};
+
+
+/** @brief Return true if node a must leave the queue before node b
+ */
+typedef bool (*ezPriorityQueue_LessFunc)(const struct ezPriorityQueueNode *a,
+                                         const struct ezPriorityQueueNode *b);
+
+
+/** @brief Priority queue
+ */
+struct ezPriorityQueue
+{
+    struct ezPriorityQueueNode *root;   /**< Node with the highest priority */
+    ezPriorityQueue_LessFunc less;      /**< Order of the nodes */
+    uint32_t num_of_node;               /**< Number of nodes in the queue */
+};
+
+
+/*****************************************************************************
+* Component Variable Definitions
+*****************************************************************************/
+/* None */
+
+
+/*****************************************************************************
+* Function Prototypes
+*****************************************************************************/
+
+/*****************************************************************************
+* Function : ezPriorityQueue_Init
+*//**
+* @brief Initialize an empty priority queue
+*
+* @details
+*
+* @param    queue: (IN)pointer to the queue
+* @param    less: (IN)callback ordering the nodes
+* @return   true if success, else false
+*
+* @pre None
+* @post None
+*
+* @code
+* struct ezPriorityQueue timer_queue;
+* ezPriorityQueue_Init(&timer_queue, IsTimerEarlier);
+* @endcode
+*
+*****************************************************************************/
+bool ezPriorityQueue_Init(struct ezPriorityQueue *queue, ezPriorityQueue_LessFunc less);
+
+
+/*****************************************************************************
+* Function : ezPriorityQueue_InitNode
+*//**
+* @brief Initialize a node which is not in any queue
+*
+* @details
+*
+* @param    node: (IN)pointer to the node
+* @return   None
+*
+* @pre None
+* @post None
+*
+* @code
+* ezPriorityQueue_InitNode(&timer->node);
+* @endcode
+*
+*****************************************************************************/
+void ezPriorityQueue_InitNode(struct ezPriorityQueueNode *node);
+
+
+/*****************************************************************************
+* Function : ezPriorityQueue_Insert
+*//**
+* @brief Insert a node, O(1)
+*
+* @details The key of the node must not change while it is in the queue.
+* Remove it, change the key and insert it again instead.
+*
+* @param    queue: (IN)pointer to the queue
+* @param    node: (IN)initialized node, not in any queue
+* @return   true if success, else false
+*
+* @pre node is initialized with ezPriorityQueue_InitNode
+* @post None
+*
+* @code
+* timer->expire_ms = now + 100;
+* ezPriorityQueue_Insert(&timer_queue, &timer->node);
+* @endcode
+*
+*****************************************************************************/
+bool ezPriorityQueue_Insert(struct ezPriorityQueue *queue, struct ezPriorityQueueNode *node);
+
+
+/*****************************************************************************
+* Function : ezPriorityQueue_Peek
+*//**
+* @brief Return the node with the highest priority without removing it, O(1)
+*
+* @details
+*
+* @param    queue: (IN)pointer to the queue
+* @return   pointer to the node or NULL if the queue is empty
+*
+* @pre None
+* @post None
+*
+* @code
+* struct ezPriorityQueueNode *node = ezPriorityQueue_Peek(&timer_queue);
+* @endcode
+*
+*****************************************************************************/
+struct ezPriorityQueueNode *ezPriorityQueue_Peek(struct ezPriorityQueue *queue);
+
+
+/*****************************************************************************
+* Function : ezPriorityQueue_ExtractMin
+*//**
+* @brief Remove and return the node with the highest priority
+*
+* @details O(log n) amortized. Nodes with equal keys leave in no specific
+* order.
+*
+* @param    queue: (IN)pointer to the queue
+* @return   pointer to the node or NULL if the queue is empty
+*
+* @pre None
+* @post The returned node is initialized and can be inserted again
+*
+* @code
+* struct ezPriorityQueueNode *node = ezPriorityQueue_ExtractMin(&timer_queue);
+* struct Timer *timer = EZ_PRIORITY_QUEUE_GET_PARENT_OF(node, node, struct Timer);
+* @endcode
+*
+*****************************************************************************/
+struct ezPriorityQueueNode *ezPriorityQueue_ExtractMin(struct ezPriorityQueue *queue);
+
+
+/*****************************************************************************
+* Function : ezPriorityQueue_Remove
+*//**
+* @brief Remove any node from the queue, O(log n) amortized
+*
+* @details
+*
+* @param    queue: (IN)pointer to the queue
+* @param    node: (IN)node to remove
+* @return   true if success, false if the node is not in a queue
+*
+* @pre None
+* @post The node is initialized and can be inserted again
+*
+* @code
+* ezPriorityQueue_Remove(&timer_queue, &timer->node);
+* @endcode
+*
+*****************************************************************************/
+bool ezPriorityQueue_Remove(struct ezPriorityQueue *queue, struct ezPriorityQueueNode *node);
+
+
+/*****************************************************************************
+* Function : ezPriorityQueue_IsNodeInQueue
+*//**
+* @brief Check if a node is in the queue
+*
+* @details O(1): an initialized node which is not the root has no link
+*
+* @param    queue: (IN)pointer to the queue
+* @param    node: (IN)node to check
+* @return   true if the node is in the queue, else false
+*
+* @pre node is initialized with ezPriorityQueue_InitNode
+* @post None
+*
+* @code
+* if (ezPriorityQueue_IsNodeInQueue(&timer_queue, &timer->node) == true)
+* @endcode
+*
+*****************************************************************************/
+bool ezPriorityQueue_IsNodeInQueue(struct ezPriorityQueue *queue,
+                                   struct ezPriorityQueueNode *node);
+
+
+/*****************************************************************************
+* Function : ezPriorityQueue_GetNumOfNode
+*//**
+* @brief Return the number of nodes in the queue
+*
+* @details
+*
+* @param    queue: (IN)pointer to the queue
+* @return   number of nodes
+*
+* @pre None
+* @post None
+*
+* @code
+* uint32_t pending = ezPriorityQueue_GetNumOfNode(&timer_queue);
+* @endcode
+*
+*****************************************************************************/
+uint32_t ezPriorityQueue_GetNumOfNode(struct ezPriorityQueue *queue);
+
+#endif /* EZ_PRIORITY_QUEUE == 1U */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _EZ_PRIORITY_QUEUE_H */
+
+/* End of file */
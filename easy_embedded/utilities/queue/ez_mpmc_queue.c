@@ -0,0 +1,203 @@
+/*****************************************************************************
+* Filename:         ez_mpmc_queue.c
+* Author:           Hai Nguyen
+* Original Date:    18.10.2026
+*
+* ----------------------------------------------------------------------------
+* Contact:          Hai Nguyen
+*                   hainguyen.eeit@gmail.com
+*
+* ----------------------------------------------------------------------------
+* License: This file is published under the license described in LICENSE.md
+*
+*****************************************************************************/
+
+/** @file   ez_mpmc_queue.c
+ *  @author Hai Nguyen
+ *  @date   18.10.2026
+ *  @brief  Implementation of the lock-free multi producer multi consumer
+ *          queue
+ *
+ *  @details A slot at position pos is free for the producer of pos when its
+ *  sequence is pos, and holds the element for the consumer of pos when its
+ *  sequence is pos + 1. Releasing it sets the sequence to pos + capacity,
+ *  which is the position of the next lap.
+ */
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include "ez_mpmc_queue.h"
+
+#if (EZ_MPMC_QUEUE == 1U)
+#include <string.h>
+
+
+/*****************************************************************************
+* Component Preprocessor Macros
+*****************************************************************************/
+#define GET_SLOT_SEQ(queue, pos) \
+    ((atomic_uint_least32_t*)((queue)->buff + ((pos) & (queue)->mask) * (queue)->slot_size))
+#define GET_SLOT_DATA(seq)      ((uint8_t*)(seq) + sizeof(atomic_uint_least32_t))
+
+
+/*****************************************************************************
+* Component Typedefs
+*****************************************************************************/
+/* None */
+
+
+/*****************************************************************************
+* Component Variable Definitions
+*****************************************************************************/
+/* None */
+
+
+/*****************************************************************************
+* Function Definitions
+*****************************************************************************/
+/* None */
+
+
+/*****************************************************************************
+* Public functions
+*****************************************************************************/
+bool ezMpmcQueue_Init(ezMpmcQueue *queue, void *buff, uint32_t buff_size, uint32_t elem_size)
+{
+    bool ret = false;
+    uint32_t slot_size = 0U;
+    uint32_t num_of_slot = 0U;
+    uint32_t i = 0U;
+
+    if (queue != NULL && buff != NULL && elem_size > 0U
+        && ((uintptr_t)buff % sizeof(atomic_uint_least32_t)) == 0U)
+    {
+        slot_size = (uint32_t)EZ_MPMC_QUEUE_SLOT_SIZE(elem_size);
+        num_of_slot = buff_size / slot_size;
+
+        /* Round down to a power of two, at most 2^31 so positions compare safely */
+        if (num_of_slot > 0x80000000UL)
+        {
+            num_of_slot = 0x80000000UL;
+        }
+        while ((num_of_slot & (num_of_slot - 1U)) != 0U)
+        {
+            num_of_slot &= num_of_slot - 1U;
+        }
+
+        if (num_of_slot > 0U)
+        {
+            queue->buff = (uint8_t*)buff;
+            queue->mask = num_of_slot - 1U;
+            queue->slot_size = slot_size;
+            queue->elem_size = elem_size;
+
+            for (i = 0U; i < num_of_slot; i++)
+            {
+                atomic_init(GET_SLOT_SEQ(queue, i), i);
+            }
+            atomic_init(&queue->enqueue_pos, 0U);
+            atomic_init(&queue->dequeue_pos, 0U);
+            ret = true;
+        }
+    }
+
+    return ret;
+}
+
+
+bool ezMpmcQueue_Push(ezMpmcQueue *queue, const void *data)
+{
+    atomic_uint_least32_t *seq = NULL;
+    uint32_t pos = atomic_load_explicit(&queue->enqueue_pos, memory_order_relaxed);
+    int32_t diff = 0;
+    bool is_claimed = false;
+    bool is_full = false;
+
+    while (is_claimed == false && is_full == false)
+    {
+        seq = GET_SLOT_SEQ(queue, pos);
+        diff = (int32_t)(atomic_load_explicit(seq, memory_order_acquire) - pos);
+
+        if (diff == 0)
+        {
+            /* Slot is free in this lap, claim the position. On failure pos
+             * is updated to the position another producer left */
+            is_claimed = atomic_compare_exchange_weak_explicit(&queue->enqueue_pos, &pos, pos + 1U,
+                                                               memory_order_relaxed,
+                                                               memory_order_relaxed);
+        }
+        else if (diff < 0)
+        {
+            /* Slot still holds the element of the previous lap */
+            is_full = true;
+        }
+        else
+        {
+            /* Another producer claimed the position meanwhile */
+            pos = atomic_load_explicit(&queue->enqueue_pos, memory_order_relaxed);
+        }
+    }
+
+    if (is_claimed == true)
+    {
+        memcpy(GET_SLOT_DATA(seq), data, queue->elem_size);
+
+        /* Element must be visible before the consumer sees the sequence */
+        atomic_store_explicit(seq, pos + 1U, memory_order_release);
+    }
+
+    return is_claimed;
+}
+
+
+bool ezMpmcQueue_Pop(ezMpmcQueue *queue, void *data)
+{
+    atomic_uint_least32_t *seq = NULL;
+    uint32_t pos = atomic_load_explicit(&queue->dequeue_pos, memory_order_relaxed);
+    int32_t diff = 0;
+    bool is_claimed = false;
+    bool is_empty = false;
+
+    while (is_claimed == false && is_empty == false)
+    {
+        seq = GET_SLOT_SEQ(queue, pos);
+        diff = (int32_t)(atomic_load_explicit(seq, memory_order_acquire) - (pos + 1U));
+
+        if (diff == 0)
+        {
+            is_claimed = atomic_compare_exchange_weak_explicit(&queue->dequeue_pos, &pos, pos + 1U,
+                                                               memory_order_relaxed,
+                                                               memory_order_relaxed);
+        }
+        else if (diff < 0)
+        {
+            /* Slot not written yet in this lap */
+            is_empty = true;
+        }
+        else
+        {
+            pos = atomic_load_explicit(&queue->dequeue_pos, memory_order_relaxed);
+        }
+    }
+
+    if (is_claimed == true)
+    {
+        memcpy(data, GET_SLOT_DATA(seq), queue->elem_size);
+
+        /* Element must be read before a producer of the next lap overwrites it */
+        atomic_store_explicit(seq, pos + queue->mask + 1U, memory_order_release);
+    }
+
+    return is_claimed;
+}
+
+
+uint32_t ezMpmcQueue_GetCapacity(ezMpmcQueue *queue)
+{
+    return queue->mask + 1U;
+}
+
+#endif /* EZ_MPMC_QUEUE == 1U */
+
+/* End of file */
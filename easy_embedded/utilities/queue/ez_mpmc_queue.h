@@ -0,0 +1,212 @@
+/*****************************************************************************
+* Filename:         ez_mpmc_queue.h
+* Author:           Hai Nguyen
+* Original Date:    18.10.2026
+*
+* ----------------------------------------------------------------------------
+* Contact:          Hai Nguyen
+*                   hainguyen.eeit@gmail.com
+*
+* ----------------------------------------------------------------------------
+* License: This file is published under the license described in LICENSE.md
+*
+*****************************************************************************/
+
+
+/** @file   ez_mpmc_queue.h
+ *  @author Hai Nguyen
+ *  @date   18.10.2026
+ *  @brief  Public API of the lock-free multi producer multi consumer queue
+ *
+ *  @details Bounded queue of fixed-size elements which any number of
+ *  contexts may push to and pop from concurrently, without lock. Every slot
+ *  of the buffer carries a sequence number telling whether it is ready to
+ *  be written or read in the current lap (D. Vyukov's bounded MPMC queue):
+ *  producers and consumers only contend on their own position counter, and
+ *  a slot is handed over with a single release store. The number of slots
+ *  is a power of two.
+ */
+
+#ifndef _EZ_MPMC_QUEUE_H
+#define _EZ_MPMC_QUEUE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Includes
+*******************************************************************************/
+#if (EZ_BUILD_WITH_CMAKE == 0U)
+#include "ez_target_config.h"
+#endif
+
+#if (EZ_MPMC_QUEUE == 1U)
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+
+/*****************************************************************************
+* Component Preprocessor Macros
+*****************************************************************************/
+/* Size of a cache line, used to keep the positions of both sides apart */
+#ifndef CONFIG_EZ_CACHE_LINE_SIZE
+#define CONFIG_EZ_CACHE_LINE_SIZE   64U
+#endif /* CONFIG_EZ_CACHE_LINE_SIZE */
+
+/** @brief Size of a slot holding an element of elem_size bytes */
+#define EZ_MPMC_QUEUE_SLOT_SIZE(elem_size) \
+    ((sizeof(atomic_uint_least32_t) + (elem_size) + sizeof(atomic_uint_least32_t) - 1U) \
+     & ~(sizeof(atomic_uint_least32_t) - 1U))
+
+/** @brief Size of the buffer needed for num_of_slot elements of elem_size bytes */
+#define EZ_MPMC_QUEUE_BUFF_SIZE(elem_size, num_of_slot) \
+    (EZ_MPMC_QUEUE_SLOT_SIZE(elem_size) * (num_of_slot))
+
+
+/*****************************************************************************
+* Component Typedefs
+*****************************************************************************/
+/** @brief Lock-free multi producer multi consumer queue
+ */
+struct ezMpmcQueue
+{
+    _Alignas(CONFIG_EZ_CACHE_LINE_SIZE) atomic_uint_least32_t enqueue_pos;
+    /**< Position of the next push, shared by the producers */
+    _Alignas(CONFIG_EZ_CACHE_LINE_SIZE) atomic_uint_least32_t dequeue_pos;
+    /**< Position of the next pop, shared by the consumers */
+    _Alignas(CONFIG_EZ_CACHE_LINE_SIZE) uint8_t *buff;
+    /**< Pointer to the slots */
+    uint32_t mask;
+    /**< Number of slots - 1 */
+    uint32_t slot_size;
+    /**< Size of a slot: sequence number and element */
+    uint32_t elem_size;
+    /**< Size of an element */
+};
+
+
+/** @brief Define ezMpmcQueue type
+ */
+typedef struct ezMpmcQueue ezMpmcQueue;
+
+
+/*****************************************************************************
+* Component Variable Definitions
+*****************************************************************************/
+/* None */
+
+
+/******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+/*****************************************************************************
+* Function : ezMpmcQueue_Init
+*//**
+* @brief Initialize the queue
+*
+* @details The buffer is split into as many slots as fit, rounded down to a
+* power of two. Must be called before any context uses the queue.
+*
+* @param[in]    queue:      pointer to the queue
+* @param[in]    buff:       buffer of the slots, aligned to 4 bytes
+* @param[in]    buff_size:  size of buff, see EZ_MPMC_QUEUE_BUFF_SIZE
+* @param[in]    elem_size:  size of an element
+* @return       true if success, else false
+*
+* @pre None
+* @post None
+*
+* \b Example
+* @code
+* static ezMpmcQueue event_queue;
+* static uint32_t event_buff[EZ_MPMC_QUEUE_BUFF_SIZE(sizeof(uint32_t), 16) / sizeof(uint32_t)];
+* ezMpmcQueue_Init(&event_queue, event_buff, sizeof(event_buff), sizeof(uint32_t));
+* @endcode
+*
+*****************************************************************************/
+bool ezMpmcQueue_Init(ezMpmcQueue *queue, void *buff, uint32_t buff_size, uint32_t elem_size);
+
+
+/*****************************************************************************
+* Function : ezMpmcQueue_Push
+*//**
+* @brief Copy an element into the queue
+*
+* @details Safe to call from any number of contexts at the same time
+*
+* @param[in]    queue:  pointer to the queue
+* @param[in]    data:   element, elem_size bytes
+* @return       true if success, false if the queue is full
+*
+* @pre queue must be initialized
+* @post None
+*
+* \b Example
+* @code
+* uint32_t event = 42;
+* ezMpmcQueue_Push(&event_queue, &event);
+* @endcode
+*
+*****************************************************************************/
+bool ezMpmcQueue_Push(ezMpmcQueue *queue, const void *data);
+
+
+/*****************************************************************************
+* Function : ezMpmcQueue_Pop
+*//**
+* @brief Copy the oldest element out of the queue
+*
+* @details Safe to call from any number of contexts at the same time
+*
+* @param[in]    queue:  pointer to the queue
+* @param[out]   data:   buffer receiving the element, elem_size bytes
+* @return       true if success, false if the queue is empty
+*
+* @pre queue must be initialized
+* @post None
+*
+* \b Example
+* @code
+* uint32_t event;
+* while (ezMpmcQueue_Pop(&event_queue, &event) == true)
+* {
+*     Handle(event);
+* }
+* @endcode
+*
+*****************************************************************************/
+bool ezMpmcQueue_Pop(ezMpmcQueue *queue, void *data);
+
+
+/*****************************************************************************
+* Function : ezMpmcQueue_GetCapacity
+*//**
+* @brief Return the number of slots of the queue
+*
+* @details
+*
+* @param[in]    queue:  pointer to the queue
+* @return       Number of slots
+*
+* @pre queue must be initialized
+* @post None
+*
+* \b Example
+* @code
+* uint32_t capacity = ezMpmcQueue_GetCapacity(&event_queue);
+* @endcode
+*
+*****************************************************************************/
+uint32_t ezMpmcQueue_GetCapacity(ezMpmcQueue *queue);
+
+#endif /* EZ_MPMC_QUEUE == 1U */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _EZ_MPMC_QUEUE_H */
+
+/* End of file */
@@ -27,7 +27,7 @@
 *****************************************************************************/
 #include "ez_queue.h"
 
-#if (EZ_QUEUE == 1U)
+#if (EZ_QUEUE == 1U) && (EZ_QUEUE_RING == 0U)
 
 #define DEBUG_LVL   LVL_INFO       /**< logging level */
 #define MOD_NAME    "ez_queue"     /**< module name */
@@ -48,12 +48,7 @@
 /** @brief item of the queue structure
  *
  */
-typedef struct
-{
-    void* data;         /**< pointer to the data of the queue element*/
-    uint32_t data_size; /**< data size */
-    struct Node node;   /**< node of the linked list */
-}ezQueueItem;
+typedef struct ezQueueItem ezQueueItem;
 
 /*****************************************************************************
 * Module Variable Definitions
@@ -63,7 +58,8 @@ typedef struct
 /*****************************************************************************
 * Function Definitions
 *****************************************************************************/
-/* None */
+static ezQueueItem *ezQueue_AllocItem(ezQueue *queue, uint32_t data_size);
+static ezSTATUS ezQueue_FreeItem(ezQueue *queue, ezQueueItem *item);
 
 /*****************************************************************************
 * External functions
@@ -76,21 +72,70 @@ ezSTATUS ezQueue_CreateQueue(ezQueue *queue, uint8_t *buff, uint32_t buff_size)
 
     EZTRACE("ezQueue_CreateQueue( size = %lu)", buff_size);
 
-    memset(buff, 0, buff_size);
+    if (queue != NULL && buff != NULL && buff_size > 0 && buff_size <= EZ_STATIC_ALLOC_SIZE_MAX)
+    {
+        ezLinkedList_InitNode(&queue->q_item_list);
+        queue->num_of_element = 0U;
+        queue->num_of_byte = 0U;
+        if (ezStaticAlloc_InitMemList(&queue->mem_list, buff, (ezStaticAllocSize)buff_size) == true)
+        {
+            status = ezSUCCESS;
+            EZDEBUG("create queue success");
+        }
 
-    if (queue != NULL && buff != NULL && buff_size > 0)
+#if (EZ_QUEUE_ITEM_POOL == 1U)
+        queue->item_pool = NULL;
+#endif /* EZ_QUEUE_ITEM_POOL == 1U */
+    }
+
+    return status;
+}
+
+
+ezSTATUS ezQueue_CreateLocalQueue(ezQueue *queue, uint8_t *buff, uint32_t buff_size)
+{
+    ezSTATUS status = ezFAIL;
+
+    EZTRACE("ezQueue_CreateLocalQueue( size = %lu)", buff_size);
+
+    if (queue != NULL && buff != NULL && buff_size > 0 && buff_size <= EZ_STATIC_ALLOC_SIZE_MAX)
     {
         ezLinkedList_InitNode(&queue->q_item_list);
-        if (ezStaticAlloc_InitMemList(&queue->mem_list, buff, buff_size) == true)
+        queue->num_of_element = 0U;
+        queue->num_of_byte = 0U;
+        if (ezStaticAlloc_InitLocalMemList(&queue->mem_list, buff, (ezStaticAllocSize)buff_size) == true)
         {
             status = ezSUCCESS;
             EZDEBUG("create queue success");
         }
+
+#if (EZ_QUEUE_ITEM_POOL == 1U)
+        queue->item_pool = NULL;
+#endif /* EZ_QUEUE_ITEM_POOL == 1U */
     }
 
     return status;
 }
 
+#if (EZ_QUEUE_ITEM_POOL == 1U)
+ezSTATUS ezQueue_SetItemPool(ezQueue *queue, ezObjPool *item_pool)
+{
+    ezSTATUS status = ezFAIL;
+
+    EZTRACE("ezQueue_SetItemPool()");
+
+    /* Items in the queue must go back to the pool they come from */
+    if (queue != NULL && ezQueue_GetNumOfElement(queue) == 0U
+        && (item_pool == NULL || item_pool->slot_size >= sizeof(struct ezQueueItemSlot)))
+    {
+        queue->item_pool = item_pool;
+        status = ezSUCCESS;
+    }
+
+    return status;
+}
+#endif /* EZ_QUEUE_ITEM_POOL == 1U */
+
 ezSTATUS ezQueue_PopFront(ezQueue* queue)
 {
     ezSTATUS status = ezSUCCESS;
@@ -104,21 +149,10 @@ ezSTATUS ezQueue_PopFront(ezQueue* queue)
         {
             popped_item = EZ_LINKEDLIST_GET_PARENT_OF(queue->q_item_list.next, node, ezQueueItem);
             EZ_LINKEDLIST_UNLINK_NODE(&popped_item->node);
+            queue->num_of_element--;
+            queue->num_of_byte -= popped_item->data_size;
 
-            if (ezStaticAlloc_Free(&queue->mem_list, popped_item->data) == false)
-            {
-                status = ezFAIL;
-                EZTRACE("free fail");
-            }
-
-            if (status == ezSUCCESS)
-            {
-                if (ezStaticAlloc_Free(&queue->mem_list, (void*)popped_item) == false)
-                {
-                    status = ezFAIL;
-                    EZTRACE("free fail");
-                }
-            }
+            status = ezQueue_FreeItem(queue, popped_item);
         }
     }
     else
@@ -143,21 +177,10 @@ ezSTATUS ezQueue_PopBack(ezQueue *queue)
         {
             popped_item = EZ_LINKEDLIST_GET_PARENT_OF(queue->q_item_list.prev, node, ezQueueItem);
             EZ_LINKEDLIST_UNLINK_NODE(&popped_item->node);
+            queue->num_of_element--;
+            queue->num_of_byte -= popped_item->data_size;
 
-            if (ezStaticAlloc_Free(&queue->mem_list, popped_item->data) == false)
-            {
-                status = ezFAIL;
-                EZTRACE("free fail");
-            }
-
-            if (status == ezSUCCESS)
-            {
-                if (ezStaticAlloc_Free(&queue->mem_list, (void *)popped_item) == false)
-                {
-                    status = ezFAIL;
-                    EZTRACE("free fail");
-                }
-            }
+            status = ezQueue_FreeItem(queue, popped_item);
         }
     }
     else
@@ -175,18 +198,21 @@ ezReservedElement ezQueue_ReserveElement(ezQueue *queue, void **data, uint32_t d
 
     EZTRACE("ezQueue_Push( [@ = %p], [size = %lu])", data, data_size);
 
-    if (queue != NULL && data != NULL && data_size > 0)
+    if (queue != NULL && data != NULL && data_size > 0 && data_size <= EZ_STATIC_ALLOC_SIZE_MAX)
     {
-        item = (ezQueueItem*)ezStaticAlloc_Malloc(&queue->mem_list, sizeof(ezQueueItem));
+        item = ezQueue_AllocItem(queue, data_size);
 
         if (item != NULL)
         {
             item->data_size = data_size;
-            item->data = ezStaticAlloc_Malloc(&queue->mem_list, data_size);
+            if (item->data == NULL)
+            {
+                item->data = ezStaticAlloc_Malloc(&queue->mem_list, (ezStaticAllocSize)data_size);
+            }
 
             if (item->data == NULL)
             {
-                ezStaticAlloc_Free(&queue->mem_list, (void*)item);
+                (void)ezQueue_FreeItem(queue, item);
                 item = NULL;
                 EZTRACE("allocate data fail");
             }
@@ -209,6 +235,8 @@ ezSTATUS ezQueue_PushReservedElement(ezQueue *queue, ezReservedElement element)
     if (queue != NULL && element != NULL)
     {
         EZ_LINKEDLIST_ADD_TAIL(&queue->q_item_list, &item->node);
+        queue->num_of_element++;
+        queue->num_of_byte += item->data_size;
     }
     else
     {
@@ -226,11 +254,7 @@ ezSTATUS ezQueue_ReleaseReservedElement( ezQueue *queue, ezReservedElement eleme
 
     if (queue != NULL && item != NULL)
     {
-        if (ezStaticAlloc_Free(&queue->mem_list, (void *)item->data) == true
-            && ezStaticAlloc_Free(&queue->mem_list, (void *)item) == true)
-        {
-            status = ezSUCCESS;
-        }
+        status = ezQueue_FreeItem(queue, item);
     }
 
     return status;
@@ -268,6 +292,46 @@ ezSTATUS ezQueue_Push(ezQueue* queue, void *data, uint32_t data_size)
     return status;
 }
 
+uint32_t ezQueue_PushBatch(ezQueue *queue,
+                           void *const data[],
+                           const uint32_t data_size[],
+                           uint32_t num_of_element)
+{
+    uint32_t num_of_pushed = 0;
+    uint32_t num_of_byte = 0;
+    void *reserve_data = NULL;
+    ezQueueItem *item = NULL;
+
+    EZTRACE("ezQueue_PushBatch( [num = %lu])", num_of_element);
+
+    if (queue != NULL && data != NULL && data_size != NULL)
+    {
+        while (num_of_pushed < num_of_element && data[num_of_pushed] != NULL)
+        {
+            item = (ezQueueItem*)ezQueue_ReserveElement(queue,
+                                                        &reserve_data,
+                                                        data_size[num_of_pushed]);
+            if (item == NULL)
+            {
+                EZDEBUG("add item fail");
+                break;
+            }
+
+            memcpy(reserve_data, data[num_of_pushed], data_size[num_of_pushed]);
+            EZ_LINKEDLIST_ADD_TAIL(&queue->q_item_list, &item->node);
+            num_of_byte += data_size[num_of_pushed];
+            num_of_pushed++;
+        }
+
+        /* Counters are updated once for the whole batch */
+        queue->num_of_element += num_of_pushed;
+        queue->num_of_byte += num_of_byte;
+    }
+
+    return num_of_pushed;
+}
+
+
 ezSTATUS ezQueue_GetFront(ezQueue* queue, void **data, uint32_t *data_size)
 {
     ezSTATUS status = ezSUCCESS;
@@ -342,19 +406,102 @@ ezSTATUS ezQueue_GetBack(ezQueue* queue, void **data, uint32_t *data_size)
     return status;
 }
 
+uint32_t ezQueue_GetFrontBatch(ezQueue *queue,
+                               void *data[],
+                               uint32_t data_size[],
+                               uint32_t max_num_of_element)
+{
+    uint32_t num_of_element = 0;
+    struct Node *it = NULL;
+    ezQueueItem *item = NULL;
+
+    EZTRACE("ezQueue_GetFrontBatch()");
+
+    if (queue != NULL && data != NULL && data_size != NULL)
+    {
+        EZ_LINKEDLIST_FOR_EACH(it, &queue->q_item_list)
+        {
+            if (num_of_element >= max_num_of_element)
+            {
+                break;
+            }
+
+            item = EZ_LINKEDLIST_GET_PARENT_OF(it, node, ezQueueItem);
+            data[num_of_element] = item->data;
+            data_size[num_of_element] = item->data_size;
+            num_of_element++;
+        }
+    }
+
+    return num_of_element;
+}
+
+
+uint32_t ezQueue_PopFrontBatch(ezQueue *queue, uint32_t num_of_element)
+{
+    uint32_t num_of_popped = 0;
+    uint32_t num_of_byte = 0;
+    ezQueueItem *popped_item = NULL;
+
+    EZTRACE("ezQueue_PopFrontBatch( [num = %lu])", num_of_element);
+
+    if (queue != NULL)
+    {
+        if (num_of_element > queue->num_of_element)
+        {
+            num_of_element = queue->num_of_element;
+        }
+
+        while (num_of_popped < num_of_element)
+        {
+            popped_item = EZ_LINKEDLIST_GET_PARENT_OF(queue->q_item_list.next, node, ezQueueItem);
+            EZ_LINKEDLIST_UNLINK_NODE(&popped_item->node);
+            num_of_byte += popped_item->data_size;
+            num_of_popped++;
+            (void)ezQueue_FreeItem(queue, popped_item);
+        }
+
+        /* Counters are updated once for the whole batch */
+        queue->num_of_element -= num_of_popped;
+        queue->num_of_byte -= num_of_byte;
+    }
+
+    return num_of_popped;
+}
+
+
 uint32_t ezQueue_GetNumOfElement(ezQueue* queue)
 {
     uint32_t num_of_element = 0;
 
     if (queue != NULL)
     {
-        num_of_element = ezLinkedList_GetListSize(&queue->q_item_list);
+        num_of_element = queue->num_of_element;
     }
 
     return num_of_element;
 }
 
 
+uint32_t ezQueue_GetNumOfByte(ezQueue *queue)
+{
+    uint32_t num_of_byte = 0;
+
+    if (queue != NULL)
+    {
+        num_of_byte = queue->num_of_byte;
+    }
+
+    return num_of_byte;
+}
+
+
+bool ezQueue_IsEmpty(ezQueue *queue)
+{
+    return (queue == NULL || queue->num_of_element == 0U);
+}
+
+
 uint32_t ezQueue_IsQueueReady(ezQueue *queue)
 {
     bool is_ready = false;
@@ -371,9 +518,114 @@ uint32_t ezQueue_IsQueueReady(ezQueue *queue)
 /*****************************************************************************
 * Internal functions
 *****************************************************************************/
-/* None */
+
+/*****************************************************************************
+* Function: ezQueue_AllocItem
+*//**
+* @brief Allocate a queue item. The data pointer is set when the data is
+* stored in the item, else it is NULL.
+*
+* @param    *queue: (IN)queue
+* @param    data_size: (IN)size of the data of the element
+* @return   item or NULL if no memory is available
+*
+*****************************************************************************/
+static ezQueueItem *ezQueue_AllocItem(ezQueue *queue, uint32_t data_size)
+{
+    ezQueueItem *item = NULL;
+
+#if (EZ_QUEUE_ITEM_POOL == 1U)
+    struct ezQueueItemSlot *slot = NULL;
+
+    if (queue->item_pool != NULL)
+    {
+        slot = EZ_OBJ_POOL_ALLOC(queue->item_pool, struct ezQueueItemSlot);
+    }
+
+    if (slot != NULL)
+    {
+        item = &slot->item;
+        item->data = NULL;
+
+        if (data_size <= CONFIG_EZ_QUEUE_ITEM_INLINE_SIZE)
+        {
+            /* same guarantee as memory coming from the static allocation */
+            if (queue->mem_list.scrub_policy == EZ_STATIC_ALLOC_SCRUB_ON_FREE)
+            {
+                memset(slot->inline_data, 0, data_size);
+            }
+            item->data = slot->inline_data;
+        }
+    }
+#else
+    (void)data_size;
+#endif /* EZ_QUEUE_ITEM_POOL == 1U */
+
+    if (item == NULL)
+    {
+        item = (ezQueueItem*)ezStaticAlloc_Malloc(&queue->mem_list, sizeof(ezQueueItem));
+        if (item != NULL)
+        {
+            item->data = NULL;
+        }
+    }
+
+    return item;
+}
+
+
+/*****************************************************************************
+* Function: ezQueue_FreeItem
+*//**
+* @brief Release a queue item and its data
+*
+* @param    *queue: (IN)queue
+* @param    *item: (IN)item, unlinked from the queue
+* @return   ezSUCCESS or ezFAIL
+*
+*****************************************************************************/
+static ezSTATUS ezQueue_FreeItem(ezQueue *queue, ezQueueItem *item)
+{
+    ezSTATUS status = ezSUCCESS;
+    bool is_pool_item = false;
+    bool is_inline_data = false;
+
+#if (EZ_QUEUE_ITEM_POOL == 1U)
+    is_pool_item = (queue->item_pool != NULL)
+        && ezObjPool_IsOwner(queue->item_pool, (void*)item);
+    is_inline_data = is_pool_item
+        && (item->data == (void*)((struct ezQueueItemSlot*)item)->inline_data);
+#endif /* EZ_QUEUE_ITEM_POOL == 1U */
+
+    /* data is NULL when its allocation failed in ezQueue_ReserveElement */
+    if (is_inline_data == false
+        && item->data != NULL
+        && ezStaticAlloc_Free(&queue->mem_list, item->data) == false)
+    {
+        status = ezFAIL;
+        EZTRACE("free fail");
+    }
+
+    if (status == ezSUCCESS)
+    {
+#if (EZ_QUEUE_ITEM_POOL == 1U)
+        if (is_pool_item == true)
+        {
+            (void)ezObjPool_Free(queue->item_pool, (void*)item);
+        }
+        else
+#endif /* EZ_QUEUE_ITEM_POOL == 1U */
+        if (ezStaticAlloc_Free(&queue->mem_list, (void*)item) == false)
+        {
+            status = ezFAIL;
+            EZTRACE("free fail");
+        }
+    }
+
+    return status;
+}
 
 
-#endif /* CONFIG_EZ_QUEUE == 1U */
+#endif /* (EZ_QUEUE == 1U) && (EZ_QUEUE_RING == 0U) */
 /* End of file*/
 
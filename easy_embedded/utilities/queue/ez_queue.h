@@ -17,7 +17,24 @@
  *  @date   26.02.2024
  *  @brief  Public APi of the queue component
  *
- *  @details Implemenation of the queue data structure
+ *  @details Implemenation of the queue data structure. Two engines share
+ *  this API.
+ *
+ *  By default every element is described by an ezQueueItem allocated from
+ *  the buffer given to the queue. An item pool, defined with
+ *  EZ_QUEUE_ITEM_POOL_DEFINE and shared by queues used from one context, can be
+ *  attached with ezQueue_SetItemPool. Items are then taken from the pool
+ *  and data up to CONFIG_EZ_QUEUE_ITEM_INLINE_SIZE bytes is stored in the
+ *  item itself. Larger data, and items once the pool is empty, still come
+ *  from the buffer. The pool has no lock: RPC instances and task workers
+ *  keep one pool each, used by their own queues only.
+ *
+ *  With EZ_QUEUE_RING, the elements are stored back-to-back in the buffer,
+ *  each one behind a small header holding its size, and the buffer is used
+ *  as a ring. Reserving, pushing and popping the front element run in
+ *  constant time without any allocator. Reserved elements become visible in
+ *  the order they were reserved, and the data of an element never wraps, so
+ *  it stays directly accessible.
  */
 
 #ifndef _EZ_QUEUE_H
@@ -39,12 +56,37 @@ extern "C" {
 #include "ez_utilities_common.h"
 #include "ez_linked_list.h"
 #include "ez_static_alloc.h"
+#if (EZ_OBJ_POOL == 1U)
+#include "ez_obj_pool.h"
+#endif /* EZ_OBJ_POOL == 1U */
 
 
 /*****************************************************************************
 * Module Preprocessor Macros
 *****************************************************************************/
-/* None */
+/* Store the elements in a ring instead of allocating them */
+#ifndef EZ_QUEUE_RING
+#define EZ_QUEUE_RING                       0U
+#endif /* EZ_QUEUE_RING */
+
+/* Data up to this size is stored in the item taken from an item pool */
+#ifndef CONFIG_EZ_QUEUE_ITEM_INLINE_SIZE
+#define CONFIG_EZ_QUEUE_ITEM_INLINE_SIZE    16U
+#endif /* CONFIG_EZ_QUEUE_ITEM_INLINE_SIZE */
+
+#if (EZ_OBJ_POOL == 1U) && (EZ_QUEUE_RING == 0U)
+#define EZ_QUEUE_ITEM_POOL      1U
+#else
+#define EZ_QUEUE_ITEM_POOL      0U
+#endif
+
+#if (EZ_QUEUE_ITEM_POOL == 1U)
+/* Define an item pool named name, holding count items. It costs
+ * count * sizeof(struct ezQueueItemSlot) bytes, whatever the number of
+ * queues using it */
+#define EZ_QUEUE_ITEM_POOL_DEFINE(name, count) \
+    EZ_OBJ_POOL_DEFINE(name, struct ezQueueItemSlot, count)
+#endif /* EZ_QUEUE_ITEM_POOL == 1U */
 
 /*****************************************************************************
 * Module Typedefs
@@ -55,13 +97,56 @@ extern "C" {
 typedef struct ezQueue ezQueue;
 
 
+#if (EZ_QUEUE_RING == 1U)
+/** @brief Construction of the queue storing its elements in a ring
+ */
+struct ezQueue
+{
+    uint8_t *buff;              /**< start of the ring, aligned */
+    uint32_t buff_size;         /**< size of the ring */
+    uint32_t read_offset;       /**< offset of the oldest element */
+    uint32_t commit_offset;     /**< elements before this offset are visible or released */
+    uint32_t write_offset;      /**< offset of the next reserved element */
+    uint32_t used_bytes;        /**< bytes between read_offset and write_offset */
+    uint32_t committed_bytes;   /**< bytes between read_offset and commit_offset */
+    uint32_t num_of_element;    /**< number of visible elements */
+    uint32_t num_of_byte;       /**< size of the data of the visible elements */
+};
+#else
+/** @brief item of the queue structure
+ */
+struct ezQueueItem
+{
+    void* data;         /**< pointer to the data of the queue element*/
+    uint32_t data_size; /**< data size */
+    struct Node node;   /**< node of the linked list */
+};
+
+
+#if (EZ_QUEUE_ITEM_POOL == 1U)
+/** @brief Item taken from the pool of the queue, with room for small data
+ */
+struct ezQueueItemSlot
+{
+    struct ezQueueItem item;                                /**< queue item */
+    uint8_t inline_data[CONFIG_EZ_QUEUE_ITEM_INLINE_SIZE];  /**< storage of small data */
+};
+#endif /* EZ_QUEUE_ITEM_POOL == 1U */
+
+
 /** @brief Construction of the queue
  */
 struct ezQueue
 {
     struct Node q_item_list;    /**< list of queue element */
     struct MemList mem_list;    /**< memory list, needed for static memory allocation*/
+    uint32_t num_of_element;    /**< number of elements in q_item_list */
+    uint32_t num_of_byte;       /**< size of the data of the elements in q_item_list */
+#if (EZ_QUEUE_ITEM_POOL == 1U)
+    ezObjPool *item_pool;       /**< pool of queue items, NULL to allocate them from the buffer */
+#endif /* EZ_QUEUE_ITEM_POOL == 1U */
 };
+#endif /* EZ_QUEUE_RING == 1U */
 
 
 /** @brief queue structure
@@ -83,6 +168,11 @@ typedef void* ezReservedElement;
 *//** 
 * @brief This function creates a data queue
 *
+* @details The buffer is prepared by the memory list of the queue, whose
+* scrub policy can be changed with ezStaticAlloc_SetScrubPolicy. With
+* EZ_QUEUE_RING, the buffer is used as it is and reserved memory is not
+* cleared.
+*
 * @param    *queue: (IN)pointer to the a queue structure, see ezQueue
 * @param    *buff: (IN) memory buffer providind to the queue to work
 * @param    *buff_size: (IN)size of the memory buffer
@@ -105,6 +195,67 @@ typedef void* ezReservedElement;
 ezSTATUS ezQueue_CreateQueue(ezQueue *queue, uint8_t *buff, uint32_t buff_size);
 
 
+/*****************************************************************************
+* Function : ezQueue_CreateLocalQueue
+*//** 
+* @brief This function creates a data queue which shares no state with the
+* other queues
+*
+* @details The memory list of the queue is initialized with
+* ezStaticAlloc_InitLocalMemList, so its block headers are carved from the
+* buffer instead of the pool shared by all memory lists. Queues used by
+* different threads, each behind its own lock, must be created this way.
+* With EZ_QUEUE_RING it is the same as ezQueue_CreateQueue.
+*
+* @param    *queue: (IN)pointer to the a queue structure, see ezQueue
+* @param    *buff: (IN) memory buffer providind to the queue to work
+* @param    *buff_size: (IN)size of the memory buffer
+* @return   ezSUCCESS or ezFAIL
+*
+* @pre None
+* @post None
+*
+* @code
+* ezQueue queue;
+* uint8_t queue_buff[256] = {0};
+* ezSTATUS status = ezQueue_CreateLocalQueue(&queue, queue_buff, 256);
+* @endcode
+*
+* @see ezQueue_CreateQueue
+*
+*****************************************************************************/
+ezSTATUS ezQueue_CreateLocalQueue(ezQueue *queue, uint8_t *buff, uint32_t buff_size);
+
+
+#if (EZ_QUEUE_ITEM_POOL == 1U)
+/*****************************************************************************
+* Function : ezQueue_SetItemPool
+*//** 
+* @brief This function attaches an item pool to a queue
+*
+* @details The pool is not protected against concurrent access. Queues
+* sharing a pool must not be used at the same time from different contexts,
+* e.g. give one pool to the queues of each task worker.
+*
+* @param    *queue: (IN)pointer to an empty queue
+* @param    *item_pool: (IN)pool defined with EZ_QUEUE_ITEM_POOL_DEFINE, NULL
+*                       to allocate the items from the buffer again
+* @return   ezSUCCESS or ezFAIL
+*
+* @pre None
+* @post None
+*
+* @code
+* EZ_QUEUE_ITEM_POOL_DEFINE(item_pool, 16);
+* ezQueue_SetItemPool(&tx_queue, &item_pool);
+* ezQueue_SetItemPool(&rx_queue, &item_pool);
+* @endcode
+*
+*****************************************************************************/
+ezSTATUS ezQueue_SetItemPool(ezQueue *queue, ezObjPool *item_pool);
+#endif /* EZ_QUEUE_ITEM_POOL == 1U */
+
+
 /*****************************************************************************
 * Function : ezQueue_PopFront
 *//** 
@@ -136,7 +287,8 @@ ezSTATUS ezQueue_PopFront(ezQueue *queue);
 *//** 
 * @brief This function pops the back element out of the queue
 *
-* @details
+* @details With EZ_QUEUE_RING, the back element is searched from the front,
+* and its memory is only reused once the elements before it are popped.
 *
 * @param    *queue: (IN)pointer to the a queue structure, see ezQueue
 * @return   ezSUCCESS or ezFAIL
@@ -264,6 +416,44 @@ ezSTATUS ezQueue_ReleaseReservedElement(ezQueue *queue, ezReservedElement elemen
 ezSTATUS ezQueue_Push(ezQueue* queue, void *data, uint32_t data_size);
 
 
+/*****************************************************************************
+* Function : ezQueue_PushBatch
+*//** 
+* @brief This function pushes several elements to the queue in one call
+*
+* @details The elements are pushed in the order of the arrays. Pushing stops
+* at the first element which does not fit or whose data is NULL, the elements
+* before it stay in the queue. With EZ_QUEUE_RING the whole batch is
+* published at once, which is where batching pays off. The default engine
+* still allocates every element, the batch only saves the counter updates.
+*
+* @param    *queue: (IN)pointer to the a queue structure, see ezQueue
+* @param    data: (IN)array of pointers to the data of the elements
+* @param    data_size: (IN)array of the sizes of the elements
+* @param    num_of_element: (IN)number of elements in both arrays
+* @return   Number of elements pushed
+*
+* @pre queue is initialized
+* @post None
+*
+* @code
+* void *data[2] = { header, payload };
+* uint32_t data_size[2] = { sizeof(header), sizeof(payload) };
+* if (ezQueue_PushBatch(&queue, data, data_size, 2) != 2)
+* {
+*     printf("queue full");
+* }
+* @endcode
+*
+* @see ezQueue_Push
+*
+*****************************************************************************/
+uint32_t ezQueue_PushBatch(ezQueue *queue,
+                           void *const data[],
+                           const uint32_t data_size[],
+                           uint32_t num_of_element);
+
+
 /*****************************************************************************
 * Function : ezQueue_GetFront
 *//** 
@@ -302,7 +492,8 @@ ezSTATUS ezQueue_GetFront(ezQueue *queue, void **data, uint32_t *data_size);
 * @brief This function let the user access to the back element of the queue.
 *
 * @details Since the users have the access to the queue it is NOT SAFE to write
-* more than the size of this element
+* more than the size of this element. With EZ_QUEUE_RING, the back element
+* is searched from the front.
 *
 * @param    *queue: (IN)pointer to the a queue structure, see ezQueue
 * @param    **data: (OUT)pointer the the data of the back element
@@ -328,12 +519,76 @@ ezSTATUS ezQueue_GetFront(ezQueue *queue, void **data, uint32_t *data_size);
 ezSTATUS ezQueue_GetBack(ezQueue* queue, void **data, uint32_t *data_size);
 
 
+/*****************************************************************************
+* Function : ezQueue_GetFrontBatch
+*//** 
+* @brief This function let the user access to several elements at the front
+* of the queue.
+*
+* @details The elements stay in the queue, so they can be processed in place
+* and popped at once with ezQueue_PopFrontBatch.
+*
+* @param    *queue: (IN)pointer to the a queue structure, see ezQueue
+* @param    data: (OUT)array receiving the pointers to the data
+* @param    data_size: (OUT)array receiving the sizes of the data
+* @param    max_num_of_element: (IN)number of entries of both arrays
+* @return   Number of elements returned
+*
+* @pre queue is initialized
+* @post None
+*
+* @code
+* void *data[8];
+* uint32_t data_size[8];
+* uint32_t count = ezQueue_GetFrontBatch(&queue, data, data_size, 8);
+* for (uint32_t i = 0; i < count; i++)
+* {
+*     Process(data[i], data_size[i]);
+* }
+* ezQueue_PopFrontBatch(&queue, count);
+* @endcode
+*
+* @see ezQueue_PopFrontBatch
+*
+*****************************************************************************/
+uint32_t ezQueue_GetFrontBatch(ezQueue *queue,
+                               void *data[],
+                               uint32_t data_size[],
+                               uint32_t max_num_of_element);
+
+
+/*****************************************************************************
+* Function : ezQueue_PopFrontBatch
+*//** 
+* @brief This function pops several elements out of the front of the queue
+*
+* @details Pops fewer elements if the queue holds fewer. With EZ_QUEUE_RING
+* the space of the whole batch is released at once. The default engine
+* still frees every element, the batch only saves the counter updates.
+*
+* @param    *queue: (IN)pointer to the a queue structure, see ezQueue
+* @param    num_of_element: (IN)number of elements to pop
+* @return   Number of elements popped
+*
+* @pre queue is initialized
+* @post None
+*
+* @code
+* ezQueue_PopFrontBatch(&queue, ezQueue_GetNumOfElement(&queue));
+* @endcode
+*
+* @see ezQueue_GetFrontBatch
+*
+*****************************************************************************/
+uint32_t ezQueue_PopFrontBatch(ezQueue *queue, uint32_t num_of_element);
+
+
 /*****************************************************************************
 * Function : sum
 *//** 
 * @brief ezQueue_GetNumOfElement
 *
-* @details
+* @details The count is maintained by the queue, so the call is O(1)
 *
 * @param    *queue: (IN)pointer to the a queue structure, see ezQueue
 * @return   Number of elements
@@ -351,6 +606,56 @@ ezSTATUS ezQueue_GetBack(ezQueue* queue, void **data, uint32_t *data_size);
 uint32_t ezQueue_GetNumOfElement(ezQueue* queue);
 
 
+/*****************************************************************************
+* Function : ezQueue_GetNumOfByte
+*//** 
+* @brief Return the size of the data of all elements in the queue
+*
+* @details Reserved elements are not counted until they are pushed. The
+* memory taken by the bookkeeping of the queue is not included.
+*
+* @param    *queue: (IN)pointer to the a queue structure, see ezQueue
+* @return   Number of bytes
+*
+* @pre queue is initialized
+* @post None
+*
+* @code
+* uint32_t pending_bytes = ezQueue_GetNumOfByte(&queue);
+* @endcode
+*
+* @see ezQueue_GetNumOfElement
+*
+*****************************************************************************/
+uint32_t ezQueue_GetNumOfByte(ezQueue *queue);
+
+
+/*****************************************************************************
+* Function : ezQueue_IsEmpty
+*//** 
+* @brief Check if the queue has no element
+*
+* @details Cheap enough to be polled, an invalid queue is reported as empty
+*
+* @param    *queue: (IN)pointer to the a queue structure, see ezQueue
+* @return   true if the queue is empty, else false
+*
+* @pre queue is initialized
+* @post None
+*
+* @code
+* while (ezQueue_IsEmpty(&queue) == false)
+* {
+*     ezQueue_PopFront(&queue);
+* }
+* @endcode
+*
+* @see ezQueue_GetNumOfElement
+*
+*****************************************************************************/
+bool ezQueue_IsEmpty(ezQueue *queue);
+
+
 /******************************************************************************
 * Function : ezQueue_IsQueueReady
 *//**
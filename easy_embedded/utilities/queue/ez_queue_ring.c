@@ -0,0 +1,721 @@
+/*****************************************************************************
+* Filename:         ez_queue_ring.c
+* Author:           Hai Nguyen
+* Original Date:    18.10.2026
+*
+* ----------------------------------------------------------------------------
+* Contact:          Hai Nguyen
+*                   hainguyen.eeit@gmail.com
+*
+* ----------------------------------------------------------------------------
+* License: This file is published under the license described in LICENSE.md
+*
+*****************************************************************************/
+
+/** @file   ez_queue_ring.c
+ *  @author Hai Nguyen
+ *  @date   18.10.2026
+ *  @brief  Implementation of the queue storing its elements in a ring
+ *
+ *  @details Every element is a record made of a header and the data, both
+ *  rounded up to RECORD_UNIT bytes. The buffer is split by three offsets:
+ *
+ *  read_offset -> commit_offset:   records which are pushed or released
+ *  commit_offset -> write_offset:  records of which the first one is still
+ *                                  reserved
+ *
+ *  A record which does not fit before the end of the buffer is placed at
+ *  the start, the rest of the buffer is filled with a released record. The
+ *  data of a record therefore never wraps.
+ */
+
+/*****************************************************************************
+* Includes
+*****************************************************************************/
+#include "ez_queue.h"
+
+#if (EZ_QUEUE == 1U) && (EZ_QUEUE_RING == 1U)
+
+#define DEBUG_LVL   LVL_INFO       /**< logging level */
+#define MOD_NAME    "ez_queue"     /**< module name */
+
+#include "ez_logging.h"
+#include <string.h>
+
+/*****************************************************************************
+* Module Preprocessor Macros
+*****************************************************************************/
+#define RECORD_UNIT         (sizeof(struct ezQueueRecord) > sizeof(uintptr_t) ? \
+                             sizeof(struct ezQueueRecord) : sizeof(uintptr_t))
+                            /**< header size and alignment of the records */
+#define UNIT_ALIGN_UP(x)    (((x) + (RECORD_UNIT - 1U)) & ~(RECORD_UNIT - 1U))
+#define UNIT_ALIGN_DOWN(x)  ((x) & ~(RECORD_UNIT - 1U))
+#define RECORD_SIZE(data_size)  ((uint32_t)(RECORD_UNIT + UNIT_ALIGN_UP((uint32_t)(data_size))))
+#define GET_RECORD(queue, offset)   ((struct ezQueueRecord*)((queue)->buff + (offset)))
+#define GET_DATA(record)    ((void*)((uint8_t*)(record) + RECORD_UNIT))
+
+
+/*****************************************************************************
+* Module Typedefs
+*****************************************************************************/
+
+/** @brief State of a record
+ */
+enum ezQueueRecordState
+{
+    RECORD_RESERVED,    /**< reserved, not pushed yet */
+    RECORD_PUSHED,      /**< element of the queue */
+    RECORD_RELEASED,    /**< released or popped, skipped when read */
+};
+
+
+/** @brief Header of a record
+ */
+struct ezQueueRecord
+{
+    ezStaticAllocSize data_size;    /**< size of the data following the header */
+    uint8_t state;                  /**< see ezQueueRecordState */
+};
+
+
+/*****************************************************************************
+* Module Variable Definitions
+*****************************************************************************/
+/* None */
+
+/*****************************************************************************
+* Function Definitions
+*****************************************************************************/
+static uint32_t ezQueue_GetNextOffset(ezQueue *queue, uint32_t offset);
+static bool ezQueue_AllocRecord(ezQueue *queue, uint32_t record_size, uint32_t *offset);
+static void ezQueue_Settle(ezQueue *queue);
+static void ezQueue_DropReleased(ezQueue *queue);
+static struct ezQueueRecord *ezQueue_FindBack(ezQueue *queue);
+static struct ezQueueRecord *ezQueue_GetReservedRecord(ezQueue *queue, ezReservedElement element);
+
+/*****************************************************************************
+* External functions
+*****************************************************************************/
+ezSTATUS ezQueue_CreateQueue(ezQueue *queue, uint8_t *buff, uint32_t buff_size)
+{
+    ezSTATUS status = ezFAIL;
+    uintptr_t start = 0U;
+    uint32_t size = 0U;
+
+    EZTRACE("ezQueue_CreateQueue( size = %lu)", buff_size);
+
+    if (queue != NULL && buff != NULL && buff_size > 0 && buff_size <= EZ_STATIC_ALLOC_SIZE_MAX)
+    {
+        start = UNIT_ALIGN_UP((uintptr_t)buff);
+        if (start - (uintptr_t)buff < buff_size)
+        {
+            size = (uint32_t)UNIT_ALIGN_DOWN(buff_size - (uint32_t)(start - (uintptr_t)buff));
+        }
+
+        if (size >= 2U * RECORD_UNIT)
+        {
+            queue->buff = (uint8_t*)start;
+            queue->buff_size = size;
+            queue->read_offset = 0U;
+            queue->commit_offset = 0U;
+            queue->write_offset = 0U;
+            queue->used_bytes = 0U;
+            queue->committed_bytes = 0U;
+            queue->num_of_element = 0U;
+            queue->num_of_byte = 0U;
+            status = ezSUCCESS;
+            EZDEBUG("create queue success");
+        }
+    }
+
+    return status;
+}
+
+
+ezSTATUS ezQueue_CreateLocalQueue(ezQueue *queue, uint8_t *buff, uint32_t buff_size)
+{
+    /* The ring uses its buffer only, every queue is local already */
+    return ezQueue_CreateQueue(queue, buff, buff_size);
+}
+
+
+ezSTATUS ezQueue_PopFront(ezQueue *queue)
+{
+    ezSTATUS status = ezSUCCESS;
+    struct ezQueueRecord *record = NULL;
+    uint32_t record_size = 0U;
+
+    EZTRACE("ezQueue_PopFront()");
+
+    if (queue != NULL)
+    {
+        if (queue->num_of_element > 0U)
+        {
+            /* Settled, so the record at the read offset is pushed */
+            record = GET_RECORD(queue, queue->read_offset);
+            record_size = RECORD_SIZE(record->data_size);
+            queue->read_offset = ezQueue_GetNextOffset(queue, queue->read_offset);
+            queue->used_bytes -= record_size;
+            queue->committed_bytes -= record_size;
+            queue->num_of_element--;
+            queue->num_of_byte -= record->data_size;
+            ezQueue_Settle(queue);
+        }
+    }
+    else
+    {
+        status = ezFAIL;
+    }
+
+    return status;
+}
+
+
+ezSTATUS ezQueue_PopBack(ezQueue *queue)
+{
+    ezSTATUS status = ezSUCCESS;
+    struct ezQueueRecord *record = NULL;
+    uint32_t offset = 0U;
+    uint32_t record_size = 0U;
+
+    EZTRACE("ezQueue_PopBack()");
+
+    if (queue != NULL)
+    {
+        record = ezQueue_FindBack(queue);
+        if (record != NULL)
+        {
+            record->state = RECORD_RELEASED;
+            queue->num_of_element--;
+            queue->num_of_byte -= record->data_size;
+
+            /* Give the memory back at once if nothing follows the record */
+            offset = (uint32_t)((uint8_t*)record - queue->buff);
+            if (queue->used_bytes == queue->committed_bytes
+                && ezQueue_GetNextOffset(queue, offset) == queue->write_offset)
+            {
+                record_size = RECORD_SIZE(record->data_size);
+                queue->write_offset = offset;
+                queue->commit_offset = offset;
+                queue->used_bytes -= record_size;
+                queue->committed_bytes -= record_size;
+            }
+
+            ezQueue_Settle(queue);
+        }
+    }
+    else
+    {
+        status = ezFAIL;
+    }
+
+    return status;
+}
+
+
+ezReservedElement ezQueue_ReserveElement(ezQueue *queue, void **data, uint32_t data_size)
+{
+    struct ezQueueRecord *record = NULL;
+    uint32_t offset = 0U;
+
+    EZTRACE("ezQueue_ReserveElement( [@ = %p], [size = %lu])", data, data_size);
+
+    if (queue != NULL && data != NULL && data_size > 0
+        && data_size <= queue->buff_size - RECORD_UNIT
+        && ezQueue_AllocRecord(queue, RECORD_SIZE(data_size), &offset) == true)
+    {
+        record = GET_RECORD(queue, offset);
+        record->data_size = (ezStaticAllocSize)data_size;
+        record->state = RECORD_RESERVED;
+        *data = GET_DATA(record);
+    }
+
+    return (ezReservedElement)record;
+}
+
+
+ezSTATUS ezQueue_PushReservedElement(ezQueue *queue, ezReservedElement element)
+{
+    ezSTATUS status = ezFAIL;
+    struct ezQueueRecord *record = ezQueue_GetReservedRecord(queue, element);
+
+    if (record != NULL)
+    {
+        record->state = RECORD_PUSHED;
+        ezQueue_Settle(queue);
+        status = ezSUCCESS;
+    }
+
+    return status;
+}
+
+
+ezSTATUS ezQueue_ReleaseReservedElement(ezQueue *queue, ezReservedElement element)
+{
+    ezSTATUS status = ezFAIL;
+    struct ezQueueRecord *record = ezQueue_GetReservedRecord(queue, element);
+    uint32_t offset = 0U;
+
+    if (record != NULL)
+    {
+        record->state = RECORD_RELEASED;
+
+        /* The last reserved record gives its memory back at once */
+        offset = (uint32_t)((uint8_t*)record - queue->buff);
+        if (ezQueue_GetNextOffset(queue, offset) == queue->write_offset)
+        {
+            queue->used_bytes -= RECORD_SIZE(record->data_size);
+            queue->write_offset = offset;
+        }
+
+        ezQueue_Settle(queue);
+        status = ezSUCCESS;
+    }
+
+    return status;
+}
+
+
+ezSTATUS ezQueue_Push(ezQueue *queue, void *data, uint32_t data_size)
+{
+    ezSTATUS status = ezFAIL;
+    void *reserve_data = NULL;
+    ezReservedElement reserved_elem = NULL;
+
+    EZTRACE("ezQueue_Push( [@ = %p], [size = %lu])", data, data_size);
+
+    if (data != NULL)
+    {
+        reserved_elem = ezQueue_ReserveElement(queue, &reserve_data, data_size);
+    }
+
+    if (reserved_elem != NULL)
+    {
+        memcpy(reserve_data, data, data_size);
+        status = ezQueue_PushReservedElement(queue, reserved_elem);
+    }
+    else
+    {
+        EZDEBUG("add item fail");
+    }
+
+    return status;
+}
+
+
+uint32_t ezQueue_PushBatch(ezQueue *queue,
+                           void *const data[],
+                           const uint32_t data_size[],
+                           uint32_t num_of_element)
+{
+    uint32_t num_of_pushed = 0;
+    struct ezQueueRecord *record = NULL;
+    void *reserve_data = NULL;
+
+    EZTRACE("ezQueue_PushBatch( [num = %lu])", num_of_element);
+
+    if (queue != NULL && data != NULL && data_size != NULL)
+    {
+        while (num_of_pushed < num_of_element && data[num_of_pushed] != NULL)
+        {
+            record = (struct ezQueueRecord*)ezQueue_ReserveElement(queue,
+                                                                   &reserve_data,
+                                                                   data_size[num_of_pushed]);
+            if (record == NULL)
+            {
+                EZDEBUG("add item fail");
+                break;
+            }
+
+            memcpy(reserve_data, data[num_of_pushed], data_size[num_of_pushed]);
+            record->state = RECORD_PUSHED;
+            num_of_pushed++;
+        }
+
+        /* The whole batch becomes visible at once */
+        ezQueue_Settle(queue);
+    }
+
+    return num_of_pushed;
+}
+
+
+ezSTATUS ezQueue_GetFront(ezQueue *queue, void **data, uint32_t *data_size)
+{
+    ezSTATUS status = ezFAIL;
+    struct ezQueueRecord *record = NULL;
+
+    EZTRACE("ezQueue_GetFront()");
+
+    if (queue != NULL && data != NULL && data_size != NULL && queue->num_of_element > 0U)
+    {
+        record = GET_RECORD(queue, queue->read_offset);
+        *data = GET_DATA(record);
+        *data_size = record->data_size;
+        status = ezSUCCESS;
+    }
+    else
+    {
+        EZDEBUG("get front item fail");
+    }
+
+    return status;
+}
+
+
+ezSTATUS ezQueue_GetBack(ezQueue *queue, void **data, uint32_t *data_size)
+{
+    ezSTATUS status = ezFAIL;
+    struct ezQueueRecord *record = NULL;
+
+    EZTRACE("ezQueue_GetBack()");
+
+    if (queue != NULL && data != NULL && data_size != NULL)
+    {
+        record = ezQueue_FindBack(queue);
+        if (record != NULL)
+        {
+            *data = GET_DATA(record);
+            *data_size = record->data_size;
+            status = ezSUCCESS;
+        }
+    }
+
+    if (status != ezSUCCESS)
+    {
+        EZDEBUG("get back item fail");
+    }
+
+    return status;
+}
+
+
+uint32_t ezQueue_GetFrontBatch(ezQueue *queue,
+                               void *data[],
+                               uint32_t data_size[],
+                               uint32_t max_num_of_element)
+{
+    uint32_t num_of_element = 0;
+    struct ezQueueRecord *record = NULL;
+    uint32_t offset = 0U;
+    uint32_t remain_bytes = 0U;
+
+    EZTRACE("ezQueue_GetFrontBatch()");
+
+    if (queue != NULL && data != NULL && data_size != NULL)
+    {
+        offset = queue->read_offset;
+        remain_bytes = queue->committed_bytes;
+
+        while (remain_bytes > 0U && num_of_element < max_num_of_element)
+        {
+            record = GET_RECORD(queue, offset);
+            if (record->state == RECORD_PUSHED)
+            {
+                data[num_of_element] = GET_DATA(record);
+                data_size[num_of_element] = record->data_size;
+                num_of_element++;
+            }
+
+            remain_bytes -= RECORD_SIZE(record->data_size);
+            offset = ezQueue_GetNextOffset(queue, offset);
+        }
+    }
+
+    return num_of_element;
+}
+
+
+uint32_t ezQueue_PopFrontBatch(ezQueue *queue, uint32_t num_of_element)
+{
+    uint32_t num_of_popped = 0;
+    struct ezQueueRecord *record = NULL;
+    uint32_t record_size = 0U;
+
+    EZTRACE("ezQueue_PopFrontBatch( [num = %lu])", num_of_element);
+
+    if (queue != NULL)
+    {
+        while (num_of_popped < num_of_element && queue->num_of_element > 0U)
+        {
+            /* Released records are dropped, so the record at the read offset is pushed */
+            record = GET_RECORD(queue, queue->read_offset);
+            record_size = RECORD_SIZE(record->data_size);
+            queue->read_offset = ezQueue_GetNextOffset(queue, queue->read_offset);
+            queue->used_bytes -= record_size;
+            queue->committed_bytes -= record_size;
+            queue->num_of_element--;
+            queue->num_of_byte -= record->data_size;
+            num_of_popped++;
+
+            ezQueue_DropReleased(queue);
+        }
+    }
+
+    return num_of_popped;
+}
+
+
+uint32_t ezQueue_GetNumOfElement(ezQueue *queue)
+{
+    uint32_t num_of_element = 0;
+
+    if (queue != NULL)
+    {
+        num_of_element = queue->num_of_element;
+    }
+
+    return num_of_element;
+}
+
+
+uint32_t ezQueue_GetNumOfByte(ezQueue *queue)
+{
+    uint32_t num_of_byte = 0;
+
+    if (queue != NULL)
+    {
+        num_of_byte = queue->num_of_byte;
+    }
+
+    return num_of_byte;
+}
+
+
+bool ezQueue_IsEmpty(ezQueue *queue)
+{
+    return (queue == NULL || queue->num_of_element == 0U);
+}
+
+
+uint32_t ezQueue_IsQueueReady(ezQueue *queue)
+{
+    return (queue != NULL && queue->buff != NULL && queue->buff_size > 0U);
+}
+
+
+/*****************************************************************************
+* Internal functions
+*****************************************************************************/
+
+/*****************************************************************************
+* Function: ezQueue_GetNextOffset
+*//**
+* @brief Return the offset of the record following the record at offset
+*
+* @param    *queue: (IN)queue
+* @param    offset: (IN)offset of a record
+* @return   offset of the next record
+*
+*****************************************************************************/
+static uint32_t ezQueue_GetNextOffset(ezQueue *queue, uint32_t offset)
+{
+    offset += RECORD_SIZE(GET_RECORD(queue, offset)->data_size);
+    if (offset == queue->buff_size)
+    {
+        offset = 0U;
+    }
+
+    return offset;
+}
+
+
+/*****************************************************************************
+* Function: ezQueue_AllocRecord
+*//**
+* @brief Take record_size contiguous bytes at the write offset, or at the
+* start of the buffer if they do not fit before its end
+*
+* @param    *queue: (IN)queue
+* @param    record_size: (IN)size of the record, multiple of RECORD_UNIT
+* @param    *offset: (OUT)offset of the record
+* @return   true if success, false if there is not enough room
+*
+*****************************************************************************/
+static bool ezQueue_AllocRecord(ezQueue *queue, uint32_t record_size, uint32_t *offset)
+{
+    bool is_success = false;
+    uint32_t end_room = 0U;
+    struct ezQueueRecord *padding = NULL;
+
+    if (queue->used_bytes == 0U || queue->write_offset > queue->read_offset)
+    {
+        end_room = queue->buff_size - queue->write_offset;
+        if (record_size <= end_room)
+        {
+            is_success = true;
+        }
+        else if (record_size <= queue->read_offset)
+        {
+            /* Skip the end of the buffer with a released record */
+            padding = GET_RECORD(queue, queue->write_offset);
+            padding->data_size = (ezStaticAllocSize)(end_room - RECORD_UNIT);
+            padding->state = RECORD_RELEASED;
+            queue->used_bytes += end_room;
+            queue->write_offset = 0U;
+            is_success = true;
+        }
+        else
+        {
+            /* Not enough room */
+        }
+    }
+    else if (queue->used_bytes < queue->buff_size
+             && record_size <= queue->read_offset - queue->write_offset)
+    {
+        is_success = true;
+    }
+    else
+    {
+        /* Not enough room */
+    }
+
+    if (is_success == true)
+    {
+        *offset = queue->write_offset;
+        queue->write_offset += record_size;
+        if (queue->write_offset == queue->buff_size)
+        {
+            queue->write_offset = 0U;
+        }
+        queue->used_bytes += record_size;
+    }
+
+    return is_success;
+}
+
+
+/*****************************************************************************
+* Function: ezQueue_Settle
+*//**
+* @brief Move the commit offset over the records which are not reserved
+* anymore, then drop the released records at the front
+*
+* @param    *queue: (IN)queue
+* @return   None
+*
+*****************************************************************************/
+static void ezQueue_Settle(ezQueue *queue)
+{
+    struct ezQueueRecord *record = NULL;
+
+    while (queue->used_bytes > queue->committed_bytes)
+    {
+        record = GET_RECORD(queue, queue->commit_offset);
+        if (record->state == RECORD_RESERVED)
+        {
+            break;
+        }
+
+        if (record->state == RECORD_PUSHED)
+        {
+            queue->num_of_element++;
+            queue->num_of_byte += record->data_size;
+        }
+        queue->committed_bytes += RECORD_SIZE(record->data_size);
+        queue->commit_offset = ezQueue_GetNextOffset(queue, queue->commit_offset);
+    }
+
+    ezQueue_DropReleased(queue);
+}
+
+
+/*****************************************************************************
+* Function: ezQueue_DropReleased
+*//**
+* @brief Drop the released records at the front
+*
+* @param    *queue: (IN)queue
+* @return   None
+*
+*****************************************************************************/
+static void ezQueue_DropReleased(ezQueue *queue)
+{
+    struct ezQueueRecord *record = NULL;
+    uint32_t record_size = 0U;
+
+    while (queue->committed_bytes > 0U)
+    {
+        record = GET_RECORD(queue, queue->read_offset);
+        if (record->state == RECORD_PUSHED)
+        {
+            break;
+        }
+
+        record_size = RECORD_SIZE(record->data_size);
+        queue->committed_bytes -= record_size;
+        queue->used_bytes -= record_size;
+        queue->read_offset = ezQueue_GetNextOffset(queue, queue->read_offset);
+    }
+
+    if (queue->used_bytes == 0U)
+    {
+        /* Start over, so the largest element fits again */
+        queue->read_offset = 0U;
+        queue->commit_offset = 0U;
+        queue->write_offset = 0U;
+    }
+}
+
+
+/*****************************************************************************
+* Function: ezQueue_FindBack
+*//**
+* @brief Return the last pushed record
+*
+* @param    *queue: (IN)queue
+* @return   record or NULL if the queue is empty
+*
+*****************************************************************************/
+static struct ezQueueRecord *ezQueue_FindBack(ezQueue *queue)
+{
+    struct ezQueueRecord *back = NULL;
+    struct ezQueueRecord *record = NULL;
+    uint32_t offset = queue->read_offset;
+    uint32_t remain_bytes = queue->committed_bytes;
+
+    while (remain_bytes > 0U)
+    {
+        record = GET_RECORD(queue, offset);
+        if (record->state == RECORD_PUSHED)
+        {
+            back = record;
+        }
+
+        remain_bytes -= RECORD_SIZE(record->data_size);
+        offset = ezQueue_GetNextOffset(queue, offset);
+    }
+
+    return back;
+}
+
+
+/*****************************************************************************
+* Function: ezQueue_GetReservedRecord
+*//**
+* @brief Return the record of a reserved element
+*
+* @param    *queue: (IN)queue
+* @param    element: (IN)reserved element
+* @return   record or NULL if element is not a reserved element of the queue
+*
+*****************************************************************************/
+static struct ezQueueRecord *ezQueue_GetReservedRecord(ezQueue *queue, ezReservedElement element)
+{
+    struct ezQueueRecord *record = NULL;
+    uint8_t *address = (uint8_t*)element;
+
+    if (queue != NULL && address != NULL
+        && address >= queue->buff
+        && address < queue->buff + queue->buff_size
+        && ((uint32_t)(address - queue->buff) % RECORD_UNIT) == 0U
+        && ((struct ezQueueRecord*)address)->state == RECORD_RESERVED)
+    {
+        record = (struct ezQueueRecord*)address;
+    }
+
+    return record;
+}
+
+#endif /* (EZ_QUEUE == 1U) && (EZ_QUEUE_RING == 1U) */
+/* End of file */
@@ -50,13 +50,20 @@
 /*****************************************************************************
 * Function Definitions
 *****************************************************************************/
-/* None */
+static void ezRingBuffer_GetSpans(RingBuffer *ring_buff,
+                                  ezRingBufferSize start_index,
+                                  ezRingBufferSize size,
+                                  ezRingBufferSpan spans[2]);
+static ezRingBufferSize ezRingBuffer_Advance(RingBuffer *ring_buff,
+                                             ezRingBufferSize index,
+                                             ezRingBufferSize size);
+static bool ezRingBuffer_DropRecord(RingBuffer *ring_buff);
 
 
 /*****************************************************************************
 * Public functions
 *****************************************************************************/
-bool ezRingBuffer_Init(RingBuffer *ring_buff, uint8_t *buff, uint16_t size)
+bool ezRingBuffer_Init(RingBuffer *ring_buff, uint8_t *buff, ezRingBufferSize size)
 {
     bool ret = false;
     if(buff != NULL && size > 0)
@@ -66,6 +73,7 @@ bool ezRingBuffer_Init(RingBuffer *ring_buff, uint8_t *buff, uint16_t size)
         ring_buff->written_byte_count = 0;
         ring_buff->buff = buff;
         ring_buff->capacity = size;
+        ring_buff->mask = ((size & (size - 1U)) == 0U) ? (ezRingBufferSize)(size - 1U) : 0U;
         ret = true;
     }
     return ret;
@@ -84,10 +92,10 @@ bool ezRingBuffer_IsFull(RingBuffer * ring_buff)
 }
 
 
-uint16_t ezRingBuffer_Push(RingBuffer * ring_buff, uint8_t *data, uint16_t size)
+ezRingBufferSize ezRingBuffer_Push(RingBuffer * ring_buff, uint8_t *data, ezRingBufferSize size)
 {
-    uint16_t remain_byte_count = 0U;
-    uint16_t push_byte_count = ring_buff->capacity - ring_buff->written_byte_count;
+    ezRingBufferSize remain_byte_count = 0U;
+    ezRingBufferSize push_byte_count = ring_buff->capacity - ring_buff->written_byte_count;
 
     if(push_byte_count >= size)
     {
@@ -119,11 +127,11 @@ uint16_t ezRingBuffer_Push(RingBuffer * ring_buff, uint8_t *data, uint16_t size)
 }
 
 
-uint16_t ezRingBuffer_Pop(RingBuffer *ring_buff, uint8_t *data, uint16_t size)
+ezRingBufferSize ezRingBuffer_Pop(RingBuffer *ring_buff, uint8_t *data, ezRingBufferSize size)
 {
 
-    uint16_t popped_byte_count = size;
-    uint16_t remained_byte_count = 0U;
+    ezRingBufferSize popped_byte_count = size;
+    ezRingBufferSize remained_byte_count = 0U;
 
     if(ring_buff->written_byte_count < popped_byte_count)
     {
@@ -165,11 +173,212 @@ void ezRingBuffer_Reset(RingBuffer * ring_buff)
 }
 
 
-uint16_t ezRingBuffer_GetAvailableMemory(RingBuffer *ring_buff)
+ezRingBufferSize ezRingBuffer_GetAvailableMemory(RingBuffer *ring_buff)
 {
     return ring_buff->capacity - ring_buff->written_byte_count;
 }
 
+
+
+ezRingBufferSize ezRingBuffer_Peek(RingBuffer *ring_buff, ezRingBufferSpan spans[2])
+{
+    ezRingBuffer_GetSpans(ring_buff,
+                          ring_buff->tail_index,
+                          ring_buff->written_byte_count,
+                          spans);
+    return ring_buff->written_byte_count;
+}
+
+
+ezRingBufferSize ezRingBuffer_Consume(RingBuffer *ring_buff, ezRingBufferSize size)
+{
+    if(size > ring_buff->written_byte_count)
+    {
+        size = ring_buff->written_byte_count;
+    }
+
+    ring_buff->tail_index = ezRingBuffer_Advance(ring_buff, ring_buff->tail_index, size);
+    ring_buff->written_byte_count = ring_buff->written_byte_count - size;
+
+    return size;
+}
+
+
+ezRingBufferSize ezRingBuffer_Claim(RingBuffer *ring_buff, ezRingBufferSpan spans[2])
+{
+    ezRingBufferSize free_byte_count = ring_buff->capacity - ring_buff->written_byte_count;
+
+    ezRingBuffer_GetSpans(ring_buff, ring_buff->head_index, free_byte_count, spans);
+    return free_byte_count;
+}
+
+
+ezRingBufferSize ezRingBuffer_Commit(RingBuffer *ring_buff, ezRingBufferSize size)
+{
+    ezRingBufferSize free_byte_count = ring_buff->capacity - ring_buff->written_byte_count;
+
+    if(size > free_byte_count)
+    {
+        size = free_byte_count;
+    }
+
+    ring_buff->head_index = ezRingBuffer_Advance(ring_buff, ring_buff->head_index, size);
+    ring_buff->written_byte_count = ring_buff->written_byte_count + size;
+
+    return size;
+}
+
+
+ezRingBufferSize ezRingBuffer_PushOverwrite(RingBuffer *ring_buff, uint8_t *data, ezRingBufferSize size)
+{
+    ezRingBufferSize free_byte_count = 0U;
+
+    if(size > ring_buff->capacity)
+    {
+        /* Only the newest part fits */
+        data = data + (size - ring_buff->capacity);
+        size = ring_buff->capacity;
+    }
+
+    free_byte_count = ring_buff->capacity - ring_buff->written_byte_count;
+    if(size > free_byte_count)
+    {
+        (void)ezRingBuffer_Consume(ring_buff, size - free_byte_count);
+    }
+
+    return ezRingBuffer_Push(ring_buff, data, size);
+}
+
+
+bool ezRingBuffer_PushRecord(RingBuffer *ring_buff, uint8_t *data, ezRingBufferSize size, bool overwrite)
+{
+    bool ret = false;
+    bool has_room = false;
+
+    if(data != NULL && size > 0U
+       && ring_buff->capacity >= EZ_RING_BUFFER_RECORD_HEADER_SIZE
+       && size <= ring_buff->capacity - EZ_RING_BUFFER_RECORD_HEADER_SIZE)
+    {
+        has_room = (ezRingBuffer_GetAvailableMemory(ring_buff) >= size + EZ_RING_BUFFER_RECORD_HEADER_SIZE);
+        while(has_room == false && overwrite == true && ezRingBuffer_DropRecord(ring_buff) == true)
+        {
+            has_room = (ezRingBuffer_GetAvailableMemory(ring_buff) >= size + EZ_RING_BUFFER_RECORD_HEADER_SIZE);
+        }
+
+        if(has_room == true)
+        {
+            (void)ezRingBuffer_Push(ring_buff, (uint8_t*)&size, EZ_RING_BUFFER_RECORD_HEADER_SIZE);
+            (void)ezRingBuffer_Push(ring_buff, data, size);
+            ret = true;
+        }
+    }
+
+    return ret;
+}
+
+
+ezRingBufferSize ezRingBuffer_GetRecordSize(RingBuffer *ring_buff)
+{
+    ezRingBufferSize record_size = 0U;
+    ezRingBufferSpan spans[2];
+    uint8_t *header = (uint8_t*)&record_size;
+
+    if(ezRingBuffer_Peek(ring_buff, spans) >= EZ_RING_BUFFER_RECORD_HEADER_SIZE)
+    {
+        /* The header may wrap */
+        if(spans[0].size >= EZ_RING_BUFFER_RECORD_HEADER_SIZE)
+        {
+            memcpy(header, spans[0].data, EZ_RING_BUFFER_RECORD_HEADER_SIZE);
+        }
+        else
+        {
+            memcpy(header, spans[0].data, spans[0].size);
+            memcpy(header + spans[0].size, spans[1].data,
+                   EZ_RING_BUFFER_RECORD_HEADER_SIZE - spans[0].size);
+        }
+    }
+
+    return record_size;
+}
+
+
+ezRingBufferSize ezRingBuffer_PopRecord(RingBuffer *ring_buff, uint8_t *data, ezRingBufferSize size)
+{
+    ezRingBufferSize record_size = ezRingBuffer_GetRecordSize(ring_buff);
+
+    if(record_size > 0U && record_size <= size && data != NULL)
+    {
+        (void)ezRingBuffer_Consume(ring_buff, EZ_RING_BUFFER_RECORD_HEADER_SIZE);
+        (void)ezRingBuffer_Pop(ring_buff, data, record_size);
+    }
+    else
+    {
+        record_size = 0U;
+    }
+
+    return record_size;
+}
+
+
+/*****************************************************************************
+* Internal functions
+*****************************************************************************/
+static void ezRingBuffer_GetSpans(RingBuffer *ring_buff,
+                                  ezRingBufferSize start_index,
+                                  ezRingBufferSize size,
+                                  ezRingBufferSpan spans[2])
+{
+    ezRingBufferSize first_size = ring_buff->capacity - start_index;
+
+    if(first_size > size)
+    {
+        first_size = size;
+    }
+
+    spans[0].data = (first_size > 0U) ? &ring_buff->buff[start_index] : NULL;
+    spans[0].size = first_size;
+    spans[1].data = (size > first_size) ? ring_buff->buff : NULL;
+    spans[1].size = size - first_size;
+}
+
+
+static ezRingBufferSize ezRingBuffer_Advance(RingBuffer *ring_buff,
+                                             ezRingBufferSize index,
+                                             ezRingBufferSize size)
+{
+    if(ring_buff->mask != 0U)
+    {
+        index = (index + size) & ring_buff->mask;
+    }
+    else if(size >= ring_buff->capacity - index)
+    {
+        /* Written this way so the sum cannot overflow ezRingBufferSize */
+        index = size - (ring_buff->capacity - index);
+    }
+    else
+    {
+        index = index + size;
+    }
+
+    return index;
+}
+
+
+static bool ezRingBuffer_DropRecord(RingBuffer *ring_buff)
+{
+    bool ret = false;
+    ezRingBufferSize record_size = ezRingBuffer_GetRecordSize(ring_buff);
+
+    if(record_size > 0U)
+    {
+        (void)ezRingBuffer_Consume(ring_buff, EZ_RING_BUFFER_RECORD_HEADER_SIZE);
+        (void)ezRingBuffer_Consume(ring_buff, record_size);
+        ret = true;
+    }
+
+    return ret;
+}
+
 #endif /* CONFIG_RING_BUFFER */
 
 /* End of file */
@@ -37,32 +37,67 @@ extern "C" {
 
 #include <stdint.h>
 #include <stdbool.h>
+#include <string.h>
 
 /*****************************************************************************
 * Component Preprocessor Macros
 *****************************************************************************/
-/* None */
+/* Use 32-bit sizes and indexes, so the capacity can exceed 64 KiB */
+#ifndef EZ_RING_BUFFER_32BIT
+#define EZ_RING_BUFFER_32BIT    0U
+#endif /* EZ_RING_BUFFER_32BIT */
+
+#if (EZ_RING_BUFFER_32BIT == 1U)
+#define EZ_RING_BUFFER_SIZE_MAX UINT32_MAX
+#else
+#define EZ_RING_BUFFER_SIZE_MAX UINT16_MAX
+#endif /* EZ_RING_BUFFER_32BIT == 1U */
+
+/* Size of the header storing the size of a record */
+#define EZ_RING_BUFFER_RECORD_HEADER_SIZE   sizeof(ezRingBufferSize)
 
 /*****************************************************************************
 * Component Typedefs
 *****************************************************************************/
+/** @brief Size and index type, selected by EZ_RING_BUFFER_32BIT
+ */
+#if (EZ_RING_BUFFER_32BIT == 1U)
+typedef uint32_t ezRingBufferSize;
+#else
+typedef uint16_t ezRingBufferSize;
+#endif /* EZ_RING_BUFFER_32BIT == 1U */
+
+
 /** @brief Data structure of a ring buffer
  */
 typedef struct
 {
     uint8_t *buff;
     /**< pointer to the data buffer*/
-    uint16_t capacity;
+    ezRingBufferSize capacity;
     /**< size of the buffer*/
-    uint16_t head_index;
+    ezRingBufferSize head_index;
     /**< buffer head*/
-    uint16_t tail_index;
+    ezRingBufferSize tail_index;
     /**< buffer tail*/
-    uint16_t written_byte_count;
+    ezRingBufferSize written_byte_count;
     /**< number of byte written*/
+    ezRingBufferSize mask;
+    /**< capacity - 1 if the capacity is a power of two, else 0 */
 }RingBuffer;
 
 
+/** @brief Contiguous region of the ring buffer memory
+ */
+typedef struct
+{
+    uint8_t *data;
+    /**< start of the region, NULL if the region is empty */
+    ezRingBufferSize size;
+    /**< number of bytes in the region */
+}ezRingBufferSpan;
+
+
 /*****************************************************************************
 * Component Variable Definitions
 *****************************************************************************/
@@ -77,7 +112,9 @@ typedef struct
 *//** 
 * @brief This function initializes the ring buffer
 *
-* @details
+* @details A capacity which is a power of two lets the indexes wrap with a
+* mask instead of a compare, which speeds up the single byte and word
+* functions.
 *
 * @param[in]    ring_buff: pointer to the ring buffer
 * @param[in]    buff: pointer of buffer holding data
@@ -96,7 +133,7 @@ typedef struct
 * @see
 *
 *****************************************************************************/
-bool ezRingBuffer_Init(RingBuffer *ring_buff, uint8_t *buff, uint16_t size);
+bool ezRingBuffer_Init(RingBuffer *ring_buff, uint8_t *buff, ezRingBufferSize size);
 
 
 /*****************************************************************************
@@ -179,7 +216,7 @@ bool ezRingBuffer_IsFull(RingBuffer *ring_buff);
 * @see ezRingBuffer_Init
 *
 *****************************************************************************/
-uint16_t ezRingBuffer_Push(RingBuffer * ring_buff, uint8_t *data, uint16_t size);
+ezRingBufferSize ezRingBuffer_Push(RingBuffer * ring_buff, uint8_t *data, ezRingBufferSize size);
 
 
 /*****************************************************************************
@@ -208,7 +245,7 @@ uint16_t ezRingBuffer_Push(RingBuffer * ring_buff, uint8_t *data, uint16_t size)
 * @see ezRingBuffer_Init
 *
 *****************************************************************************/
-uint16_t ezRingBuffer_Pop(RingBuffer *ring_buff, uint8_t *data, uint16_t size);
+ezRingBufferSize ezRingBuffer_Pop(RingBuffer *ring_buff, uint8_t *data, ezRingBufferSize size);
 
 
 /*****************************************************************************
@@ -256,7 +293,451 @@ void ezRingBuffer_Reset(RingBuffer *ring_buff);
 * @see RingBuffer_Init
 *
 *****************************************************************************/
-uint16_t ezRingBuffer_GetAvailableMemory( RingBuffer *ring_buff);
+ezRingBufferSize ezRingBuffer_GetAvailableMemory( RingBuffer *ring_buff);
+
+/*****************************************************************************
+* Function : ezRingBuffer_Peek
+*//** 
+* @brief Return the stored data as up to two contiguous regions, without
+* copying it
+*
+* @details spans[0] starts at the oldest byte. spans[1] starts at the
+* beginning of the buffer and is only used when the data wraps, otherwise
+* its size is 0. The data stays in the ring buffer until
+* ezRingBuffer_Consume is called.
+*
+* @param[in]    ring_buff: pointer to the ring buffer
+* @param[out]   spans: two spans receiving the readable regions
+* @return       Number of readable bytes, sum of both span sizes
+*
+* @pre a RingBuffer is exsiting
+* @post None
+*
+* \b Example
+* @code
+* ezRingBufferSpan spans[2];
+* ezRingBufferSize count = ezRingBuffer_Peek(&buffer, spans);
+* ezRingBufferSize parsed = Parse(spans[0].data, spans[0].size);
+* ezRingBuffer_Consume(&buffer, parsed);
+* @endcode
+*
+* @see ezRingBuffer_Consume
+*
+*****************************************************************************/
+ezRingBufferSize ezRingBuffer_Peek(RingBuffer *ring_buff, ezRingBufferSpan spans[2]);
+
+
+/*****************************************************************************
+* Function : ezRingBuffer_Consume
+*//** 
+* @brief Drop data from the ring buffer after it has been read in place
+*
+* @details
+*
+* @param[in]    ring_buff: pointer to the ring buffer
+* @param[in]    size: number of bytes to drop
+* @return       Number of bytes dropped, at most the number of stored bytes
+*
+* @pre a RingBuffer is exsiting
+* @post None
+*
+* \b Example
+* @code
+* ezRingBuffer_Consume(&buffer, spans[0].size);
+* @endcode
+*
+* @see ezRingBuffer_Peek
+*
+*****************************************************************************/
+ezRingBufferSize ezRingBuffer_Consume(RingBuffer *ring_buff, ezRingBufferSize size);
+
+
+/*****************************************************************************
+* Function : ezRingBuffer_Claim
+*//** 
+* @brief Return the free memory as up to two contiguous regions, so data can
+* be written in place, e.g. by a DMA
+*
+* @details spans[0] starts at the write position. spans[1] starts at the
+* beginning of the buffer and is only used when the free memory wraps,
+* otherwise its size is 0. The written data is only stored after
+* ezRingBuffer_Commit is called.
+*
+* @param[in]    ring_buff: pointer to the ring buffer
+* @param[out]   spans: two spans receiving the writable regions
+* @return       Number of writable bytes, sum of both span sizes
+*
+* @pre a RingBuffer is exsiting
+* @post None
+*
+* \b Example
+* @code
+* ezRingBufferSpan spans[2];
+* ezRingBuffer_Claim(&buffer, spans);
+* StartDmaRx(spans[0].data, spans[0].size);
+* ...
+* ezRingBuffer_Commit(&buffer, received_byte_count);
+* @endcode
+*
+* @see ezRingBuffer_Commit
+*
+*****************************************************************************/
+ezRingBufferSize ezRingBuffer_Claim(RingBuffer *ring_buff, ezRingBufferSpan spans[2]);
+
+
+/*****************************************************************************
+* Function : ezRingBuffer_Commit
+*//** 
+* @brief Store data which has been written in place
+*
+* @details
+*
+* @param[in]    ring_buff: pointer to the ring buffer
+* @param[in]    size: number of bytes written from the start of spans[0]
+* @return       Number of bytes stored, at most the available memory
+*
+* @pre a RingBuffer is exsiting
+* @post None
+*
+* \b Example
+* @code
+* ezRingBuffer_Commit(&buffer, received_byte_count);
+* @endcode
+*
+* @see ezRingBuffer_Claim
+*
+*****************************************************************************/
+ezRingBufferSize ezRingBuffer_Commit(RingBuffer *ring_buff, ezRingBufferSize size);
+
+
+/*****************************************************************************
+* Function : ezRingBuffer_PushOverwrite
+*//** 
+* @brief Push data into the ring buffer, dropping the oldest data if the
+* buffer does not have enough room
+*
+* @details For telemetry and log streams, where the newest data matters
+* most. If size exceeds the capacity, only the last capacity bytes of data
+* are kept.
+*
+* @param[in]    ring_buff: pointer to the ring buffer
+* @param[in]    data: pointer to the pushed data
+* @param[in]    size: size of the data
+* @return       Number of bytes pushed into the ring buffer
+*
+* @pre a RingBuffer is exsiting
+* @post None
+*
+* \b Example
+* @code
+* ezRingBuffer_PushOverwrite(&log_buffer, line, line_len);
+* @endcode
+*
+* @see ezRingBuffer_Push
+*
+*****************************************************************************/
+ezRingBufferSize ezRingBuffer_PushOverwrite(RingBuffer *ring_buff, uint8_t *data, ezRingBufferSize size);
+
+
+/*****************************************************************************
+* Function : ezRingBuffer_PushRecord
+*//** 
+* @brief Push a record, i.e. a message whose boundary is kept
+*
+* @details The record is stored with a header of
+* EZ_RING_BUFFER_RECORD_HEADER_SIZE bytes holding its size. It is pushed
+* completely or not at all. A ring buffer used for records must only be
+* accessed with the record functions.
+*
+* @param[in]    ring_buff: pointer to the ring buffer
+* @param[in]    data: pointer to the record
+* @param[in]    size: size of the record, must not be 0
+* @param[in]    overwrite: true to drop the oldest records if there is not
+*                          enough room, false to fail in that case
+* @return       true if success, else false
+*
+* @pre a RingBuffer is exsiting
+* @post None
+*
+* \b Example
+* @code
+* ezRingBuffer_PushRecord(&buffer, (uint8_t*)&frame, frame_size, false);
+* @endcode
+*
+* @see ezRingBuffer_PopRecord
+*
+*****************************************************************************/
+bool ezRingBuffer_PushRecord(RingBuffer *ring_buff, uint8_t *data, ezRingBufferSize size, bool overwrite);
+
+
+/*****************************************************************************
+* Function : ezRingBuffer_GetRecordSize
+*//** 
+* @brief Return the size of the oldest record
+*
+* @details
+*
+* @param[in]    ring_buff: pointer to the ring buffer
+* @return       Size of the oldest record, 0 if there is no record
+*
+* @pre a RingBuffer is exsiting
+* @post None
+*
+* \b Example
+* @code
+* ezRingBufferSize size = ezRingBuffer_GetRecordSize(&buffer);
+* @endcode
+*
+* @see ezRingBuffer_PopRecord
+*
+*****************************************************************************/
+ezRingBufferSize ezRingBuffer_GetRecordSize(RingBuffer *ring_buff);
+
+
+/*****************************************************************************
+* Function : ezRingBuffer_PopRecord
+*//** 
+* @brief Pop the oldest record out of the ring buffer
+*
+* @details If data is too small for the record, the record stays in the
+* ring buffer
+*
+* @param[in]    ring_buff: pointer to the ring buffer
+* @param[out]   data: pointer to the popped record
+* @param[in]    size: size of data
+* @return       Size of the popped record, 0 if nothing is popped
+*
+* @pre a RingBuffer is exsiting
+* @post None
+*
+* \b Example
+* @code
+* uint8_t frame[64];
+* ezRingBufferSize frame_size = ezRingBuffer_PopRecord(&buffer, frame, sizeof(frame));
+* @endcode
+*
+* @see ezRingBuffer_PushRecord
+*
+*****************************************************************************/
+ezRingBufferSize ezRingBuffer_PopRecord(RingBuffer *ring_buff, uint8_t *data, ezRingBufferSize size);
+
+
+/*****************************************************************************
+* Function : ezRingBuffer_NextIndex
+*//** 
+* @brief Return the index following index
+*
+* @details Helper function used by the inline functions. The user are not
+*          supposed to used this function
+*
+* @param[in]    ring_buff: pointer to the ring buffer
+* @param[in]    index: head or tail index
+* @return       Next index, wrapped at the capacity
+*
+* @pre None
+* @post None
+*
+* \b Example
+* @code
+* @endcode
+*
+* @see
+*
+*****************************************************************************/
+static inline ezRingBufferSize ezRingBuffer_NextIndex(RingBuffer *ring_buff,
+                                                      ezRingBufferSize index)
+{
+    index++;
+    if(ring_buff->mask != 0U)
+    {
+        index = index & ring_buff->mask;
+    }
+    else if(index == ring_buff->capacity)
+    {
+        index = 0U;
+    }
+    else
+    {
+        /* Not wrapped */
+    }
+
+    return index;
+}
+
+
+/*****************************************************************************
+* Function : ezRingBuffer_PushByte
+*//** 
+* @brief Push a single byte into the ring buffer
+*
+* @details Inline fast path of ezRingBuffer_Push for one byte
+*
+* @param[in]    ring_buff: pointer to the ring buffer
+* @param[in]    byte: byte to be pushed
+* @return       true if success, false if the buffer is full
+*
+* @pre a RingBuffer is exsiting
+* @post None
+*
+* \b Example
+* @code
+* ezRingBuffer_PushByte(&buffer, 0x55U);
+* @endcode
+*
+* @see ezRingBuffer_Push
+*
+*****************************************************************************/
+static inline bool ezRingBuffer_PushByte(RingBuffer *ring_buff, uint8_t byte)
+{
+    bool ret = false;
+    if(ring_buff->written_byte_count < ring_buff->capacity)
+    {
+        ring_buff->buff[ring_buff->head_index] = byte;
+        ring_buff->head_index = ezRingBuffer_NextIndex(ring_buff, ring_buff->head_index);
+        ring_buff->written_byte_count++;
+        ret = true;
+    }
+    return ret;
+}
+
+
+/*****************************************************************************
+* Function : ezRingBuffer_PopByte
+*//** 
+* @brief Pop a single byte out of the ring buffer
+*
+* @details Inline fast path of ezRingBuffer_Pop for one byte
+*
+* @param[in]    ring_buff: pointer to the ring buffer
+* @param[out]   byte: popped byte
+* @return       true if success, false if the buffer is empty
+*
+* @pre a RingBuffer is exsiting
+* @post None
+*
+* \b Example
+* @code
+* uint8_t byte;
+* if(ezRingBuffer_PopByte(&buffer, &byte)) { ... }
+* @endcode
+*
+* @see ezRingBuffer_Pop
+*
+*****************************************************************************/
+static inline bool ezRingBuffer_PopByte(RingBuffer *ring_buff, uint8_t *byte)
+{
+    bool ret = false;
+    if(ring_buff->written_byte_count > 0U)
+    {
+        *byte = ring_buff->buff[ring_buff->tail_index];
+        ring_buff->tail_index = ezRingBuffer_NextIndex(ring_buff, ring_buff->tail_index);
+        ring_buff->written_byte_count--;
+        ret = true;
+    }
+    return ret;
+}
+
+
+/*****************************************************************************
+* Function : ezRingBuffer_PushWord
+*//** 
+* @brief Push a 32-bit word into the ring buffer, in native byte order
+*
+* @details The word is pushed completely or not at all
+*
+* @param[in]    ring_buff: pointer to the ring buffer
+* @param[in]    word: word to be pushed
+* @return       true if success, false if less than 4 bytes are free
+*
+* @pre a RingBuffer is exsiting
+* @post None
+*
+* \b Example
+* @code
+* ezRingBuffer_PushWord(&buffer, timestamp);
+* @endcode
+*
+* @see ezRingBuffer_PopWord
+*
+*****************************************************************************/
+static inline bool ezRingBuffer_PushWord(RingBuffer *ring_buff, uint32_t word)
+{
+    bool ret = false;
+    uint8_t *bytes = (uint8_t*)&word;
+    uint8_t i = 0;
+
+    if((uint32_t)ring_buff->capacity - ring_buff->written_byte_count >= sizeof(word))
+    {
+        if((uint32_t)ring_buff->capacity - ring_buff->head_index > sizeof(word))
+        {
+            memcpy(&ring_buff->buff[ring_buff->head_index], &word, sizeof(word));
+            ring_buff->head_index = ring_buff->head_index + sizeof(word);
+        }
+        else
+        {
+            /* Wraps, or ends exactly at the end of the buffer */
+            for(i = 0; i < sizeof(word); i++)
+            {
+                ring_buff->buff[ring_buff->head_index] = bytes[i];
+                ring_buff->head_index = ezRingBuffer_NextIndex(ring_buff, ring_buff->head_index);
+            }
+        }
+        ring_buff->written_byte_count = ring_buff->written_byte_count + sizeof(word);
+        ret = true;
+    }
+    return ret;
+}
+
+
+/*****************************************************************************
+* Function : ezRingBuffer_PopWord
+*//** 
+* @brief Pop a 32-bit word out of the ring buffer, in native byte order
+*
+* @details The word is popped completely or not at all
+*
+* @param[in]    ring_buff: pointer to the ring buffer
+* @param[out]   word: popped word
+* @return       true if success, false if less than 4 bytes are stored
+*
+* @pre a RingBuffer is exsiting
+* @post None
+*
+* \b Example
+* @code
+* uint32_t timestamp;
+* ezRingBuffer_PopWord(&buffer, &timestamp);
+* @endcode
+*
+* @see ezRingBuffer_PushWord
+*
+*****************************************************************************/
+static inline bool ezRingBuffer_PopWord(RingBuffer *ring_buff, uint32_t *word)
+{
+    bool ret = false;
+    uint8_t *bytes = (uint8_t*)word;
+    uint8_t i = 0;
+
+    if(ring_buff->written_byte_count >= sizeof(*word))
+    {
+        if((uint32_t)ring_buff->capacity - ring_buff->tail_index > sizeof(*word))
+        {
+            memcpy(word, &ring_buff->buff[ring_buff->tail_index], sizeof(*word));
+            ring_buff->tail_index = ring_buff->tail_index + sizeof(*word);
+        }
+        else
+        {
+            for(i = 0; i < sizeof(*word); i++)
+            {
+                bytes[i] = ring_buff->buff[ring_buff->tail_index];
+                ring_buff->tail_index = ezRingBuffer_NextIndex(ring_buff, ring_buff->tail_index);
+            }
+        }
+        ring_buff->written_byte_count = ring_buff->written_byte_count - sizeof(*word);
+        ret = true;
+    }
+    return ret;
+}
 
 #ifdef __cplusplus
 }
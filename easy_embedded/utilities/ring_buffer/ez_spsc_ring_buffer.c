@@ -0,0 +1,175 @@
+/*****************************************************************************
+* Filename:         ez_spsc_ring_buffer.c
+* Author:           Hai Nguyen
+* Original Date:    18.10.2026
+*
+* ----------------------------------------------------------------------------
+* Contact:          Hai Nguyen
+*                   hainguyen.eeit@gmail.com
+*
+* ----------------------------------------------------------------------------
+* License: This file is published under the license described in LICENSE.md
+*
+*****************************************************************************/
+
+/** @file   ez_spsc_ring_buffer.c
+ *  @author Hai Nguyen
+ *  @date   18.10.2026
+ *  @brief  Implementation of the lock-free single producer single consumer
+ *          ring buffer
+ *
+ *  @details
+ */
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include "ez_spsc_ring_buffer.h"
+
+#if (EZ_SPSC_RING_BUFFER == 1U)
+#include <string.h>
+
+
+/*****************************************************************************
+* Component Preprocessor Macros
+*****************************************************************************/
+#define CAPACITY(ring_buff)     ((ring_buff)->mask + 1U)
+
+
+/*****************************************************************************
+* Component Typedefs
+*****************************************************************************/
+/* None */
+
+
+/*****************************************************************************
+* Component Variable Definitions
+*****************************************************************************/
+/* None */
+
+
+/*****************************************************************************
+* Function Definitions
+*****************************************************************************/
+/* None */
+
+
+/*****************************************************************************
+* Public functions
+*****************************************************************************/
+bool ezSpscRingBuffer_Init(ezSpscRingBuffer *ring_buff, uint8_t *buff, uint32_t size)
+{
+    bool ret = false;
+
+    /* Free-running counters need a power of two no larger than half their range */
+    if (ring_buff != NULL && buff != NULL && size > 0U
+        && (size & (size - 1U)) == 0U && size <= 0x80000000UL)
+    {
+        atomic_init(&ring_buff->head, 0U);
+        atomic_init(&ring_buff->tail, 0U);
+        ring_buff->cached_tail = 0U;
+        ring_buff->cached_head = 0U;
+        ring_buff->buff = buff;
+        ring_buff->mask = size - 1U;
+        ret = true;
+    }
+
+    return ret;
+}
+
+
+uint32_t ezSpscRingBuffer_Push(ezSpscRingBuffer *ring_buff, const uint8_t *data, uint32_t size)
+{
+    uint32_t head = atomic_load_explicit(&ring_buff->head, memory_order_relaxed);
+    uint32_t free_byte_count = CAPACITY(ring_buff) - (head - ring_buff->cached_tail);
+    uint32_t index = 0U;
+    uint32_t first_part = 0U;
+
+    if (free_byte_count < size)
+    {
+        /* Only read the index of the consumer when the cached one is not enough */
+        ring_buff->cached_tail = atomic_load_explicit(&ring_buff->tail, memory_order_acquire);
+        free_byte_count = CAPACITY(ring_buff) - (head - ring_buff->cached_tail);
+    }
+
+    if (size > free_byte_count)
+    {
+        size = free_byte_count;
+    }
+
+    if (size > 0U)
+    {
+        index = head & ring_buff->mask;
+        first_part = CAPACITY(ring_buff) - index;
+        if (first_part > size)
+        {
+            first_part = size;
+        }
+
+        memcpy(&ring_buff->buff[index], data, first_part);
+        memcpy(ring_buff->buff, data + first_part, size - first_part);
+
+        /* Data must be visible before the consumer sees the new head */
+        atomic_store_explicit(&ring_buff->head, head + size, memory_order_release);
+    }
+
+    return size;
+}
+
+
+uint32_t ezSpscRingBuffer_Pop(ezSpscRingBuffer *ring_buff, uint8_t *data, uint32_t size)
+{
+    uint32_t tail = atomic_load_explicit(&ring_buff->tail, memory_order_relaxed);
+    uint32_t byte_count = ring_buff->cached_head - tail;
+    uint32_t index = 0U;
+    uint32_t first_part = 0U;
+
+    if (byte_count < size)
+    {
+        /* Only read the index of the producer when the cached one is not enough */
+        ring_buff->cached_head = atomic_load_explicit(&ring_buff->head, memory_order_acquire);
+        byte_count = ring_buff->cached_head - tail;
+    }
+
+    if (size > byte_count)
+    {
+        size = byte_count;
+    }
+
+    if (size > 0U)
+    {
+        index = tail & ring_buff->mask;
+        first_part = CAPACITY(ring_buff) - index;
+        if (first_part > size)
+        {
+            first_part = size;
+        }
+
+        memcpy(data, &ring_buff->buff[index], first_part);
+        memcpy(data + first_part, ring_buff->buff, size - first_part);
+
+        /* Data must be read before the producer may overwrite it */
+        atomic_store_explicit(&ring_buff->tail, tail + size, memory_order_release);
+    }
+
+    return size;
+}
+
+
+uint32_t ezSpscRingBuffer_GetNumOfByte(ezSpscRingBuffer *ring_buff)
+{
+    uint32_t tail = atomic_load_explicit(&ring_buff->tail, memory_order_acquire);
+    uint32_t head = atomic_load_explicit(&ring_buff->head, memory_order_acquire);
+
+    return head - tail;
+}
+
+
+uint32_t ezSpscRingBuffer_GetAvailableMemory(ezSpscRingBuffer *ring_buff)
+{
+    return CAPACITY(ring_buff) - ezSpscRingBuffer_GetNumOfByte(ring_buff);
+}
+
+#endif /* EZ_SPSC_RING_BUFFER == 1U */
+
+/* End of file */
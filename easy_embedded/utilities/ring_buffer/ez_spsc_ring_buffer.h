@@ -0,0 +1,226 @@
+/*****************************************************************************
+* Filename:         ez_spsc_ring_buffer.h
+* Author:           Hai Nguyen
+* Original Date:    18.10.2026
+*
+* ----------------------------------------------------------------------------
+* Contact:          Hai Nguyen
+*                   hainguyen.eeit@gmail.com
+*
+* ----------------------------------------------------------------------------
+* License: This file is published under the license described in LICENSE.md
+*
+*****************************************************************************/
+
+
+/** @file   ez_spsc_ring_buffer.h
+ *  @author Hai Nguyen
+ *  @date   18.10.2026
+ *  @brief  Public API of the lock-free single producer single consumer ring
+ *          buffer
+ *
+ *  @details One context pushes and one other context pops, for example an
+ *  interrupt and a task, without any critical section. The producer only
+ *  writes the head index and the consumer only writes the tail index, both
+ *  are free-running counters published with release and read with acquire
+ *  ordering. The indexes live in separate cache lines so the two sides do
+ *  not invalidate each other. The capacity must be a power of two.
+ */
+
+#ifndef _EZ_SPSC_RING_BUFFER_H
+#define _EZ_SPSC_RING_BUFFER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Includes
+*******************************************************************************/
+#if (EZ_BUILD_WITH_CMAKE == 0U)
+#include "ez_target_config.h"
+#endif
+
+#if (EZ_SPSC_RING_BUFFER == 1U)
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+
+/*****************************************************************************
+* Component Preprocessor Macros
+*****************************************************************************/
+/* Size of a cache line, used to keep the indexes of both sides apart */
+#ifndef CONFIG_EZ_CACHE_LINE_SIZE
+#define CONFIG_EZ_CACHE_LINE_SIZE   64U
+#endif /* CONFIG_EZ_CACHE_LINE_SIZE */
+
+
+/*****************************************************************************
+* Component Typedefs
+*****************************************************************************/
+/** @brief Lock-free single producer single consumer ring buffer
+ */
+struct ezSpscRingBuffer
+{
+    _Alignas(CONFIG_EZ_CACHE_LINE_SIZE) atomic_uint_least32_t head;
+    /**< Number of bytes pushed so far, written by the producer only */
+    uint32_t cached_tail;
+    /**< Last tail seen by the producer */
+    _Alignas(CONFIG_EZ_CACHE_LINE_SIZE) atomic_uint_least32_t tail;
+    /**< Number of bytes popped so far, written by the consumer only */
+    uint32_t cached_head;
+    /**< Last head seen by the consumer */
+    _Alignas(CONFIG_EZ_CACHE_LINE_SIZE) uint8_t *buff;
+    /**< Pointer to the data buffer */
+    uint32_t mask;
+    /**< Capacity - 1 */
+};
+
+
+/** @brief Define ezSpscRingBuffer type
+ */
+typedef struct ezSpscRingBuffer ezSpscRingBuffer;
+
+
+/*****************************************************************************
+* Component Variable Definitions
+*****************************************************************************/
+/* None */
+
+
+/******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+/*****************************************************************************
+* Function : ezSpscRingBuffer_Init
+*//**
+* @brief Initialize the ring buffer
+*
+* @details Must be called before the producer and the consumer start
+*
+* @param[in]    ring_buff:  pointer to the ring buffer
+* @param[in]    buff:       buffer holding the data
+* @param[in]    size:       size of buff, a power of two up to 2^31
+* @return       true if success, else false
+*
+* @pre None
+* @post None
+*
+* \b Example
+* @code
+* static ezSpscRingBuffer rx_ring;
+* static uint8_t rx_buff[256];
+* ezSpscRingBuffer_Init(&rx_ring, rx_buff, sizeof(rx_buff));
+* @endcode
+*
+*****************************************************************************/
+bool ezSpscRingBuffer_Init(ezSpscRingBuffer *ring_buff, uint8_t *buff, uint32_t size);
+
+
+/*****************************************************************************
+* Function : ezSpscRingBuffer_Push
+*//**
+* @brief Push data into the ring buffer. Producer side only.
+*
+* @details Pushes as many bytes as there is room for
+*
+* @param[in]    ring_buff:  pointer to the ring buffer
+* @param[in]    data:       data to be pushed
+* @param[in]    size:       size of the data
+* @return       Number of bytes pushed
+*
+* @pre ring_buff must be initialized
+* @post None
+*
+* \b Example
+* @code
+* void UART_RxIrqHandler(void)
+* {
+*     uint8_t byte = UART->DR;
+*     ezSpscRingBuffer_Push(&rx_ring, &byte, 1);
+* }
+* @endcode
+*
+*****************************************************************************/
+uint32_t ezSpscRingBuffer_Push(ezSpscRingBuffer *ring_buff, const uint8_t *data, uint32_t size);
+
+
+/*****************************************************************************
+* Function : ezSpscRingBuffer_Pop
+*//**
+* @brief Pop data out of the ring buffer. Consumer side only.
+*
+* @details Pops at most size bytes
+*
+* @param[in]    ring_buff:  pointer to the ring buffer
+* @param[out]   data:       buffer receiving the data
+* @param[in]    size:       size of data
+* @return       Number of bytes popped
+*
+* @pre ring_buff must be initialized
+* @post None
+*
+* \b Example
+* @code
+* uint8_t rx[16];
+* uint32_t count = ezSpscRingBuffer_Pop(&rx_ring, rx, sizeof(rx));
+* @endcode
+*
+*****************************************************************************/
+uint32_t ezSpscRingBuffer_Pop(ezSpscRingBuffer *ring_buff, uint8_t *data, uint32_t size);
+
+
+/*****************************************************************************
+* Function : ezSpscRingBuffer_GetNumOfByte
+*//**
+* @brief Return the number of bytes stored in the ring buffer
+*
+* @details Seen from the other side, the value is only a snapshot: the
+* consumer may only see more bytes later, the producer may only see fewer.
+*
+* @param[in]    ring_buff:  pointer to the ring buffer
+* @return       Number of bytes stored
+*
+* @pre ring_buff must be initialized
+* @post None
+*
+* \b Example
+* @code
+* uint32_t count = ezSpscRingBuffer_GetNumOfByte(&rx_ring);
+* @endcode
+*
+*****************************************************************************/
+uint32_t ezSpscRingBuffer_GetNumOfByte(ezSpscRingBuffer *ring_buff);
+
+
+/*****************************************************************************
+* Function : ezSpscRingBuffer_GetAvailableMemory
+*//**
+* @brief Return the number of bytes which can be pushed
+*
+* @details Same snapshot semantic as ezSpscRingBuffer_GetNumOfByte
+*
+* @param[in]    ring_buff:  pointer to the ring buffer
+* @return       Number of free bytes
+*
+* @pre ring_buff must be initialized
+* @post None
+*
+* \b Example
+* @code
+* uint32_t room = ezSpscRingBuffer_GetAvailableMemory(&rx_ring);
+* @endcode
+*
+*****************************************************************************/
+uint32_t ezSpscRingBuffer_GetAvailableMemory(ezSpscRingBuffer *ring_buff);
+
+#endif /* EZ_SPSC_RING_BUFFER == 1U */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _EZ_SPSC_RING_BUFFER_H */
+
+/* End of file */
@@ -18,7 +18,23 @@
  *  @date   26.02.2024
  *  @brief  Implementation of the static memory alloction
  *
- *  @details
+ *  @details First-fit backend. The TLSF backend is implemented in
+ *  ez_static_alloc_tlsf.c, the functions shared by both backends are
+ *  located at the end of the public functions.
+ *
+ *  By default, the MemBlock headers are taken from block_pool, shared by
+ *  every MemList. When it is empty, a header is carved from the end of the
+ *  free block being split, so a busy list cannot starve the others. Unused
+ *  headers form stacks linked through their node, one for block_pool and one
+ *  per MemList for the carved headers, so a header is taken and returned in
+ *  constant time. A local list never touches block_pool and only carves its
+ *  headers, so it does not share any state with the other lists.
+ *
+ *  With EZ_STATIC_ALLOC_INBAND, the MemBlock header is stored in the buffer
+ *  right before the memory it describes and the buffer is terminated by a
+ *  used sentinel header of size 0. Free computes the header from the
+ *  address, reaches the physical neighbours through buff_size and
+ *  prev_phys, and merges them without walking any list.
  */
 
 /*****************************************************************************
@@ -32,6 +48,7 @@
 #include "stdbool.h"
 #include <string.h>
 
+
 /*****************************************************************************
 * Component Preprocessor Macros
 *****************************************************************************/
@@ -55,14 +72,24 @@
     #define STCMEMHEXDUMP(a,b)
 #endif
 
-#ifndef CONFIG_NUM_OF_MEM_BLOCK
-#define CONFIG_NUM_OF_MEM_BLOCK 128
-#endif /*CONFIG_NUM_OF_MEM_BLOCK*/
+#define GET_LIST(x) ((struct MemList*)x)
 
+#if (EZ_STATIC_ALLOC_TLSF == 0U)
 #define INIT_BLOCK(block, buff_ptr, size) {ezLinkedList_InitNode(&block->node);block->buff = buff_ptr;block->buff_size = size; }
-#define GET_LIST(x) ((struct MemList*)x)
 #define GET_BLOCK(node_ptr) (EZ_LINKEDLIST_GET_PARENT_OF(node_ptr, node, struct MemBlock))
 
+#if (EZ_STATIC_ALLOC_INBAND == 1U)
+#define INBAND_ALIGN_SIZE           (sizeof(uintptr_t))
+#define INBAND_ALIGN_UP(x)          (((uintptr_t)(x) + (INBAND_ALIGN_SIZE - 1U)) & ~(uintptr_t)(INBAND_ALIGN_SIZE - 1U))
+#define INBAND_ALIGN_DOWN(x)        ((uintptr_t)(x) & ~(uintptr_t)(INBAND_ALIGN_SIZE - 1U))
+#define INBAND_HEADER_SIZE          (INBAND_ALIGN_UP(sizeof(struct MemBlock)))
+#define GET_NEXT_PHYS_BLOCK(block)  ((struct MemBlock*)((uint8_t*)(block)->buff + (block)->buff_size))
+#else
+#define CARVED_ALIGN_DOWN(x)        ((uintptr_t)(x) & ~(uintptr_t)(sizeof(uintptr_t) - 1U))
+#define IS_POOL_BLOCK(block)        ((block) >= &block_pool[0] && (block) < &block_pool[CONFIG_NUM_OF_MEM_BLOCK])
+#endif /* EZ_STATIC_ALLOC_INBAND == 1U */
+#endif /* EZ_STATIC_ALLOC_TLSF == 0U */
+
 /*****************************************************************************
 * Component Typedefs
 *****************************************************************************/
@@ -72,28 +99,77 @@
 /*****************************************************************************
 * Component Variable Definitions
 *****************************************************************************/
+#if (EZ_STATIC_ALLOC_TLSF == 0U) && (EZ_STATIC_ALLOC_INBAND == 0U)
 static struct MemBlock block_pool[CONFIG_NUM_OF_MEM_BLOCK] = { 0U };
+/**< Block headers shared by all memory lists */
+static struct MemBlock *unused_pool_blocks = NULL;
+/**< Stack of unused headers of block_pool, linked through node.next */
+static bool is_block_pool_ready = false;
+/**< block_pool is pushed to unused_pool_blocks on the first use */
+#endif /* EZ_STATIC_ALLOC_TLSF == 0U && EZ_STATIC_ALLOC_INBAND == 0U */
 
 
 /*****************************************************************************
 * Function Definitions
 *****************************************************************************/
+#if (EZ_STATIC_ALLOC_TLSF == 0U)
+#if (EZ_STATIC_ALLOC_INBAND == 1U)
+static struct MemBlock *ezStaticAlloc_InitInBandBlock(void *buff, ezStaticAllocSize buff_size);
+static struct Node *ezStaticAlloc_ReserveInBandBlock(struct MemList *mem_list, ezStaticAllocSize block_size_byte);
+static struct MemBlock *ezStaticAlloc_GetInBandBlock(struct MemList *mem_list, void *alloc_addr);
+static void ezStaticAlloc_ReturnInBandBlock(struct MemList *mem_list, struct MemBlock *block);
+#else
 static void ezStaticAlloc_ReturnHeaderToFreeList(struct Node *free_list_head, struct Node *free_node);
-static void ezmSmalloc_Merge(struct Node *free_list_head);
+static bool ezStaticAlloc_IsBlockAddrLess(const struct Node *a, const struct Node *b);
+static void ezmSmalloc_Merge(struct MemList *mem_list);
+static void ezStaticAlloc_InitBlockPool(void *buff, ezStaticAllocSize buff_size);
+static bool ezStaticAlloc_InitList(ezmMemList* mem_list, void* buff, ezStaticAllocSize buff_size, bool is_local);
+static struct MemBlock *ezStaticAlloc_CarveHeader(struct MemList *mem_list,
+                                                  uint8_t *block_buff,
+                                                  ezStaticAllocSize *block_size,
+                                                  ezStaticAllocSize keep_size);
+struct Node* ezStaticAlloc_ReserveMemoryBlock(struct MemList *mem_list, ezStaticAllocSize block_size_byte);
+struct MemBlock* GetFreeBlock(struct MemList *mem_list);
+void ReleaseBlock(struct MemList *mem_list, struct MemBlock* block);
+#endif /* EZ_STATIC_ALLOC_INBAND == 1U */
 
-struct Node* ezStaticAlloc_ReserveMemoryBlock(struct Node* free_list_head, uint16_t block_size_byte);
 bool ezStaticAlloc_MoveBlock(struct Node* move_node, struct Node* from_list_head, struct Node* to_list_head);
-struct MemBlock* GetFreeBlock(void);
-void ReleaseBlock(struct MemBlock* block);
+#endif /* EZ_STATIC_ALLOC_TLSF == 0U */
+void ezStaticAlloc_ScrubFreedMemory(struct MemList *mem_list, void *addr, uint32_t size);
+void ezStaticAlloc_ScrubHeader(struct MemList *mem_list, void *addr, uint32_t size);
+bool ezStaticAlloc_CheckPoison(struct MemList *mem_list, void *addr, uint32_t size);
+void ezStaticAlloc_InitStats(struct MemList *mem_list, ezStaticAllocSize free_bytes);
+void ezStaticAlloc_CountAlloc(struct MemList *mem_list, ezStaticAllocSize block_size);
+void ezStaticAlloc_CountFree(struct MemList *mem_list, ezStaticAllocSize block_size);
 
 
 /*****************************************************************************
 * Public functions
 *****************************************************************************/
-bool ezStaticAlloc_InitMemList(ezmMemList* mem_list, void* buff, uint16_t buff_size)
+#if (EZ_STATIC_ALLOC_TLSF == 0U)
+#if (EZ_STATIC_ALLOC_INBAND == 0U)
+bool ezStaticAlloc_InitMemList(ezmMemList* mem_list, void* buff, ezStaticAllocSize buff_size)
+{
+    return ezStaticAlloc_InitList(mem_list, buff, buff_size, false);
+}
+
+
+bool ezStaticAlloc_InitLocalMemList(ezmMemList* mem_list, void* buff, ezStaticAllocSize buff_size)
+{
+    return ezStaticAlloc_InitList(mem_list, buff, buff_size, true);
+}
+
+
+static bool ezStaticAlloc_InitList(ezmMemList* mem_list, void* buff, ezStaticAllocSize buff_size, bool is_local)
+#else
+bool ezStaticAlloc_InitMemList(ezmMemList* mem_list, void* buff, ezStaticAllocSize buff_size)
+#endif /* EZ_STATIC_ALLOC_INBAND == 0U */
 {
     bool    is_success = true;
     struct MemBlock *free_block = NULL;
+#if (EZ_STATIC_ALLOC_INBAND == 0U)
+    ezStaticAllocSize free_size = buff_size;
+#endif /* EZ_STATIC_ALLOC_INBAND == 0U */
 
     STCMEMPRINT("ezStaticAlloc_InitMemList()");
     STCMEMPRINT1("size = %d", sizeof(struct MemList));
@@ -106,16 +182,37 @@ bool ezStaticAlloc_InitMemList(ezmMemList* mem_list, void* buff, uint16_t buff_s
     {
         GET_LIST(mem_list)->buff = buff;
         GET_LIST(mem_list)->buff_size = buff_size;
+        GET_LIST(mem_list)->scrub_policy = CONFIG_EZ_STATIC_ALLOC_SCRUB_POLICY;
+        GET_LIST(mem_list)->num_of_poison_error = 0U;
+        ezStaticAlloc_ScrubFreedMemory(GET_LIST(mem_list), buff, buff_size);
         ezLinkedList_InitNode(&GET_LIST(mem_list)->alloc_list_head);
         ezLinkedList_InitNode(&GET_LIST(mem_list)->free_list_head);
 
-        free_block = GetFreeBlock();
-        
+#if (EZ_STATIC_ALLOC_INBAND == 1U)
+        free_block = ezStaticAlloc_InitInBandBlock(buff, buff_size);
+#else
+        GET_LIST(mem_list)->unused_blocks = NULL;
+        GET_LIST(mem_list)->is_local = is_local;
+        if (is_local == false)
+        {
+            ezStaticAlloc_InitBlockPool(buff, buff_size);
+            free_block = GetFreeBlock(GET_LIST(mem_list));
+        }
+        if (NULL == free_block)
+        {
+            free_block = ezStaticAlloc_CarveHeader(GET_LIST(mem_list), buff, &free_size, 0U);
+        }
+#endif /* EZ_STATIC_ALLOC_INBAND == 1U */
+
         if (NULL != free_block)
         {
-            INIT_BLOCK(free_block, buff, buff_size);
+#if (EZ_STATIC_ALLOC_INBAND == 0U)
+            INIT_BLOCK(free_block, buff, free_size);
+#endif /* EZ_STATIC_ALLOC_INBAND == 0U */
 
             is_success = is_success && EZ_LINKEDLIST_ADD_HEAD(&GET_LIST(mem_list)->free_list_head, &free_block->node);
+            ezStaticAlloc_InitStats(GET_LIST(mem_list), free_block->buff_size);
+            GET_LIST(mem_list)->num_of_free_block = 1U;
         }
         else
         {
@@ -129,7 +226,7 @@ bool ezStaticAlloc_InitMemList(ezmMemList* mem_list, void* buff, uint16_t buff_s
 }
 
 
-void *ezStaticAlloc_Malloc(ezmMemList *mem_list, uint16_t alloc_size)
+void *ezStaticAlloc_Malloc(ezmMemList *mem_list, ezStaticAllocSize alloc_size)
 {
     void    *alloc_addr = NULL;
     bool    is_success = true;
@@ -144,7 +241,16 @@ void *ezStaticAlloc_Malloc(ezmMemList *mem_list, uint16_t alloc_size)
 
     if (is_success)
     {
-        reserved_node = ezStaticAlloc_ReserveMemoryBlock(&GET_LIST(mem_list)->free_list_head, alloc_size);
+#if (EZ_STATIC_ALLOC_INBAND == 1U)
+        reserved_node = ezStaticAlloc_ReserveInBandBlock(GET_LIST(mem_list), alloc_size);
+#else
+        reserved_node = ezStaticAlloc_ReserveMemoryBlock(GET_LIST(mem_list), alloc_size);
+#endif /* EZ_STATIC_ALLOC_INBAND == 1U */
+
+        if (NULL == reserved_node)
+        {
+            GET_LIST(mem_list)->num_of_alloc_fail++;
+        }
     }
 
     if (NULL != reserved_node)
@@ -154,6 +260,9 @@ void *ezStaticAlloc_Malloc(ezmMemList *mem_list, uint16_t alloc_size)
         if (is_success)
         {
             alloc_addr = GET_BLOCK(reserved_node)->buff;
+            ezStaticAlloc_CountAlloc(GET_LIST(mem_list), GET_BLOCK(reserved_node)->buff_size);
+            GET_LIST(mem_list)->num_of_free_block--;
+            (void)ezStaticAlloc_CheckPoison(GET_LIST(mem_list), alloc_addr, GET_BLOCK(reserved_node)->buff_size);
         }
     }
 
@@ -167,24 +276,44 @@ void *ezStaticAlloc_Malloc(ezmMemList *mem_list, uint16_t alloc_size)
 bool ezStaticAlloc_Free(ezmMemList *mem_list, void *alloc_addr)
 {
     bool        is_success = false;
+#if (EZ_STATIC_ALLOC_INBAND == 1U)
+    struct MemBlock *block = NULL;
+#else
     struct Node* it_node = NULL;
+#endif /* EZ_STATIC_ALLOC_INBAND == 1U */
 
     STCMEMPRINT1("ezStaticAlloc_Free() - [address = %p]", alloc_addr);
 
     if (mem_list != NULL && alloc_addr != NULL)
     {
+#if (EZ_STATIC_ALLOC_INBAND == 1U)
+        block = ezStaticAlloc_GetInBandBlock(GET_LIST(mem_list), alloc_addr);
+        if (NULL != block)
+        {
+            EZ_LINKEDLIST_UNLINK_NODE(&block->node);
+            ezStaticAlloc_CountFree(GET_LIST(mem_list), block->buff_size);
+            GET_LIST(mem_list)->num_of_free_block++;
+            ezStaticAlloc_ReturnInBandBlock(GET_LIST(mem_list), block);
+            is_success = true;
+            STCMEMPRINT("Free OK");
+        }
+#else
         EZ_LINKEDLIST_FOR_EACH(it_node, &GET_LIST(mem_list)->alloc_list_head)
         {
             if (GET_BLOCK(it_node)->buff == (uint8_t*)alloc_addr)
             {
                 EZ_LINKEDLIST_UNLINK_NODE(it_node);
+                ezStaticAlloc_CountFree(GET_LIST(mem_list), GET_BLOCK(it_node)->buff_size);
+                GET_LIST(mem_list)->num_of_free_block++;
+                ezStaticAlloc_ScrubFreedMemory(GET_LIST(mem_list), GET_BLOCK(it_node)->buff, GET_BLOCK(it_node)->buff_size);
                 ezStaticAlloc_ReturnHeaderToFreeList(&GET_LIST(mem_list)->free_list_head, it_node);
-                ezmSmalloc_Merge(&GET_LIST(mem_list)->free_list_head);
+                ezmSmalloc_Merge(GET_LIST(mem_list));
                 is_success = true;
                 STCMEMPRINT("Free OK");
                 break;
             }
         }
+#endif /* EZ_STATIC_ALLOC_INBAND == 1U */
     }
 
     ezStaticAlloc_PrintFreeList(mem_list);
@@ -194,6 +323,94 @@ bool ezStaticAlloc_Free(ezmMemList *mem_list, void *alloc_addr)
 }
 
 
+bool ezStaticAlloc_SetScrubPolicy(ezmMemList *mem_list, ezStaticAllocScrub policy)
+{
+    bool is_success = false;
+    struct Node *it_node = NULL;
+
+    if (mem_list != NULL && ezStaticAlloc_IsMemListReady(mem_list) && policy <= EZ_STATIC_ALLOC_SCRUB_POISON)
+    {
+        GET_LIST(mem_list)->scrub_policy = (uint8_t)policy;
+
+        /* Bring the free memory to the state expected by the new policy */
+        EZ_LINKEDLIST_FOR_EACH(it_node, &GET_LIST(mem_list)->free_list_head)
+        {
+            ezStaticAlloc_ScrubFreedMemory(GET_LIST(mem_list), GET_BLOCK(it_node)->buff, GET_BLOCK(it_node)->buff_size);
+        }
+        is_success = true;
+    }
+
+    return is_success;
+}
+
+
+ezStaticAllocSize ezStaticAlloc_GetLargestFreeBlock(ezmMemList *mem_list)
+{
+    ezStaticAllocSize largest = 0U;
+    struct Node *it_node = NULL;
+
+    EZ_LINKEDLIST_FOR_EACH(it_node, &GET_LIST(mem_list)->free_list_head)
+    {
+        if (GET_BLOCK(it_node)->buff_size > largest)
+        {
+            largest = GET_BLOCK(it_node)->buff_size;
+        }
+    }
+
+    return largest;
+}
+#endif /* EZ_STATIC_ALLOC_TLSF == 0U */
+
+
+#if (EZ_STATIC_ALLOC_TLSF == 1U) || (EZ_STATIC_ALLOC_INBAND == 1U)
+bool ezStaticAlloc_InitLocalMemList(ezmMemList* mem_list, void* buff, ezStaticAllocSize buff_size)
+{
+    /* Headers are stored in the buffer, every list is local already */
+    return ezStaticAlloc_InitMemList(mem_list, buff, buff_size);
+}
+#endif /* EZ_STATIC_ALLOC_TLSF == 1U || EZ_STATIC_ALLOC_INBAND == 1U */
+
+
+bool ezStaticAlloc_GetStats(ezmMemList *mem_list, ezStaticAllocStats *stats)
+{
+    bool is_success = false;
+
+    if (mem_list != NULL && stats != NULL && ezStaticAlloc_IsMemListReady(mem_list))
+    {
+        stats->used_bytes = mem_list->used_bytes;
+        stats->free_bytes = mem_list->free_bytes;
+        stats->high_water_mark = mem_list->high_water_mark;
+        stats->largest_free_block = ezStaticAlloc_GetLargestFreeBlock(mem_list);
+        stats->num_of_alloc_block = mem_list->num_of_alloc_block;
+        stats->num_of_free_block = mem_list->num_of_free_block;
+        stats->num_of_alloc_fail = mem_list->num_of_alloc_fail;
+        stats->num_of_split = mem_list->num_of_split;
+        stats->num_of_merge = mem_list->num_of_merge;
+        stats->fragmentation = 0U;
+
+        if (stats->free_bytes > 0U)
+        {
+            stats->fragmentation = (uint8_t)(100U - (uint32_t)(((uint64_t)stats->largest_free_block * 100U) / stats->free_bytes));
+        }
+        is_success = true;
+    }
+
+    return is_success;
+}
+
+
+void ezStaticAlloc_ResetStats(ezmMemList *mem_list)
+{
+    if (mem_list != NULL)
+    {
+        mem_list->high_water_mark = mem_list->used_bytes;
+        mem_list->num_of_alloc_fail = 0U;
+        mem_list->num_of_split = 0U;
+        mem_list->num_of_merge = 0U;
+    }
+}
+
+
 bool ezStaticAlloc_IsMemListReady(ezmMemList *mem_list)
 {
     bool is_ready = false;
@@ -215,8 +432,10 @@ void ezStaticAlloc_HexdumpBuffer(ezmMemList *mem_list)
         struct MemList* list = GET_LIST(mem_list);
         STCMEMPRINT("mem list info");
         STCMEMPRINT1("[addr = %p]", list);
+#if (EZ_STATIC_ALLOC_TLSF == 0U)
         STCMEMPRINT1("[alloc = %p]", (void*)&list->alloc_list_head);
         STCMEMPRINT1("[free = %p]", (void*)&list->free_list_head);
+#endif /* EZ_STATIC_ALLOC_TLSF == 0U */
         STCMEMPRINT1("[buff = %p]", list->buff);
         STCMEMPRINT1("[size = %d]", list->buff_size);
         STCMEMHEXDUMP(list->buff, list->buff_size);
@@ -226,6 +445,7 @@ void ezStaticAlloc_HexdumpBuffer(ezmMemList *mem_list)
 }
 
 
+#if (EZ_STATIC_ALLOC_TLSF == 0U)
 void ezStaticAlloc_PrintFreeList(ezmMemList *mem_list)
 {
 #if (VERBOSE == 1U)
@@ -270,91 +490,284 @@ void ezStaticAlloc_PrintAllocList(ezmMemList * mem_list)
 }
 
 
+#endif /* EZ_STATIC_ALLOC_TLSF == 0U */
+
+
 uint16_t ezStaticAlloc_GetNumOfAllocBlock(ezmMemList* mem_list)
 {
-    return ezLinkedList_GetListSize(&GET_LIST(mem_list)->alloc_list_head);
+    return GET_LIST(mem_list)->num_of_alloc_block;
 }
 
 
 uint16_t ezStaticAlloc_GetNumOfFreeBlock(ezmMemList* mem_list)
 {
-    return ezLinkedList_GetListSize(&GET_LIST(mem_list)->free_list_head);
+    return GET_LIST(mem_list)->num_of_free_block;
+}
+
+
+uint16_t ezStaticAlloc_GetNumOfPoisonError(ezmMemList* mem_list)
+{
+    return GET_LIST(mem_list)->num_of_poison_error;
 }
 /**************************** Private function *******************************/
 
 /******************************************************************************
-* Function : ezStaticAlloc_ReturnHeaderToFreeList
+* Function : ezStaticAlloc_ScrubFreedMemory
 *//**
 * \b Description:
 *
-* This function returns the free memory header (and its buffer) to the free list
+* This function applies the scrub policy of the list to freed memory
 *
 * PRE-CONDITION: None
 *
 * POST-CONDITION: None
 *
-* @param    *free_list      free list the the header will be returned
-* @param    *free_header    the header to be moved
+* @param    *mem_list   memory list owning the memory
+* @param    *addr       start of the freed memory
+* @param    size        size of the freed memory
 *
 * @return   None
 *
 *******************************************************************************/
-static void ezStaticAlloc_ReturnHeaderToFreeList(struct Node* free_list_head, struct Node* free_node)
+void ezStaticAlloc_ScrubFreedMemory(struct MemList *mem_list, void *addr, uint32_t size)
 {
-    memset(GET_BLOCK(free_node)->buff, 0, GET_BLOCK(free_node)->buff_size);
-    struct Node* it_node = NULL;
+    if (mem_list->scrub_policy == EZ_STATIC_ALLOC_SCRUB_ON_FREE)
+    {
+        memset(addr, 0, size);
+    }
+    else if (mem_list->scrub_policy == EZ_STATIC_ALLOC_SCRUB_POISON)
+    {
+        memset(addr, CONFIG_EZ_STATIC_ALLOC_POISON_BYTE, size);
+    }
+    else
+    {
+        /* memory is left as it is */
+    }
+}
 
-    if (free_list_head != NULL && free_node != NULL)
+/******************************************************************************
+* Function : ezStaticAlloc_ScrubHeader
+*//**
+* \b Description:
+*
+* This function wipes a block header which becomes part of a free block.
+* Headers are always wiped, so a stale header is never taken for a valid one.
+*
+* PRE-CONDITION: None
+*
+* POST-CONDITION: None
+*
+* @param    *mem_list   memory list owning the memory
+* @param    *addr       start of the header
+* @param    size        size of the header
+*
+* @return   None
+*
+*******************************************************************************/
+void ezStaticAlloc_ScrubHeader(struct MemList *mem_list, void *addr, uint32_t size)
+{
+    if (mem_list->scrub_policy == EZ_STATIC_ALLOC_SCRUB_POISON)
     {
-        if (IS_LIST_EMPTY(free_list_head))
-        {
-            EZ_LINKEDLIST_ADD_HEAD(free_list_head, free_node);
-        }
-        else
+        memset(addr, CONFIG_EZ_STATIC_ALLOC_POISON_BYTE, size);
+    }
+    else
+    {
+        memset(addr, 0, size);
+    }
+}
+
+/******************************************************************************
+* Function : ezStaticAlloc_CheckPoison
+*//**
+* \b Description:
+*
+* This function checks that memory about to be allocated still holds the
+* poison pattern. A mismatch means the memory was written after being freed.
+*
+* PRE-CONDITION: None
+*
+* POST-CONDITION: None
+*
+* @param    *mem_list   memory list owning the memory
+* @param    *addr       start of the memory
+* @param    size        size of the memory
+*
+* @return   false if the pattern was overwritten, else true
+*
+*******************************************************************************/
+bool ezStaticAlloc_CheckPoison(struct MemList *mem_list, void *addr, uint32_t size)
+{
+    bool is_intact = true;
+    uint8_t *byte = (uint8_t*)addr;
+
+    if (mem_list->scrub_policy == EZ_STATIC_ALLOC_SCRUB_POISON)
+    {
+        for (uint32_t i = 0; i < size; i++)
         {
-            /* tranverse the list to add the node, we aort the address in the order so merge operation will be easier*/
-            EZ_LINKEDLIST_FOR_EACH(it_node, free_list_head)
+            if (byte[i] != (uint8_t)CONFIG_EZ_STATIC_ALLOC_POISON_BYTE)
             {
-                if (GET_BLOCK(free_node)->buff < GET_BLOCK(it_node)->buff)
-                {
-                    ezLinkedList_AppendNode(free_node, it_node->prev);
-                    break;
-                }
-                else if (GET_BLOCK(free_node)->buff > GET_BLOCK(it_node)->buff)
-                {
-                    ezLinkedList_AppendNode(free_node, it_node);
-                    break;
-                }
-                else
-                {
-                    /* do nothing, advance pointer */
-                }
+                is_intact = false;
+                mem_list->num_of_poison_error++;
+                STCMEMPRINT1("use after free detected [address = %p]", addr);
+                break;
             }
         }
     }
+
+    return is_intact;
 }
 
 /******************************************************************************
-* Function : ezmSmalloc_Merge
+* Function : ezStaticAlloc_InitStats
 *//**
 * \b Description:
 *
-* This function tries to merge the adjacent free blocks into a bigger block
+* This function resets the counters of a list holding one free block. The
+* number of free blocks is kept by the layout.
+*
+* PRE-CONDITION: None
+*
+* POST-CONDITION: None
+*
+* @param    *mem_list   memory list
+* @param    free_bytes  size of the free block
+*
+* @return   None
+*
+*******************************************************************************/
+void ezStaticAlloc_InitStats(struct MemList *mem_list, ezStaticAllocSize free_bytes)
+{
+    mem_list->num_of_alloc_block = 0U;
+    mem_list->used_bytes = 0U;
+    mem_list->free_bytes = free_bytes;
+    mem_list->high_water_mark = 0U;
+    mem_list->num_of_alloc_fail = 0U;
+    mem_list->num_of_split = 0U;
+    mem_list->num_of_merge = 0U;
+}
+
+/******************************************************************************
+* Function : ezStaticAlloc_CountAlloc
+*//**
+* \b Description:
+*
+* This function updates the counters when a free block is allocated
+*
+* PRE-CONDITION: None
+*
+* POST-CONDITION: None
+*
+* @param    *mem_list   memory list
+* @param    block_size  size of the allocated block
+*
+* @return   None
+*
+*******************************************************************************/
+void ezStaticAlloc_CountAlloc(struct MemList *mem_list, ezStaticAllocSize block_size)
+{
+    mem_list->num_of_alloc_block++;
+    mem_list->used_bytes += block_size;
+    mem_list->free_bytes -= block_size;
+
+    if (mem_list->used_bytes > mem_list->high_water_mark)
+    {
+        mem_list->high_water_mark = mem_list->used_bytes;
+    }
+}
+
+/******************************************************************************
+* Function : ezStaticAlloc_CountFree
+*//**
+* \b Description:
+*
+* This function updates the counters when an allocated block is released,
+* before it is merged with its neighbours
+*
+* PRE-CONDITION: None
+*
+* POST-CONDITION: None
+*
+* @param    *mem_list   memory list
+* @param    block_size  size of the released block
+*
+* @return   None
+*
+*******************************************************************************/
+void ezStaticAlloc_CountFree(struct MemList *mem_list, ezStaticAllocSize block_size)
+{
+    mem_list->num_of_alloc_block--;
+    mem_list->used_bytes -= block_size;
+    mem_list->free_bytes += block_size;
+}
+
+#if (EZ_STATIC_ALLOC_TLSF == 0U)
+
+#if (EZ_STATIC_ALLOC_INBAND == 0U)
+/******************************************************************************
+* Function : ezStaticAlloc_ReturnHeaderToFreeList
+*//**
+* \b Description:
+*
+* This function returns the free memory header (and its buffer) to the free list
 *
 * PRE-CONDITION: None
 *
 * POST-CONDITION: None
 *
 * @param    *free_list      free list the the header will be returned
+* @param    *free_header    the header to be moved
 *
 * @return   None
 *
 *******************************************************************************/
-static void ezmSmalloc_Merge(struct Node* free_list_head)
+static void ezStaticAlloc_ReturnHeaderToFreeList(struct Node* free_list_head, struct Node* free_node)
+{
+    /* Keep the free list sorted by address so merge operation will be easier */
+    (void)ezLinkedList_InsertSorted(free_list_head, free_node, ezStaticAlloc_IsBlockAddrLess);
+}
+
+
+/******************************************************************************
+* Function : ezStaticAlloc_IsBlockAddrLess
+*//**
+* \b Description:
+*
+* This function orders the free blocks by the address of their buffer
+*
+* PRE-CONDITION: None
+*
+* POST-CONDITION: None
+*
+* @param    *a      node of the first block
+* @param    *b      node of the second block
+*
+* @return   true if the buffer of a is before the buffer of b
+*
+*******************************************************************************/
+static bool ezStaticAlloc_IsBlockAddrLess(const struct Node *a, const struct Node *b)
 {
-    //MemHdr* head = free_list->pstHead;
-    //MemHdr* next = head->pstNextNode;
+    return (uint8_t*)GET_BLOCK(a)->buff < (uint8_t*)GET_BLOCK(b)->buff;
+}
 
+/******************************************************************************
+* Function : ezmSmalloc_Merge
+*//**
+* \b Description:
+*
+* This function tries to merge the adjacent free blocks into a bigger block
+*
+* PRE-CONDITION: None
+*
+* POST-CONDITION: None
+*
+* @param    *mem_list       memory list owning the free list
+*
+* @return   None
+*
+*******************************************************************************/
+static void ezmSmalloc_Merge(struct MemList *mem_list)
+{
+    struct Node* free_list_head = &mem_list->free_list_head;
     struct Node* it_node = free_list_head->next;
     struct Node* it_next = it_node->next;
     while (it_next != free_list_head &&
@@ -363,33 +776,130 @@ static void ezmSmalloc_Merge(struct Node* free_list_head)
 
         STCMEMPRINT("Next adjacent block is free");
         GET_BLOCK(it_node)->buff_size += GET_BLOCK(it_next)->buff_size;
+        mem_list->num_of_merge++;
+        mem_list->num_of_free_block--;
         EZ_LINKEDLIST_UNLINK_NODE(it_next);
-        ReleaseBlock(GET_BLOCK(it_next));
+        ReleaseBlock(mem_list, GET_BLOCK(it_next));
         it_next = it_node->next;
     }
 }
 
-struct MemBlock* GetFreeBlock(void)
+/******************************************************************************
+* Function : ezStaticAlloc_InitBlockPool
+*//**
+* \b Description:
+*
+* This function pushes the headers of block_pool to the stack of unused
+* headers on the first call. Headers describing memory of a buffer being
+* initialized belong to a previous list on the same buffer, they are taken
+* back.
+*
+* PRE-CONDITION: None
+*
+* POST-CONDITION: None
+*
+* @param    *buff           buffer being initialized
+* @param    buff_size       size of the buffer
+*
+* @return   None
+*
+*******************************************************************************/
+static void ezStaticAlloc_InitBlockPool(void *buff, ezStaticAllocSize buff_size)
 {
-    struct MemBlock* free_block = NULL;
-    for (uint16_t i = 0; i < CONFIG_NUM_OF_MEM_BLOCK; i++)
+    uint8_t *buff_end = (uint8_t*)buff + buff_size;
+
+    for (uint16_t i = CONFIG_NUM_OF_MEM_BLOCK; i > 0U; i--)
     {
-        if (block_pool[i].buff == NULL)
+        if (is_block_pool_ready == false
+            || ((uint8_t*)block_pool[i - 1U].buff >= (uint8_t*)buff
+                && (uint8_t*)block_pool[i - 1U].buff < buff_end))
         {
-            free_block = &block_pool[i];
-            ezLinkedList_InitNode(&free_block->node);
-            break;
+            ReleaseBlock(NULL, &block_pool[i - 1U]);
+        }
+    }
+    is_block_pool_ready = true;
+}
+
+/******************************************************************************
+* Function : ezStaticAlloc_CarveHeader
+*//**
+* \b Description:
+*
+* This function takes a header from the end of a free block. The carved
+* memory stays out of the free blocks until the list is initialized again.
+*
+* PRE-CONDITION: None
+*
+* POST-CONDITION: None
+*
+* @param    *mem_list       memory list owning the block
+* @param    *block_buff     memory of the free block
+* @param    *block_size     (IN/OUT) size of the free block, reduced by the
+*                           carved memory
+* @param    keep_size       bytes at the start of the block, which must stay
+*                           in front of a non empty remaining part
+*
+* @return   the header, NULL if the block is too small
+*
+*******************************************************************************/
+static struct MemBlock *ezStaticAlloc_CarveHeader(struct MemList *mem_list,
+                                                  uint8_t *block_buff,
+                                                  ezStaticAllocSize *block_size,
+                                                  ezStaticAllocSize keep_size)
+{
+    struct MemBlock *header = NULL;
+    uintptr_t block_end = (uintptr_t)block_buff + *block_size;
+    uintptr_t header_addr = 0;
+
+    if (*block_size > keep_size + sizeof(struct MemBlock))
+    {
+        header_addr = CARVED_ALIGN_DOWN(block_end - sizeof(struct MemBlock));
+        if (header_addr > (uintptr_t)block_buff + keep_size)
+        {
+            header = (struct MemBlock*)header_addr;
+            *block_size -= (ezStaticAllocSize)(block_end - header_addr);
+            mem_list->free_bytes -= (ezStaticAllocSize)(block_end - header_addr);
+            INIT_BLOCK(header, NULL, 0U);
         }
     }
+
+    return header;
+}
+
+struct MemBlock* GetFreeBlock(struct MemList *mem_list)
+{
+    struct MemBlock* free_block = mem_list->unused_blocks;
+
+    if (NULL != free_block)
+    {
+        mem_list->unused_blocks = (free_block->node.next != NULL) ? GET_BLOCK(free_block->node.next) : NULL;
+        ezLinkedList_InitNode(&free_block->node);
+    }
+    else if (false == mem_list->is_local && NULL != unused_pool_blocks)
+    {
+        free_block = unused_pool_blocks;
+        unused_pool_blocks = (free_block->node.next != NULL) ? GET_BLOCK(free_block->node.next) : NULL;
+        ezLinkedList_InitNode(&free_block->node);
+    }
     return free_block;
 }
 
-void ReleaseBlock(struct MemBlock* block)
+void ReleaseBlock(struct MemList *mem_list, struct MemBlock* block)
 {
     INIT_BLOCK(block, NULL, 0U);
+    if (IS_POOL_BLOCK(block))
+    {
+        block->node.next = (unused_pool_blocks != NULL) ? &unused_pool_blocks->node : NULL;
+        unused_pool_blocks = block;
+    }
+    else
+    {
+        block->node.next = (mem_list->unused_blocks != NULL) ? &mem_list->unused_blocks->node : NULL;
+        mem_list->unused_blocks = block;
+    }
 }
 
-struct Node* ezStaticAlloc_ReserveMemoryBlock(struct Node* free_list_head, uint16_t block_size_byte)
+struct Node* ezStaticAlloc_ReserveMemoryBlock(struct MemList *mem_list, ezStaticAllocSize block_size_byte)
 {
     struct MemBlock* remain_block = NULL;
     struct Node* iterate_Node = NULL;
@@ -397,26 +907,36 @@ struct Node* ezStaticAlloc_ReserveMemoryBlock(struct Node* free_list_head, uint1
 
     STCMEMPRINT("ezStaticAlloc_ReserveMemoryBlock()");
 
-    if (NULL != free_list_head &&  block_size_byte > 0)
+    if (NULL != mem_list &&  block_size_byte > 0)
     {
-        EZ_LINKEDLIST_FOR_EACH(iterate_Node, free_list_head)
+        EZ_LINKEDLIST_FOR_EACH(iterate_Node, &mem_list->free_list_head)
         {
             if (GET_BLOCK(iterate_Node)->buff_size >= block_size_byte)
             {
                 if (GET_BLOCK(iterate_Node)->buff_size > block_size_byte)
                 {
-                    remain_block = GetFreeBlock();
+                    remain_block = GetFreeBlock(mem_list);
+                    if (NULL == remain_block)
+                    {
+                        remain_block = ezStaticAlloc_CarveHeader(mem_list,
+                                                                 GET_BLOCK(iterate_Node)->buff,
+                                                                 &GET_BLOCK(iterate_Node)->buff_size,
+                                                                 block_size_byte);
+                    }
                 }
 
+                /* Without a header for the remaining part, the whole block is
+                 * handed out so no memory is lost */
                 if (remain_block)
                 {
                     remain_block->buff_size = GET_BLOCK(iterate_Node)->buff_size - block_size_byte;
                     remain_block->buff = (uint8_t*)GET_BLOCK(iterate_Node)->buff + block_size_byte;
-                    EZ_LINKEDLIST_ADD_TAIL(free_list_head, &remain_block->node);
+                    EZ_LINKEDLIST_ADD_TAIL(&mem_list->free_list_head, &remain_block->node);
+                    GET_BLOCK(iterate_Node)->buff_size = block_size_byte;
+                    mem_list->num_of_split++;
+                    mem_list->num_of_free_block++;
                 }
 
-                GET_BLOCK(iterate_Node)->buff_size = block_size_byte;
-
                 success = true;
                 break;
             }
@@ -430,6 +950,213 @@ struct Node* ezStaticAlloc_ReserveMemoryBlock(struct Node* free_list_head, uint1
 
     return iterate_Node;
 }
+#endif /* EZ_STATIC_ALLOC_INBAND == 0U */
+
+#if (EZ_STATIC_ALLOC_INBAND == 1U)
+/******************************************************************************
+* Function : ezStaticAlloc_InitInBandBlock
+*//**
+* \b Description:
+*
+* This function places the header of the first free block and the end
+* sentinel in the buffer
+*
+* PRE-CONDITION: None
+*
+* POST-CONDITION: None
+*
+* @param    *buff       buffer to be managed
+* @param    buff_size   size of the buffer
+*
+* @return   the first free block, NULL if the buffer is too small
+*
+*******************************************************************************/
+static struct MemBlock *ezStaticAlloc_InitInBandBlock(void *buff, ezStaticAllocSize buff_size)
+{
+    struct MemBlock *free_block = NULL;
+    struct MemBlock *sentinel = NULL;
+    uintptr_t start = INBAND_ALIGN_UP(buff);
+    uintptr_t end = INBAND_ALIGN_DOWN((uintptr_t)buff + buff_size);
+
+    /* Room for one header, the smallest payload and the sentinel */
+    if (end > start && (end - start) >= (2U * INBAND_HEADER_SIZE + INBAND_ALIGN_SIZE))
+    {
+        free_block = (struct MemBlock*)start;
+        INIT_BLOCK(free_block, (uint8_t*)start + INBAND_HEADER_SIZE,
+            (ezStaticAllocSize)(end - start - 2U * INBAND_HEADER_SIZE));
+        free_block->is_free = 1U;
+        free_block->prev_phys = NULL;
+
+        sentinel = GET_NEXT_PHYS_BLOCK(free_block);
+        INIT_BLOCK(sentinel, (uint8_t*)sentinel + INBAND_HEADER_SIZE, 0U);
+        sentinel->is_free = 0U;
+        sentinel->prev_phys = free_block;
+    }
+
+    return free_block;
+}
+
+/******************************************************************************
+* Function : ezStaticAlloc_ReserveInBandBlock
+*//**
+* \b Description:
+*
+* This function takes the first free block which is large enough. The
+* remaining part gets its own header in the buffer if it can hold a payload.
+*
+* PRE-CONDITION: None
+*
+* POST-CONDITION: None
+*
+* @param    *mem_list           memory list owning the free list
+* @param    block_size_byte     requested size
+*
+* @return   node of the reserved block, still linked in the free list
+*
+*******************************************************************************/
+static struct Node *ezStaticAlloc_ReserveInBandBlock(struct MemList *mem_list, ezStaticAllocSize block_size_byte)
+{
+    struct Node *iterate_node = NULL;
+    struct MemBlock *block = NULL;
+    struct MemBlock *remain_block = NULL;
+    uintptr_t size = INBAND_ALIGN_UP(block_size_byte);
+    bool success = false;
+
+    STCMEMPRINT("ezStaticAlloc_ReserveInBandBlock()");
+
+    EZ_LINKEDLIST_FOR_EACH(iterate_node, &mem_list->free_list_head)
+    {
+        block = GET_BLOCK(iterate_node);
+        if (block->buff_size >= size)
+        {
+            if (block->buff_size >= size + INBAND_HEADER_SIZE + INBAND_ALIGN_SIZE)
+            {
+                remain_block = (struct MemBlock*)((uint8_t*)block->buff + size);
+                INIT_BLOCK(remain_block, (uint8_t*)remain_block + INBAND_HEADER_SIZE,
+                    (ezStaticAllocSize)(block->buff_size - size - INBAND_HEADER_SIZE));
+                remain_block->is_free = 1U;
+                remain_block->prev_phys = block;
+                GET_NEXT_PHYS_BLOCK(remain_block)->prev_phys = remain_block;
+
+                block->buff_size = (ezStaticAllocSize)size;
+                ezLinkedList_AppendNode(&remain_block->node, iterate_node);
+                mem_list->num_of_split++;
+                mem_list->num_of_free_block++;
+                mem_list->free_bytes -= (ezStaticAllocSize)INBAND_HEADER_SIZE;
+            }
+
+            block->is_free = 0U;
+            success = true;
+            break;
+        }
+    }
+
+    if (!success)
+    {
+        iterate_node = NULL;
+    }
+
+    return iterate_node;
+}
+
+/******************************************************************************
+* Function : ezStaticAlloc_GetInBandBlock
+*//**
+* \b Description:
+*
+* This function returns the header of an allocated block from its address
+*
+* PRE-CONDITION: None
+*
+* POST-CONDITION: None
+*
+* @param    *mem_list       memory list
+* @param    *alloc_addr     address returned by ezStaticAlloc_Malloc
+*
+* @return   header of the block, NULL if the address is not an allocated block
+*
+*******************************************************************************/
+static struct MemBlock *ezStaticAlloc_GetInBandBlock(struct MemList *mem_list, void *alloc_addr)
+{
+    struct MemBlock *block = NULL;
+    uintptr_t addr = (uintptr_t)alloc_addr;
+    uintptr_t start = INBAND_ALIGN_UP(mem_list->buff);
+    uintptr_t end = INBAND_ALIGN_DOWN((uintptr_t)mem_list->buff + mem_list->buff_size);
+
+    if (addr >= start + INBAND_HEADER_SIZE
+        && addr + INBAND_HEADER_SIZE < end
+        && INBAND_ALIGN_DOWN(addr) == addr)
+    {
+        block = (struct MemBlock*)(addr - INBAND_HEADER_SIZE);
+
+        /* Reject double free and addresses inside of a block */
+        if (block->buff != alloc_addr
+            || block->is_free != 0U
+            || block->buff_size == 0U
+            || (uintptr_t)GET_NEXT_PHYS_BLOCK(block) + INBAND_HEADER_SIZE > end
+            || GET_NEXT_PHYS_BLOCK(block)->prev_phys != block)
+        {
+            block = NULL;
+        }
+    }
+
+    return block;
+}
+
+/******************************************************************************
+* Function : ezStaticAlloc_ReturnInBandBlock
+*//**
+* \b Description:
+*
+* This function returns an unlinked block to the free list and merges it
+* with its free physical neighbours
+*
+* PRE-CONDITION: None
+*
+* POST-CONDITION: None
+*
+* @param    *mem_list           memory list owning the block
+* @param    *block              block to be returned
+*
+* @return   None
+*
+*******************************************************************************/
+static void ezStaticAlloc_ReturnInBandBlock(struct MemList *mem_list, struct MemBlock *block)
+{
+    struct MemBlock *neighbour = GET_NEXT_PHYS_BLOCK(block);
+
+    ezStaticAlloc_ScrubFreedMemory(mem_list, block->buff, block->buff_size);
+
+    if (neighbour->is_free != 0U)
+    {
+        STCMEMPRINT("Next adjacent block is free");
+        EZ_LINKEDLIST_UNLINK_NODE(&neighbour->node);
+        block->buff_size += (ezStaticAllocSize)(INBAND_HEADER_SIZE + neighbour->buff_size);
+        GET_NEXT_PHYS_BLOCK(block)->prev_phys = block;
+        mem_list->num_of_merge++;
+        mem_list->num_of_free_block--;
+        mem_list->free_bytes += (ezStaticAllocSize)INBAND_HEADER_SIZE;
+        ezStaticAlloc_ScrubHeader(mem_list, neighbour, INBAND_HEADER_SIZE);
+    }
+
+    neighbour = block->prev_phys;
+    if (NULL != neighbour && neighbour->is_free != 0U)
+    {
+        STCMEMPRINT("Previous adjacent block is free");
+        neighbour->buff_size += (ezStaticAllocSize)(INBAND_HEADER_SIZE + block->buff_size);
+        GET_NEXT_PHYS_BLOCK(neighbour)->prev_phys = neighbour;
+        mem_list->num_of_merge++;
+        mem_list->num_of_free_block--;
+        mem_list->free_bytes += (ezStaticAllocSize)INBAND_HEADER_SIZE;
+        ezStaticAlloc_ScrubHeader(mem_list, block, INBAND_HEADER_SIZE);
+    }
+    else
+    {
+        block->is_free = 1U;
+        EZ_LINKEDLIST_ADD_HEAD(&mem_list->free_list_head, &block->node);
+    }
+}
+#endif /* EZ_STATIC_ALLOC_INBAND == 1U */
 
 bool ezStaticAlloc_MoveBlock(struct Node* move_node, struct Node* from_list_head, struct Node* to_list_head)
 {
@@ -446,5 +1173,6 @@ bool ezStaticAlloc_MoveBlock(struct Node* move_node, struct Node* from_list_head
 
     return is_success;
 }
+#endif /* EZ_STATIC_ALLOC_TLSF == 0U */
 #endif /* CONFIG_STCMEM */
 /* End of file */
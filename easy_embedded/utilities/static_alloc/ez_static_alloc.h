@@ -18,7 +18,18 @@
  *  @brief  Public API of the static allocation component
  *
  *  @details This is the implementation of the malloc and free but it works
- * on a static memory buffer.
+ * on a static memory buffer. Two backends are available and selected at
+ * compile time with EZ_STATIC_ALLOC_TLSF:
+ * - first-fit (default): free blocks are kept in one list sorted by address
+ * - TLSF: free blocks are kept in segregated size class lists, located with
+ *   two bitmaps. Malloc and free run in constant time.
+ *
+ * The first-fit backend keeps its block headers outside of the managed
+ * buffer by default, in a pool of CONFIG_NUM_OF_MEM_BLOCK headers shared by
+ * the memory lists. When the pool is empty, a list carves its headers from
+ * the end of its own buffer. With EZ_STATIC_ALLOC_INBAND the header is
+ * stored in front of each block instead, free then finds the block and its
+ * physical neighbours in constant time.
  */
 
 #ifndef _EZ_STATIC_ALLOC_H
@@ -44,41 +55,176 @@ extern "C" {
 /*****************************************************************************
 * Component Preprocessor Macros
 *****************************************************************************/
-/* None */
+#ifndef EZ_STATIC_ALLOC_TLSF
+#define EZ_STATIC_ALLOC_TLSF    0U
+#endif /* EZ_STATIC_ALLOC_TLSF */
+
+#ifndef EZ_STATIC_ALLOC_INBAND
+#define EZ_STATIC_ALLOC_INBAND  0U
+#endif /* EZ_STATIC_ALLOC_INBAND */
+
+/* Use 32-bit sizes, so buffers and blocks can exceed 64 KiB */
+#ifndef EZ_STATIC_ALLOC_32BIT
+#define EZ_STATIC_ALLOC_32BIT   0U
+#endif /* EZ_STATIC_ALLOC_32BIT */
+
+#if (EZ_STATIC_ALLOC_32BIT == 1U)
+#define EZ_STATIC_ALLOC_SIZE_MAX    UINT32_MAX
+#else
+#define EZ_STATIC_ALLOC_SIZE_MAX    UINT16_MAX
+#endif /* EZ_STATIC_ALLOC_32BIT == 1U */
+
+/* Scrub policy given to a memory list by ezStaticAlloc_InitMemList */
+#ifndef CONFIG_EZ_STATIC_ALLOC_SCRUB_POLICY
+#define CONFIG_EZ_STATIC_ALLOC_SCRUB_POLICY EZ_STATIC_ALLOC_SCRUB_ON_FREE
+#endif /* CONFIG_EZ_STATIC_ALLOC_SCRUB_POLICY */
+
+/* Pattern written into freed memory by EZ_STATIC_ALLOC_SCRUB_POISON */
+#ifndef CONFIG_EZ_STATIC_ALLOC_POISON_BYTE
+#define CONFIG_EZ_STATIC_ALLOC_POISON_BYTE  0xA5U
+#endif /* CONFIG_EZ_STATIC_ALLOC_POISON_BYTE */
+
+#if (EZ_STATIC_ALLOC_TLSF == 0U) && (EZ_STATIC_ALLOC_INBAND == 0U)
+/* Number of block headers in the pool shared by all memory lists. A list
+ * carves further headers from its own buffer once the pool is empty */
+#ifndef CONFIG_NUM_OF_MEM_BLOCK
+#define CONFIG_NUM_OF_MEM_BLOCK     128U
+#endif /* CONFIG_NUM_OF_MEM_BLOCK */
+#endif /* EZ_STATIC_ALLOC_TLSF == 0U && EZ_STATIC_ALLOC_INBAND == 0U */
+
+#if (EZ_STATIC_ALLOC_TLSF == 1U)
+
+/* Number of second level subdivisions of a size class, in log2 */
+#ifndef CONFIG_EZ_TLSF_SL_INDEX_COUNT_LOG2
+#define CONFIG_EZ_TLSF_SL_INDEX_COUNT_LOG2  2U
+#endif /* CONFIG_EZ_TLSF_SL_INDEX_COUNT_LOG2 */
+
+#if (UINTPTR_MAX > 0xFFFFFFFFU)
+#define EZ_TLSF_ALIGN_SIZE_LOG2     3U  /**< Blocks are aligned to 8 bytes */
+#else
+#define EZ_TLSF_ALIGN_SIZE_LOG2     2U  /**< Blocks are aligned to 4 bytes */
+#endif
+
+/* Largest block is smaller than 2^EZ_TLSF_FL_INDEX_MAX, given by the size type of the API */
+#if (EZ_STATIC_ALLOC_32BIT == 1U)
+#define EZ_TLSF_FL_INDEX_MAX        32U
+#else
+#define EZ_TLSF_FL_INDEX_MAX        16U
+#endif /* EZ_STATIC_ALLOC_32BIT == 1U */
+#define EZ_TLSF_SL_INDEX_COUNT      (1U << CONFIG_EZ_TLSF_SL_INDEX_COUNT_LOG2)
+#define EZ_TLSF_FL_INDEX_SHIFT      (CONFIG_EZ_TLSF_SL_INDEX_COUNT_LOG2 + EZ_TLSF_ALIGN_SIZE_LOG2)
+#define EZ_TLSF_FL_INDEX_COUNT      (EZ_TLSF_FL_INDEX_MAX - EZ_TLSF_FL_INDEX_SHIFT + 1U)
+
+#endif /* EZ_STATIC_ALLOC_TLSF == 1U */
 
 
 /*****************************************************************************
 * Component Typedefs
 *****************************************************************************/
 
+/**@brief Size of buffers and blocks, selected by EZ_STATIC_ALLOC_32BIT
+ */
+#if (EZ_STATIC_ALLOC_32BIT == 1U)
+typedef uint32_t ezStaticAllocSize;
+#else
+typedef uint16_t ezStaticAllocSize;
+#endif /* EZ_STATIC_ALLOC_32BIT == 1U */
+
+
+/**@brief What happens to memory returned to a memory list
+ */
+typedef enum
+{
+    EZ_STATIC_ALLOC_SCRUB_NONE = 0,     /**< Freed memory is left as it is */
+    EZ_STATIC_ALLOC_SCRUB_ON_FREE,      /**< Freed memory is zeroed, allocated memory is always zero */
+    EZ_STATIC_ALLOC_SCRUB_POISON,       /**< Freed memory is filled with a pattern, which is checked on the next allocation */
+}ezStaticAllocScrub;
+
+
+/**@brief Header of a memory block
+ */
+struct MemBlock
+{
+    struct Node node;   /* Linked list node */
+    void* buff;         /* Pointer to the allocated memory */
+    ezStaticAllocSize buff_size; /* Size of the allocated memory */
+#if (EZ_STATIC_ALLOC_INBAND == 1U)
+    uint8_t is_free;    /* Block is in the free list */
+    struct MemBlock *prev_phys; /* Block located right before this one, NULL for the first one */
+#endif /* EZ_STATIC_ALLOC_INBAND == 1U */
+};
+
+
 /**@brief List to manage the memory block
  */
 struct MemList
 {
+#if (EZ_STATIC_ALLOC_TLSF == 1U)
+    struct Node free_list_head[EZ_TLSF_FL_INDEX_COUNT][EZ_TLSF_SL_INDEX_COUNT];
+    /**< Segregated lists of free blocks, one list per size class */
+    uint32_t fl_bitmap;
+    /**< Bit n is set when at least one list of first level n is not empty */
+    uint32_t sl_bitmap[EZ_TLSF_FL_INDEX_COUNT];
+    /**< Bit m of entry n is set when free_list_head[n][m] is not empty */
+#else
     struct Node free_list_head;
     /**< List to manage the free memory blocks */
     struct Node alloc_list_head;
     /**< List to manage the allocated blocks*/
+#if (EZ_STATIC_ALLOC_INBAND == 0U)
+    struct MemBlock *unused_blocks;
+    /**< Stack of unused headers carved from the buffer, linked through node.next */
+    bool is_local;
+    /**< Headers are only carved from the buffer, never taken from the shared pool */
+#endif /* EZ_STATIC_ALLOC_INBAND == 0U */
+#endif /* EZ_STATIC_ALLOC_TLSF == 1U */
     uint8_t* buff;
     /**< Pointer to the memory buffer */
-    uint16_t buff_size;
+    ezStaticAllocSize buff_size;
     /**< Size of the buffer */
+    uint8_t scrub_policy;
+    /**< ezStaticAllocScrub applied to freed memory */
+    uint16_t num_of_poison_error;
+    /**< Number of allocated blocks whose poison pattern was overwritten */
+    uint16_t num_of_alloc_block;
+    /**< Number of allocated blocks */
+    uint16_t num_of_free_block;
+    /**< Number of free blocks */
+    ezStaticAllocSize used_bytes;
+    /**< Bytes held by allocated blocks */
+    ezStaticAllocSize free_bytes;
+    /**< Bytes held by free blocks */
+    ezStaticAllocSize high_water_mark;
+    /**< Highest value of used_bytes */
+    uint32_t num_of_alloc_fail;
+    /**< Number of allocation requests which could not be served */
+    uint32_t num_of_split;
+    /**< Number of free blocks split by an allocation */
+    uint32_t num_of_merge;
+    /**< Number of free blocks merged with a neighbour */
 };
 
 
-/**@brief Header of a memory block
+/**@brief Define ezmMemList data type
  */
-struct MemBlock
-{
-    struct Node node;   /* Linked list node */
-    void* buff;         /* Pointer to the allocated memory */
-    uint16_t buff_size; /* Size of the allocated memory */
-};
+typedef struct MemList ezmMemList;
 
 
-/**@brief Define ezmMemList data type
+/**@brief Snapshot of the usage of a memory list
  */
-typedef struct MemList ezmMemList;
+typedef struct
+{
+    ezStaticAllocSize used_bytes;           /**< Bytes held by allocated blocks */
+    ezStaticAllocSize free_bytes;           /**< Bytes held by free blocks */
+    ezStaticAllocSize high_water_mark;      /**< Highest number of bytes in use since the last reset */
+    ezStaticAllocSize largest_free_block;   /**< Largest request which can be served */
+    uint16_t num_of_alloc_block;            /**< Number of allocated blocks */
+    uint16_t num_of_free_block;             /**< Number of free blocks */
+    uint32_t num_of_alloc_fail;             /**< Failed allocations since the last reset */
+    uint32_t num_of_split;                  /**< Block splits since the last reset */
+    uint32_t num_of_merge;                  /**< Block merges since the last reset */
+    uint8_t fragmentation;                  /**< Fragmentation index, in percent */
+}ezStaticAllocStats;
 
 
 /******************************************************************************
@@ -96,7 +242,9 @@ typedef struct MemList ezmMemList;
 * @brief This function initializes memory handle to manage the memory buffer
 *
 * @details After the initialization, the memory buffer can not be used
-* directly, but through the ezStaticAlloc API
+* directly, but through the ezStaticAlloc API. The list gets the scrub
+* policy CONFIG_EZ_STATIC_ALLOC_SCRUB_POLICY and the buffer is prepared
+* for it.
 *
 * @param[in]    *mem_list:      handle to manage memory buffer
 * @param[in]    *buffer:        buffer to be managed
@@ -114,7 +262,41 @@ typedef struct MemList ezmMemList;
 * @endcode
 *
 *****************************************************************************/
-bool ezStaticAlloc_InitMemList(ezmMemList* mem_list, void* buff, uint16_t buff_size);
+bool ezStaticAlloc_InitMemList(ezmMemList* mem_list, void* buff, ezStaticAllocSize buff_size);
+
+
+/*****************************************************************************
+* Function : ezStaticAlloc_InitLocalMemList
+*//** 
+* @brief This function initializes a memory list which shares no state with
+* the other lists
+*
+* @details Same as ezStaticAlloc_InitMemList, but the block headers are
+* always carved from the buffer and never taken from the pool shared by the
+* lists. Lists initialized this way can be used from different threads, as
+* long as each list is protected on its own. Carved headers take space from
+* the buffer, so the list holds fewer bytes than a shared one. With
+* EZ_STATIC_ALLOC_TLSF or EZ_STATIC_ALLOC_INBAND every list is local.
+*
+* @param[in]    *mem_list:      handle to manage memory buffer
+* @param[in]    *buffer:        buffer to be managed
+* @param[in]    buffer_size:    size of the buffer
+* @return       True is initialization is success
+*
+* @pre None
+* @post None
+*
+* \b Example
+* @code
+* ezmMemList mem_list;
+* uint8_t buff[256];
+* bool success = ezStaticAlloc_InitLocalMemList(&mem_list, buff, 256);
+* @endcode
+*
+* @see ezStaticAlloc_InitMemList
+*
+*****************************************************************************/
+bool ezStaticAlloc_InitLocalMemList(ezmMemList* mem_list, void* buff, ezStaticAllocSize buff_size);
 
 
 /*****************************************************************************
@@ -171,7 +353,7 @@ bool ezStaticAlloc_IsMemListReady(ezmMemList *mem_list);
 * @see ezStaticAlloc_InitMemList
 *
 *****************************************************************************/
-void *ezStaticAlloc_Malloc(ezmMemList* mem_list, uint16_t alloc_size);
+void *ezStaticAlloc_Malloc(ezmMemList* mem_list, ezStaticAllocSize alloc_size);
 
 
 /*****************************************************************************
@@ -211,6 +393,138 @@ void *ezStaticAlloc_Malloc(ezmMemList* mem_list, uint16_t alloc_size);
 bool ezStaticAlloc_Free(ezmMemList *mem_list, void *alloc_addr);
 
 
+/*****************************************************************************
+* Function : ezStaticAlloc_SetScrubPolicy
+*//**
+* @brief Set what happens to the memory returned to the list
+*
+* @details The free memory of the list is scrubbed according to the new
+* policy, so the guarantees of the policy hold for every later allocation.
+* EZ_STATIC_ALLOC_SCRUB_NONE avoids touching the memory when it is freed,
+* EZ_STATIC_ALLOC_SCRUB_POISON detects writes to freed memory.
+*
+* @param[in]    *mem_list:  handle to manage memory buffer
+* @param[in]    policy:     scrub policy
+* @return       true if success, else false
+*
+* @pre mem_list must initialized
+* @post None
+*
+* \b Example
+* @code
+* ezStaticAlloc_SetScrubPolicy(&mem_list, EZ_STATIC_ALLOC_SCRUB_POISON);
+* @endcode
+*
+* @see ezStaticAlloc_GetNumOfPoisonError
+*
+*****************************************************************************/
+bool ezStaticAlloc_SetScrubPolicy(ezmMemList *mem_list, ezStaticAllocScrub policy);
+
+
+/*****************************************************************************
+* Function : ezStaticAlloc_GetNumOfPoisonError
+*//**
+* @brief Return the number of use-after-free writes detected by the list
+*
+* @details Only counted with the policy EZ_STATIC_ALLOC_SCRUB_POISON. The
+* poison pattern of a block is checked when the block is allocated again.
+*
+* @param[in]    *mem_list: handle to manage memory buffer
+* @return       Number of blocks found with an overwritten poison pattern
+*
+* @pre mem_list must initialized
+* @post None
+*
+* \b Example
+* @code
+* ezStaticAlloc_GetNumOfPoisonError(&mem_list);
+* @endcode
+*
+* @see ezStaticAlloc_SetScrubPolicy
+*
+*****************************************************************************/
+uint16_t ezStaticAlloc_GetNumOfPoisonError(ezmMemList* mem_list);
+
+
+/*****************************************************************************
+* Function : ezStaticAlloc_GetStats
+*//**
+* @brief Take a snapshot of the usage of the list
+*
+* @details The counters are kept up to date by every allocation and release,
+* only the largest free block is searched when the snapshot is taken. The
+* fragmentation index is the part of the free memory, in percent, which
+* can not be served by a single allocation: 0 when all free memory is one
+* block, close to 100 when it is split into many small blocks.
+*
+* @param[in]    *mem_list:  handle to manage memory buffer
+* @param[out]   *stats:     snapshot
+* @return       true if success, else false
+*
+* @pre mem_list must initialized
+* @post None
+*
+* \b Example
+* @code
+* ezStaticAllocStats stats;
+* ezStaticAlloc_GetStats(&queue.mem_list, &stats);
+* @endcode
+*
+* @see ezStaticAlloc_ResetStats
+*
+*****************************************************************************/
+bool ezStaticAlloc_GetStats(ezmMemList *mem_list, ezStaticAllocStats *stats);
+
+
+/*****************************************************************************
+* Function : ezStaticAlloc_ResetStats
+*//**
+* @brief Restart the statistics of the list
+*
+* @details The high water mark is set to the bytes currently in use, the
+* failure, split and merge counters are cleared.
+*
+* @param[in]    *mem_list:  handle to manage memory buffer
+* @return       None
+*
+* @pre mem_list must initialized
+* @post None
+*
+* \b Example
+* @code
+* ezStaticAlloc_ResetStats(&mem_list);
+* @endcode
+*
+* @see ezStaticAlloc_GetStats
+*
+*****************************************************************************/
+void ezStaticAlloc_ResetStats(ezmMemList *mem_list);
+
+
+/*****************************************************************************
+* Function : ezStaticAlloc_GetLargestFreeBlock
+*//**
+* @brief Return the size of the largest request the list can serve
+*
+* @details
+*
+* @param[in]    *mem_list:  handle to manage memory buffer
+* @return       Size of the largest free block
+*
+* @pre mem_list must initialized
+* @post None
+*
+* \b Example
+* @code
+* ezStaticAllocSize size = ezStaticAlloc_GetLargestFreeBlock(&mem_list);
+* @endcode
+*
+* @see ezStaticAlloc_GetStats
+*
+*****************************************************************************/
+ezStaticAllocSize ezStaticAlloc_GetLargestFreeBlock(ezmMemList *mem_list);
+
+
 /*****************************************************************************
 * Function : ezStaticAlloc_GetNumOfAllocBlock
 *//** 
@@ -0,0 +1,672 @@
+/*****************************************************************************
+* Filename:         ez_static_alloc_tlsf.c
+* Author:           Hai Nguyen
+* Original Date:    26.02.2024
+*
+* ----------------------------------------------------------------------------
+* Contact:          Hai Nguyen
+*                   hainguyen.eeit@gmail.com
+*
+* ----------------------------------------------------------------------------
+* License: This file is published under the license described in LICENSE.md
+*
+*****************************************************************************/
+
+
+/** @file   ez_static_alloc_tlsf.c
+ *  @author Hai Nguyen
+ *  @date   26.02.2024
+ *  @brief  Two-Level Segregated Fit backend of the static memory allocation
+ *
+ *  @details Every block carries an in-band header in front of its payload.
+ *  The header stores the size of the block, a free flag and the address of
+ *  the physically previous block, so both neighbours are reached in constant
+ *  time when a block is freed. Free blocks are linked into one of the
+ *  segregated lists of the MemList; the first level list is selected by the
+ *  most significant bit of the size, the second level by the next
+ *  CONFIG_EZ_TLSF_SL_INDEX_COUNT_LOG2 bits. Two bitmaps record which lists
+ *  are not empty, a suitable list is found with find-first-set operations.
+ *  The end of the buffer is marked by a used sentinel block of size 0.
+ */
+
+/*****************************************************************************
+* Includes
+*****************************************************************************/
+#include "ez_static_alloc.h"
+
+#if (EZ_STATIC_ALLOC == 1U) && (EZ_STATIC_ALLOC_TLSF == 1U)
+#include "ez_hexdump.h"
+
+#include "stdbool.h"
+#include <stddef.h>
+
+/*****************************************************************************
+* Component Preprocessor Macros
+*****************************************************************************/
+#define VERBOSE         0U
+
+#define MOD_NAME        "STATIC_MEM"
+
+#if (MODULE_DEBUG == 1U) && (STCMEM_DEBUG == 1U)
+    #define STCMEMPRINT(a)            PRINT_DEBUG(MOD_NAME,a)
+    #define STCMEMPRINT1(a,b)         PRINT_DEBUG1(MOD_NAME,a,b)
+    #define STCMEMPRINT2(a,b,c)       PRINT_DEBUG2(MOD_NAME,a,b,c)
+    #define STCMEMHEXDUMP(a,b)        ezHexdump(a,b)
+#else
+    #define STCMEMPRINT(a)
+    #define STCMEMPRINT1(a,b)
+    #define STCMEMPRINT2(a,b,c)
+    #define STCMEMHEXDUMP(a,b)
+#endif
+
+#define GET_LIST(x)             ((struct MemList*)x)
+#define GET_TLSF_BLOCK(node_ptr) (EZ_LINKEDLIST_GET_PARENT_OF(node_ptr, node, struct TlsfBlock))
+
+#define ALIGN_SIZE              ((uintptr_t)1U << EZ_TLSF_ALIGN_SIZE_LOG2)
+#define ALIGN_UP(x)             (((uintptr_t)(x) + (ALIGN_SIZE - 1U)) & ~(ALIGN_SIZE - 1U))
+#define ALIGN_DOWN(x)           ((uintptr_t)(x) & ~(ALIGN_SIZE - 1U))
+
+#define SMALL_BLOCK_SIZE        ((uintptr_t)1U << EZ_TLSF_FL_INDEX_SHIFT)
+
+#define BLOCK_FREE_BIT          ((uintptr_t)1U)
+#define BLOCK_HEADER_SIZE       (offsetof(struct TlsfBlock, node))
+#define BLOCK_SIZE_MIN          ALIGN_UP(sizeof(struct Node))
+
+
+/*****************************************************************************
+* Component Typedefs
+*****************************************************************************/
+
+/**@brief In-band header of a memory block. The payload starts at the node
+ * member, the node is only used while the block is free.
+ */
+struct TlsfBlock
+{
+    struct TlsfBlock    *prev_phys; /**< Physically previous block, NULL for the first one */
+    uintptr_t           size;       /**< Payload size, bit 0 is set when the block is free */
+    struct Node         node;       /**< Node in the segregated free list */
+};
+
+
+/*****************************************************************************
+* Component Variable Definitions
+*****************************************************************************/
+/* None */
+
+
+/*****************************************************************************
+* Function Definitions
+*****************************************************************************/
+static uint32_t ezTlsf_Fls(uint32_t word);
+static uint32_t ezTlsf_Ffs(uint32_t word);
+static bool ezTlsf_MappingInsert(uintptr_t size, uint32_t *fl, uint32_t *sl);
+static bool ezTlsf_MappingSearch(uintptr_t size, uint32_t *fl, uint32_t *sl);
+static struct TlsfBlock *ezTlsf_SearchSuitableBlock(struct MemList *list, uint32_t fl, uint32_t sl);
+static void ezTlsf_InsertFreeBlock(struct MemList *list, struct TlsfBlock *block);
+static void ezTlsf_RemoveFreeBlock(struct MemList *list, struct TlsfBlock *block);
+static struct TlsfBlock *ezTlsf_NextBlock(struct TlsfBlock *block);
+static uintptr_t ezTlsf_BlockSize(struct TlsfBlock *block);
+static bool ezTlsf_IsBlockFree(struct TlsfBlock *block);
+#if (VERBOSE == 1U)
+static void ezTlsf_PrintBlocks(struct MemList *list, bool free_blocks);
+#endif /* VERBOSE */
+
+/* Shared with the first-fit backend, see ez_static_alloc.c */
+void ezStaticAlloc_ScrubFreedMemory(struct MemList *mem_list, void *addr, uint32_t size);
+void ezStaticAlloc_ScrubHeader(struct MemList *mem_list, void *addr, uint32_t size);
+bool ezStaticAlloc_CheckPoison(struct MemList *mem_list, void *addr, uint32_t size);
+void ezStaticAlloc_InitStats(struct MemList *mem_list, ezStaticAllocSize free_bytes);
+void ezStaticAlloc_CountAlloc(struct MemList *mem_list, ezStaticAllocSize block_size);
+void ezStaticAlloc_CountFree(struct MemList *mem_list, ezStaticAllocSize block_size);
+
+
+/*****************************************************************************
+* Public functions
+*****************************************************************************/
+bool ezStaticAlloc_InitMemList(ezmMemList* mem_list, void* buff, ezStaticAllocSize buff_size)
+{
+    bool is_success = true;
+    uintptr_t start = 0U;
+    uintptr_t end = 0U;
+    struct TlsfBlock *first_block = NULL;
+    struct TlsfBlock *sentinel = NULL;
+
+    STCMEMPRINT("ezStaticAlloc_InitMemList()");
+    STCMEMPRINT1("size = %d", sizeof(struct MemList));
+    if (mem_list == NULL || buff == NULL || buff_size == 0)
+    {
+        is_success = false;
+    }
+
+    if (is_success)
+    {
+        start = ALIGN_UP(buff);
+        end = ALIGN_DOWN((uintptr_t)buff + buff_size);
+
+        /* Room for one minimum block and the sentinel header */
+        if (end <= start || (end - start) < (2U * BLOCK_HEADER_SIZE + BLOCK_SIZE_MIN))
+        {
+            is_success = false;
+        }
+    }
+
+    if (is_success)
+    {
+        GET_LIST(mem_list)->buff = buff;
+        GET_LIST(mem_list)->buff_size = buff_size;
+        GET_LIST(mem_list)->fl_bitmap = 0U;
+        GET_LIST(mem_list)->num_of_free_block = 0U;
+        GET_LIST(mem_list)->scrub_policy = CONFIG_EZ_STATIC_ALLOC_SCRUB_POLICY;
+        GET_LIST(mem_list)->num_of_poison_error = 0U;
+        ezStaticAlloc_ScrubFreedMemory(GET_LIST(mem_list), buff, buff_size);
+
+        for (uint32_t fl = 0; fl < EZ_TLSF_FL_INDEX_COUNT; fl++)
+        {
+            GET_LIST(mem_list)->sl_bitmap[fl] = 0U;
+            for (uint32_t sl = 0; sl < EZ_TLSF_SL_INDEX_COUNT; sl++)
+            {
+                ezLinkedList_InitNode(&GET_LIST(mem_list)->free_list_head[fl][sl]);
+            }
+        }
+
+        first_block = (struct TlsfBlock*)start;
+        first_block->prev_phys = NULL;
+        first_block->size = (end - start) - 2U * BLOCK_HEADER_SIZE;
+
+        sentinel = ezTlsf_NextBlock(first_block);
+        sentinel->prev_phys = first_block;
+        sentinel->size = 0U;
+        ezStaticAlloc_InitStats(GET_LIST(mem_list), (ezStaticAllocSize)first_block->size);
+
+        ezTlsf_InsertFreeBlock(GET_LIST(mem_list), first_block);
+    }
+
+    ezStaticAlloc_PrintAllocList(mem_list);
+    ezStaticAlloc_PrintFreeList(mem_list);
+    return is_success;
+}
+
+
+void *ezStaticAlloc_Malloc(ezmMemList *mem_list, ezStaticAllocSize alloc_size)
+{
+    void *alloc_addr = NULL;
+    uintptr_t adjusted_size = 0U;
+    uintptr_t remain_size = 0U;
+    uint32_t fl = 0U;
+    uint32_t sl = 0U;
+    struct TlsfBlock *block = NULL;
+    struct TlsfBlock *remain_block = NULL;
+
+    STCMEMPRINT("ezStaticAlloc_Malloc()");
+
+    if (NULL != mem_list && 0U != alloc_size && ezStaticAlloc_IsMemListReady(mem_list))
+    {
+        adjusted_size = ALIGN_UP(alloc_size);
+        if (adjusted_size < BLOCK_SIZE_MIN)
+        {
+            adjusted_size = BLOCK_SIZE_MIN;
+        }
+
+        /* Larger requests can not be served, and could overflow the size mapping */
+        if (alloc_size <= mem_list->buff_size && ezTlsf_MappingSearch(adjusted_size, &fl, &sl))
+        {
+            block = ezTlsf_SearchSuitableBlock(GET_LIST(mem_list), fl, sl);
+        }
+
+        if (NULL == block)
+        {
+            GET_LIST(mem_list)->num_of_alloc_fail++;
+        }
+    }
+
+    if (NULL != block)
+    {
+        ezTlsf_RemoveFreeBlock(GET_LIST(mem_list), block);
+
+        /* Split the block if the remaining part can hold a block itself */
+        if (ezTlsf_BlockSize(block) >= adjusted_size + BLOCK_HEADER_SIZE + BLOCK_SIZE_MIN)
+        {
+            remain_size = ezTlsf_BlockSize(block) - adjusted_size - BLOCK_HEADER_SIZE;
+            block->size = adjusted_size;
+
+            remain_block = ezTlsf_NextBlock(block);
+            remain_block->prev_phys = block;
+            remain_block->size = remain_size;
+            ezTlsf_NextBlock(remain_block)->prev_phys = remain_block;
+
+            ezTlsf_InsertFreeBlock(GET_LIST(mem_list), remain_block);
+            GET_LIST(mem_list)->num_of_split++;
+            GET_LIST(mem_list)->free_bytes -= (ezStaticAllocSize)BLOCK_HEADER_SIZE;
+        }
+
+        block->size &= ~BLOCK_FREE_BIT;
+        ezStaticAlloc_CountAlloc(GET_LIST(mem_list), (ezStaticAllocSize)ezTlsf_BlockSize(block));
+        alloc_addr = (void*)&block->node;
+
+        /* The list node is the only part of the payload used by a free block */
+        (void)ezStaticAlloc_CheckPoison(GET_LIST(mem_list),
+                                        (uint8_t*)alloc_addr + sizeof(struct Node),
+                                        (uint32_t)(ezTlsf_BlockSize(block) - sizeof(struct Node)));
+        ezStaticAlloc_ScrubHeader(GET_LIST(mem_list), alloc_addr, sizeof(struct Node));
+    }
+
+    ezStaticAlloc_PrintFreeList(mem_list);
+    ezStaticAlloc_PrintAllocList(mem_list);
+
+    return alloc_addr;
+}
+
+
+bool ezStaticAlloc_Free(ezmMemList *mem_list, void *alloc_addr)
+{
+    bool is_success = false;
+    uintptr_t addr = (uintptr_t)alloc_addr;
+    struct TlsfBlock *block = NULL;
+    struct TlsfBlock *neighbour = NULL;
+
+    STCMEMPRINT1("ezStaticAlloc_Free() - [address = %p]", alloc_addr);
+
+    if (mem_list != NULL && alloc_addr != NULL && ezStaticAlloc_IsMemListReady(mem_list)
+        && addr >= ALIGN_UP(mem_list->buff) + BLOCK_HEADER_SIZE
+        && addr < (uintptr_t)mem_list->buff + mem_list->buff_size
+        && ALIGN_DOWN(addr) == addr)
+    {
+        block = (struct TlsfBlock*)(addr - BLOCK_HEADER_SIZE);
+
+        /* Reject double free and addresses which are not the start of a block */
+        if (ezTlsf_BlockSize(block) > 0U
+            && ezTlsf_IsBlockFree(block) == false
+            && (uintptr_t)ezTlsf_NextBlock(block) + BLOCK_HEADER_SIZE
+                <= ALIGN_DOWN((uintptr_t)mem_list->buff + mem_list->buff_size)
+            && ezTlsf_NextBlock(block)->prev_phys == block)
+        {
+            is_success = true;
+        }
+    }
+
+    if (is_success)
+    {
+        ezStaticAlloc_CountFree(GET_LIST(mem_list), (ezStaticAllocSize)ezTlsf_BlockSize(block));
+        ezStaticAlloc_ScrubFreedMemory(GET_LIST(mem_list), &block->node, (uint32_t)ezTlsf_BlockSize(block));
+
+        neighbour = block->prev_phys;
+        if (NULL != neighbour && ezTlsf_IsBlockFree(neighbour))
+        {
+            STCMEMPRINT("Previous adjacent block is free");
+            ezTlsf_RemoveFreeBlock(GET_LIST(mem_list), neighbour);
+            neighbour->size = ezTlsf_BlockSize(neighbour) + BLOCK_HEADER_SIZE + ezTlsf_BlockSize(block);
+            GET_LIST(mem_list)->num_of_merge++;
+            GET_LIST(mem_list)->free_bytes += (ezStaticAllocSize)BLOCK_HEADER_SIZE;
+            ezStaticAlloc_ScrubHeader(GET_LIST(mem_list), block, BLOCK_HEADER_SIZE);
+            block = neighbour;
+            ezTlsf_NextBlock(block)->prev_phys = block;
+        }
+
+        neighbour = ezTlsf_NextBlock(block);
+        if (ezTlsf_IsBlockFree(neighbour))
+        {
+            STCMEMPRINT("Next adjacent block is free");
+            ezTlsf_RemoveFreeBlock(GET_LIST(mem_list), neighbour);
+            block->size = ezTlsf_BlockSize(block) + BLOCK_HEADER_SIZE + ezTlsf_BlockSize(neighbour);
+            GET_LIST(mem_list)->num_of_merge++;
+            GET_LIST(mem_list)->free_bytes += (ezStaticAllocSize)BLOCK_HEADER_SIZE;
+            ezStaticAlloc_ScrubHeader(GET_LIST(mem_list), neighbour, BLOCK_HEADER_SIZE + sizeof(struct Node));
+            ezTlsf_NextBlock(block)->prev_phys = block;
+        }
+        else
+        {
+            block->size = ezTlsf_BlockSize(block);
+        }
+
+        ezTlsf_InsertFreeBlock(GET_LIST(mem_list), block);
+        STCMEMPRINT("Free OK");
+    }
+
+    ezStaticAlloc_PrintFreeList(mem_list);
+    ezStaticAlloc_PrintAllocList(mem_list);
+
+    return is_success;
+}
+
+
+bool ezStaticAlloc_SetScrubPolicy(ezmMemList *mem_list, ezStaticAllocScrub policy)
+{
+    bool is_success = false;
+    struct Node *it_node = NULL;
+    struct TlsfBlock *block = NULL;
+
+    if (mem_list != NULL && ezStaticAlloc_IsMemListReady(mem_list) && policy <= EZ_STATIC_ALLOC_SCRUB_POISON)
+    {
+        GET_LIST(mem_list)->scrub_policy = (uint8_t)policy;
+
+        /* Bring the free memory to the state expected by the new policy */
+        for (uint32_t fl = 0; fl < EZ_TLSF_FL_INDEX_COUNT; fl++)
+        {
+            for (uint32_t sl = 0; sl < EZ_TLSF_SL_INDEX_COUNT; sl++)
+            {
+                EZ_LINKEDLIST_FOR_EACH(it_node, &GET_LIST(mem_list)->free_list_head[fl][sl])
+                {
+                    block = GET_TLSF_BLOCK(it_node);
+                    ezStaticAlloc_ScrubFreedMemory(GET_LIST(mem_list),
+                                                   (uint8_t*)&block->node + sizeof(struct Node),
+                                                   (uint32_t)(ezTlsf_BlockSize(block) - sizeof(struct Node)));
+                }
+            }
+        }
+        is_success = true;
+    }
+
+    return is_success;
+}
+
+
+void ezStaticAlloc_PrintFreeList(ezmMemList *mem_list)
+{
+#if (VERBOSE == 1U)
+    STCMEMPRINT("*****************************************");
+    STCMEMPRINT("free list");
+    ezTlsf_PrintBlocks(GET_LIST(mem_list), true);
+    STCMEMPRINT("*****************************************\n");
+#endif
+    (void)mem_list;
+}
+
+
+void ezStaticAlloc_PrintAllocList(ezmMemList * mem_list)
+{
+#if (VERBOSE == 1U)
+    STCMEMPRINT("*****************************************");
+    STCMEMPRINT("allocated list");
+    ezTlsf_PrintBlocks(GET_LIST(mem_list), false);
+    STCMEMPRINT("*****************************************\n");
+#endif
+    (void)mem_list;
+}
+
+
+ezStaticAllocSize ezStaticAlloc_GetLargestFreeBlock(ezmMemList *mem_list)
+{
+    ezStaticAllocSize largest = 0U;
+    uint32_t fl = 0U;
+    uint32_t sl = 0U;
+    struct Node *it_node = NULL;
+
+    /* The largest block is in the highest non-empty list */
+    if (GET_LIST(mem_list)->fl_bitmap != 0U)
+    {
+        fl = ezTlsf_Fls(GET_LIST(mem_list)->fl_bitmap);
+        sl = ezTlsf_Fls(GET_LIST(mem_list)->sl_bitmap[fl]);
+
+        EZ_LINKEDLIST_FOR_EACH(it_node, &GET_LIST(mem_list)->free_list_head[fl][sl])
+        {
+            if (ezTlsf_BlockSize(GET_TLSF_BLOCK(it_node)) > largest)
+            {
+                largest = (ezStaticAllocSize)ezTlsf_BlockSize(GET_TLSF_BLOCK(it_node));
+            }
+        }
+    }
+
+    return largest;
+}
+
+
+/*****************************************************************************
+* Local functions
+*****************************************************************************/
+
+/******************************************************************************
+* Function : ezTlsf_Fls
+*//**
+* \b Description:
+*
+* Return the index of the most significant set bit. word must not be 0
+*
+* @param    word: word to be scanned
+*
+* @return   index of the bit
+*
+*******************************************************************************/
+static uint32_t ezTlsf_Fls(uint32_t word)
+{
+#if defined(__GNUC__)
+    return 31U - (uint32_t)__builtin_clz(word);
+#else
+    uint32_t bit = 0U;
+    while (word >>= 1U)
+    {
+        bit++;
+    }
+    return bit;
+#endif
+}
+
+
+/******************************************************************************
+* Function : ezTlsf_Ffs
+*//**
+* \b Description:
+*
+* Return the index of the least significant set bit. word must not be 0
+*
+* @param    word: word to be scanned
+*
+* @return   index of the bit
+*
+*******************************************************************************/
+static uint32_t ezTlsf_Ffs(uint32_t word)
+{
+#if defined(__GNUC__)
+    return (uint32_t)__builtin_ctz(word);
+#else
+    uint32_t bit = 0U;
+    while ((word & 1U) == 0U)
+    {
+        word >>= 1U;
+        bit++;
+    }
+    return bit;
+#endif
+}
+
+
+/******************************************************************************
+* Function : ezTlsf_MappingInsert
+*//**
+* \b Description:
+*
+* Compute the first and second level index of the list holding blocks of size
+*
+* @param    size: block size
+* @param    *fl: (OUT) first level index
+* @param    *sl: (OUT) second level index
+*
+* @return   true if the size fits into the index range
+*
+*******************************************************************************/
+static bool ezTlsf_MappingInsert(uintptr_t size, uint32_t *fl, uint32_t *sl)
+{
+    if (size < SMALL_BLOCK_SIZE)
+    {
+        *fl = 0U;
+        *sl = (uint32_t)(size / (SMALL_BLOCK_SIZE / EZ_TLSF_SL_INDEX_COUNT));
+    }
+    else
+    {
+        *fl = ezTlsf_Fls((uint32_t)size);
+        *sl = (uint32_t)(size >> (*fl - CONFIG_EZ_TLSF_SL_INDEX_COUNT_LOG2)) ^ EZ_TLSF_SL_INDEX_COUNT;
+        *fl -= (EZ_TLSF_FL_INDEX_SHIFT - 1U);
+    }
+
+    return (*fl < EZ_TLSF_FL_INDEX_COUNT);
+}
+
+
+/******************************************************************************
+* Function : ezTlsf_MappingSearch
+*//**
+* \b Description:
+*
+* Compute the indexes of the first list whose blocks are all at least size
+* bytes large. The size is rounded up to the next list boundary.
+*
+* @param    size: requested size
+* @param    *fl: (OUT) first level index
+* @param    *sl: (OUT) second level index
+*
+* @return   true if the size fits into the index range
+*
+*******************************************************************************/
+static bool ezTlsf_MappingSearch(uintptr_t size, uint32_t *fl, uint32_t *sl)
+{
+    if (size >= SMALL_BLOCK_SIZE)
+    {
+        size += ((uintptr_t)1U << (ezTlsf_Fls((uint32_t)size) - CONFIG_EZ_TLSF_SL_INDEX_COUNT_LOG2)) - 1U;
+    }
+
+    return ezTlsf_MappingInsert(size, fl, sl);
+}
+
+
+/******************************************************************************
+* Function : ezTlsf_SearchSuitableBlock
+*//**
+* \b Description:
+*
+* Return the first free block of the first non-empty list at or above the
+* given indexes
+*
+* @param    *list: memory list
+* @param    fl: first level index
+* @param    sl: second level index
+*
+* @return   free block or NULL if none is large enough
+*
+*******************************************************************************/
+static struct TlsfBlock *ezTlsf_SearchSuitableBlock(struct MemList *list, uint32_t fl, uint32_t sl)
+{
+    struct TlsfBlock *block = NULL;
+    uint32_t sl_map = list->sl_bitmap[fl] & (~0U << sl);
+    uint32_t fl_map = 0U;
+
+    if (sl_map == 0U)
+    {
+        fl_map = list->fl_bitmap & (~0U << (fl + 1U));
+        if (fl_map != 0U)
+        {
+            fl = ezTlsf_Ffs(fl_map);
+            sl_map = list->sl_bitmap[fl];
+        }
+    }
+
+    if (sl_map != 0U)
+    {
+        sl = ezTlsf_Ffs(sl_map);
+        block = GET_TLSF_BLOCK(list->free_list_head[fl][sl].next);
+    }
+
+    return block;
+}
+
+
+/******************************************************************************
+* Function : ezTlsf_InsertFreeBlock
+*//**
+* \b Description:
+*
+* Mark the block as free and add it to the head of its size class list
+*
+* @param    *list: memory list
+* @param    *block: block to be inserted
+*
+* @return   None
+*
+*******************************************************************************/
+static void ezTlsf_InsertFreeBlock(struct MemList *list, struct TlsfBlock *block)
+{
+    uint32_t fl = 0U;
+    uint32_t sl = 0U;
+
+    (void)ezTlsf_MappingInsert(ezTlsf_BlockSize(block), &fl, &sl);
+
+    block->size |= BLOCK_FREE_BIT;
+    EZ_LINKEDLIST_ADD_HEAD(&list->free_list_head[fl][sl], &block->node);
+    list->fl_bitmap |= (1U << fl);
+    list->sl_bitmap[fl] |= (1U << sl);
+    list->num_of_free_block++;
+}
+
+
+/******************************************************************************
+* Function : ezTlsf_RemoveFreeBlock
+*//**
+* \b Description:
+*
+* Unlink the block from its size class list and update the bitmaps. The free
+* flag is left untouched.
+*
+* @param    *list: memory list
+* @param    *block: block to be removed
+*
+* @return   None
+*
+*******************************************************************************/
+static void ezTlsf_RemoveFreeBlock(struct MemList *list, struct TlsfBlock *block)
+{
+    uint32_t fl = 0U;
+    uint32_t sl = 0U;
+
+    (void)ezTlsf_MappingInsert(ezTlsf_BlockSize(block), &fl, &sl);
+
+    EZ_LINKEDLIST_UNLINK_NODE(&block->node);
+    if (IS_LIST_EMPTY(&list->free_list_head[fl][sl]))
+    {
+        list->sl_bitmap[fl] &= ~(1U << sl);
+        if (list->sl_bitmap[fl] == 0U)
+        {
+            list->fl_bitmap &= ~(1U << fl);
+        }
+    }
+    list->num_of_free_block--;
+}
+
+
+static struct TlsfBlock *ezTlsf_NextBlock(struct TlsfBlock *block)
+{
+    return (struct TlsfBlock*)((uint8_t*)&block->node + ezTlsf_BlockSize(block));
+}
+
+
+static uintptr_t ezTlsf_BlockSize(struct TlsfBlock *block)
+{
+    return block->size & ~BLOCK_FREE_BIT;
+}
+
+
+static bool ezTlsf_IsBlockFree(struct TlsfBlock *block)
+{
+    return (block->size & BLOCK_FREE_BIT) != 0U;
+}
+
+
+#if (VERBOSE == 1U)
+static void ezTlsf_PrintBlocks(struct MemList *list, bool free_blocks)
+{
+    struct TlsfBlock *block = (struct TlsfBlock*)ALIGN_UP(list->buff);
+
+    while (ezTlsf_BlockSize(block) > 0U)
+    {
+        if (ezTlsf_IsBlockFree(block) == free_blocks)
+        {
+            STCMEMPRINT1("[addr = %p]", block);
+            STCMEMPRINT1("[prev = %p]", block->prev_phys);
+            STCMEMPRINT1("[buff = %p]", &block->node);
+            STCMEMPRINT1("[size = %d]", ezTlsf_BlockSize(block));
+            STCMEMPRINT("<======>");
+        }
+        block = ezTlsf_NextBlock(block);
+    }
+}
+#endif /* VERBOSE */
+
+#endif /* EZ_STATIC_ALLOC == 1U && EZ_STATIC_ALLOC_TLSF == 1U */
+/* End of file */
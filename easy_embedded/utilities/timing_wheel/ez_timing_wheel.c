@@ -0,0 +1,338 @@
+/*****************************************************************************
+* Filename:         ez_timing_wheel.c
+* Author:           Hai Nguyen
+* Original Date:    18.10.2026
+*
+* ----------------------------------------------------------------------------
+* Contact:          Hai Nguyen
+*                   hainguyen.eeit@gmail.com
+*
+* ----------------------------------------------------------------------------
+* License: This file is published under the license described in LICENSE.md
+*
+*****************************************************************************/
+
+/** @file   ez_timing_wheel.c
+ *  @author Hai Nguyen
+ *  @date   18.10.2026
+ *  @brief  Implementation of the timing wheel
+ *
+ *  @details A timer expiring within one rotation of level n, counted from
+ *  the next tick, sits in level n at the slot of its expiry. When level n
+ *  wraps around, the next slot of level n + 1 is moved down, so every timer
+ *  reaches level 0 before it expires.
+ */
+
+
+/*****************************************************************************
+* Includes
+*****************************************************************************/
+#include "ez_timing_wheel.h"
+
+#if (EZ_TIMING_WHEEL == 1U)
+
+/*****************************************************************************
+* Component Preprocessor Macros
+*****************************************************************************/
+#define SLOT_MASK           (EZ_TIMING_WHEEL_NUM_OF_SLOT - 1UL)
+#define LEVEL_SHIFT(level)  ((level) * CONFIG_EZ_TIMING_WHEEL_SLOT_BITS)
+#define MAX_DISTANCE        ((1UL << LEVEL_SHIFT(CONFIG_EZ_TIMING_WHEEL_NUM_OF_LEVEL)) - 1UL)
+
+/* Tick a is before tick b, wrap around safe */
+#define IS_BEFORE(a, b)     ((int32_t)((uint32_t)(a) - (uint32_t)(b)) < 0)
+
+
+/*****************************************************************************
+* Component Typedefs
+*****************************************************************************/
+/* None */
+
+
+/*****************************************************************************
+* Component Variable Definitions
+*****************************************************************************/
+/* None */
+
+
+/*****************************************************************************
+* Function Definitions
+*****************************************************************************/
+static void ezTimingWheel_PlaceTimer(struct ezTimingWheel *wheel, struct ezTimingWheelTimer *timer);
+static void ezTimingWheel_Cascade(struct ezTimingWheel *wheel, struct Node *slot);
+
+
+/*****************************************************************************
+* External functions
+*****************************************************************************/
+bool ezTimingWheel_Init(struct ezTimingWheel *wheel, uint32_t now)
+{
+    bool is_success = false;
+    uint32_t level = 0;
+    uint32_t i = 0;
+
+    if (wheel != NULL)
+    {
+        for (level = 0; level < CONFIG_EZ_TIMING_WHEEL_NUM_OF_LEVEL; level++)
+        {
+            for (i = 0; i < EZ_TIMING_WHEEL_NUM_OF_SLOT; i++)
+            {
+                ezLinkedList_InitNode(&wheel->slots[level][i]);
+            }
+        }
+        wheel->next_tick = now + 1U;
+        wheel->num_of_timer = 0;
+        is_success = true;
+    }
+
+    return is_success;
+}
+
+
+void ezTimingWheel_InitTimer(struct ezTimingWheelTimer *timer)
+{
+    ezLinkedList_InitNode(&timer->node);
+    timer->expiry = 0;
+}
+
+
+bool ezTimingWheel_AddTimer(struct ezTimingWheel *wheel,
+                            struct ezTimingWheelTimer *timer,
+                            uint32_t expiry)
+{
+    bool is_success = false;
+
+    if (wheel != NULL && timer != NULL && ezTimingWheel_IsTimerActive(timer) == false)
+    {
+        timer->expiry = expiry;
+        ezTimingWheel_PlaceTimer(wheel, timer);
+        wheel->num_of_timer++;
+        is_success = true;
+    }
+
+    return is_success;
+}
+
+
+bool ezTimingWheel_RemoveTimer(struct ezTimingWheel *wheel, struct ezTimingWheelTimer *timer)
+{
+    bool is_success = false;
+
+    if (wheel != NULL && timer != NULL && ezTimingWheel_IsTimerActive(timer) == true)
+    {
+        EZ_LINKEDLIST_UNLINK_NODE(&timer->node);
+        wheel->num_of_timer--;
+        is_success = true;
+    }
+
+    return is_success;
+}
+
+
+bool ezTimingWheel_IsTimerActive(struct ezTimingWheelTimer *timer)
+{
+    bool is_active = false;
+
+    if (timer != NULL)
+    {
+        is_active = !IS_LIST_EMPTY(&timer->node);
+    }
+
+    return is_active;
+}
+
+
+uint32_t ezTimingWheel_Advance(struct ezTimingWheel *wheel,
+                               uint32_t now,
+                               ezTimingWheel_ExpireFunc expire_func,
+                               void *arg)
+{
+    struct Node expired_list = EZ_LINKEDLIST_INIT_NODE(expired_list);
+    struct Node *node = NULL;
+    uint32_t num_of_expired = 0;
+    uint32_t tick = 0;
+    uint32_t index = 0;
+    uint32_t level = 0;
+
+    if (wheel != NULL && expire_func != NULL)
+    {
+        while (wheel->num_of_timer > 0
+               && ezTimingWheel_GetNextTick(wheel, &tick) == true
+               && IS_BEFORE(now, tick) == false)
+        {
+            /* Skipped ticks have no timer to expire or to move down */
+            wheel->next_tick = tick;
+            index = tick & SLOT_MASK;
+            for (level = 1; index == 0 && level < CONFIG_EZ_TIMING_WHEEL_NUM_OF_LEVEL; level++)
+            {
+                index = (tick >> LEVEL_SHIFT(level)) & SLOT_MASK;
+                ezTimingWheel_Cascade(wheel, &wheel->slots[level][index]);
+            }
+
+            /* Detach the slot first, expire_func may add timers to it again */
+            wheel->next_tick = tick + 1U;
+            ezLinkedList_SpliceTail(&expired_list, &wheel->slots[0][tick & SLOT_MASK]);
+            while (!IS_LIST_EMPTY(&expired_list))
+            {
+                node = expired_list.next;
+                EZ_LINKEDLIST_UNLINK_NODE(node);
+                wheel->num_of_timer--;
+                num_of_expired++;
+                expire_func(EZ_TIMING_WHEEL_GET_PARENT_OF(node, node, struct ezTimingWheelTimer), arg);
+            }
+        }
+
+        if (IS_BEFORE(now, wheel->next_tick) == false)
+        {
+            wheel->next_tick = now + 1U;
+        }
+    }
+
+    return num_of_expired;
+}
+
+
+bool ezTimingWheel_GetNextTick(struct ezTimingWheel *wheel, uint32_t *tick)
+{
+    bool is_success = false;
+    uint32_t best_distance = MAX_DISTANCE;
+    uint32_t distance = 0;
+    uint32_t boundary = 0;
+    uint32_t shift = 0;
+    uint32_t level = 0;
+    uint32_t i = 0;
+
+    if (wheel != NULL && tick != NULL && wheel->num_of_timer > 0)
+    {
+        /* Level 0 timers expire within one rotation */
+        for (i = 0; i < EZ_TIMING_WHEEL_NUM_OF_SLOT; i++)
+        {
+            if (!IS_LIST_EMPTY(&wheel->slots[0][(wheel->next_tick + i) & SLOT_MASK]))
+            {
+                best_distance = i;
+                break;
+            }
+        }
+
+        /* Higher level timers move down at the next boundaries of their level */
+        for (level = 1; level < CONFIG_EZ_TIMING_WHEEL_NUM_OF_LEVEL; level++)
+        {
+            shift = LEVEL_SHIFT(level);
+            boundary = (wheel->next_tick + (1UL << shift) - 1UL) & ~((1UL << shift) - 1UL);
+            for (i = 0; i < EZ_TIMING_WHEEL_NUM_OF_SLOT; i++)
+            {
+                distance = boundary + (i << shift) - wheel->next_tick;
+                if (distance >= best_distance)
+                {
+                    break;
+                }
+
+                if (!IS_LIST_EMPTY(&wheel->slots[level][((boundary >> shift) + i) & SLOT_MASK]))
+                {
+                    best_distance = distance;
+                    break;
+                }
+            }
+        }
+
+        *tick = wheel->next_tick + best_distance;
+        is_success = true;
+    }
+
+    return is_success;
+}
+
+
+uint32_t ezTimingWheel_GetNumOfTimer(struct ezTimingWheel *wheel)
+{
+    uint32_t num_of_timer = 0;
+
+    if (wheel != NULL)
+    {
+        num_of_timer = wheel->num_of_timer;
+    }
+
+    return num_of_timer;
+}
+
+
+/*****************************************************************************
+* Local functions
+*****************************************************************************/
+
+/*****************************************************************************
+* Function : ezTimingWheel_PlaceTimer
+*//**
+* @brief Link a timer to the slot matching its expiry
+*
+* @details An expired timer goes to the slot of the next tick. A timer
+* beyond the range of the wheel goes to the last slot of the last level
+* and is placed again when that slot moves down.
+*
+* @param    wheel: (IN)pointer to the wheel
+* @param    timer: (IN)timer, not linked to any slot
+* @return   None
+*
+* @pre None
+* @post None
+*
+*****************************************************************************/
+static void ezTimingWheel_PlaceTimer(struct ezTimingWheel *wheel, struct ezTimingWheelTimer *timer)
+{
+    uint32_t expiry = timer->expiry;
+    uint32_t distance = expiry - wheel->next_tick;
+    uint32_t level = 0;
+
+    if (IS_BEFORE(expiry, wheel->next_tick))
+    {
+        expiry = wheel->next_tick;
+        distance = 0;
+    }
+    else if (distance > MAX_DISTANCE)
+    {
+        expiry = wheel->next_tick + MAX_DISTANCE;
+        distance = MAX_DISTANCE;
+    }
+
+    while (level < CONFIG_EZ_TIMING_WHEEL_NUM_OF_LEVEL - 1U
+           && distance >= (1UL << LEVEL_SHIFT(level + 1U)))
+    {
+        level++;
+    }
+
+    (void)EZ_LINKEDLIST_ADD_TAIL(&wheel->slots[level][(expiry >> LEVEL_SHIFT(level)) & SLOT_MASK],
+                                 &timer->node);
+}
+
+
+/*****************************************************************************
+* Function : ezTimingWheel_Cascade
+*//**
+* @brief Place again every timer of a slot, relatively to the next tick
+*
+* @details
+*
+* @param    wheel: (IN)pointer to the wheel
+* @param    slot: (IN)slot to empty
+* @return   None
+*
+* @pre None
+* @post None
+*
+*****************************************************************************/
+static void ezTimingWheel_Cascade(struct ezTimingWheel *wheel, struct Node *slot)
+{
+    struct Node moved_list = EZ_LINKEDLIST_INIT_NODE(moved_list);
+    struct Node *node = NULL;
+
+    ezLinkedList_SpliceTail(&moved_list, slot);
+    while (!IS_LIST_EMPTY(&moved_list))
+    {
+        node = moved_list.next;
+        EZ_LINKEDLIST_UNLINK_NODE(node);
+        ezTimingWheel_PlaceTimer(wheel, EZ_TIMING_WHEEL_GET_PARENT_OF(node, node, struct ezTimingWheelTimer));
+    }
+}
+
+#endif /* EZ_TIMING_WHEEL == 1U */
+
+/* End of file */
@@ -0,0 +1,307 @@
+/*****************************************************************************
+* Filename:         ez_timing_wheel.h
+* Author:           Hai Nguyen
+* Original Date:    18.10.2026
+*
+* ----------------------------------------------------------------------------
+* Contact:          Hai Nguyen
+*                   hainguyen.eeit@gmail.com
+*
+* ----------------------------------------------------------------------------
+* License: This file is published under the license described in LICENSE.md
+*
+*****************************************************************************/
+
+/** @file   ez_timing_wheel.h
+ *  @author Hai Nguyen
+ *  @date   18.10.2026
+ *  @brief  Public functions of the timing wheel component
+ *
+ *  @details Hierarchical timing wheel. A struct ezTimingWheelTimer is
+ *  embedded in the user's data structure, so nothing is allocated. Adding
+ *  and removing a timer is O(1), and advancing the wheel costs O(1) per
+ *  tick plus one move per level a timer goes down. Ticks are uint32_t and
+ *  wrap around, so a timer must expire within 2^31 ticks.
+ */
+
+#ifndef _EZ_TIMING_WHEEL_H
+#define _EZ_TIMING_WHEEL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*****************************************************************************
+* Includes
+*****************************************************************************/
+#if (EZ_BUILD_WITH_CMAKE == 0U)
+#include "ez_target_config.h"
+#endif
+
+#if (EZ_TIMING_WHEEL == 1U)
+#include <stdint.h>
+#include <stdbool.h>
+#include "ez_linked_list.h"
+
+
+/*****************************************************************************
+* Component Preprocessor Macros
+*****************************************************************************/
+#ifndef CONFIG_EZ_TIMING_WHEEL_SLOT_BITS
+#define CONFIG_EZ_TIMING_WHEEL_SLOT_BITS    4U  /* 16 slots per level */
+#endif
+
+#ifndef CONFIG_EZ_TIMING_WHEEL_NUM_OF_LEVEL
+#define CONFIG_EZ_TIMING_WHEEL_NUM_OF_LEVEL 4U  /* 2^16 ticks, farther timers wait in the last level */
+#endif
+
+#if (CONFIG_EZ_TIMING_WHEEL_SLOT_BITS * CONFIG_EZ_TIMING_WHEEL_NUM_OF_LEVEL > 31U)
+#error The timing wheel must cover less than 2^32 ticks
+#endif
+
+#define EZ_TIMING_WHEEL_NUM_OF_SLOT (1UL << CONFIG_EZ_TIMING_WHEEL_SLOT_BITS)
+
+/*@brief Get the parent of the data structure, where the timer is embedded
+ *
+ */
+#define EZ_TIMING_WHEEL_GET_PARENT_OF(ptr, member, type) \
+    EZ_LINKEDLIST_GET_PARENT_OF(ptr, member, type)
+
+
+/*****************************************************************************
+* Component Typedefs
+*****************************************************************************/
+
+/** @brief Timer, embedded in the user's data structure
+ */
+struct ezTimingWheelTimer
+{
+    struct Node node;               /**< Node in a slot of the wheel */
+    uint32_t expiry;                /**< Tick when the timer expires */
+};
+
+
+/** @brief Timing wheel. Level 0 has one slot per tick, every slot of the
+ *  next level covers a whole rotation of the previous one
+ */
+struct ezTimingWheel
+{
+    struct Node slots[CONFIG_EZ_TIMING_WHEEL_NUM_OF_LEVEL][EZ_TIMING_WHEEL_NUM_OF_SLOT];   /**< Lists of timers */
+    uint32_t next_tick;             /**< Next tick to process */
+    uint32_t num_of_timer;          /**< Number of timers in the wheel */
+};
+
+
+/** @brief Function called for every expired timer. The timer is already
+ *  removed, so it can be added again
+ */
+typedef void (*ezTimingWheel_ExpireFunc)(struct ezTimingWheelTimer *timer, void *arg);
+
+
+/*****************************************************************************
+* Component Variable Definitions
+*****************************************************************************/
+/* None */
+
+
+/*****************************************************************************
+* Function Prototypes
+*****************************************************************************/
+
+/*****************************************************************************
+* Function : ezTimingWheel_Init
+*//**
+* @brief Initialize an empty timing wheel
+*
+* @details
+*
+* @param    wheel: (IN)pointer to the wheel
+* @param    now: (IN)current tick, considered as processed
+* @return   true if success, else false
+*
+* @pre None
+* @post None
+*
+* @code
+* static struct ezTimingWheel wheel;
+* ezTimingWheel_Init(&wheel, GetTick());
+* @endcode
+*
+*****************************************************************************/
+bool ezTimingWheel_Init(struct ezTimingWheel *wheel, uint32_t now);
+
+
+/*****************************************************************************
+* Function : ezTimingWheel_InitTimer
+*//**
+* @brief Initialize a timer, before it is added the first time
+*
+* @details
+*
+* @param    timer: (IN)pointer to the timer
+* @return   None
+*
+* @pre None
+* @post None
+*
+* @code
+* ezTimingWheel_InitTimer(&blink->timer);
+* @endcode
+*
+*****************************************************************************/
+void ezTimingWheel_InitTimer(struct ezTimingWheelTimer *timer);
+
+
+/*****************************************************************************
+* Function : ezTimingWheel_AddTimer
+*//**
+* @brief Add a timer expiring at a given tick
+*
+* @details A timer whose expiry is already processed expires at the next
+* processed tick
+*
+* @param    wheel: (IN)pointer to the wheel
+* @param    timer: (IN)timer to add
+* @param    expiry: (IN)tick when the timer expires
+* @return   true if success, false if the timer is already in a wheel
+*
+* @pre timer is initialized by ezTimingWheel_InitTimer
+* @post None
+*
+* @code
+* ezTimingWheel_AddTimer(&wheel, &blink->timer, GetTick() + 500);
+* @endcode
+*
+*****************************************************************************/
+bool ezTimingWheel_AddTimer(struct ezTimingWheel *wheel,
+                            struct ezTimingWheelTimer *timer,
+                            uint32_t expiry);
+
+
+/*****************************************************************************
+* Function : ezTimingWheel_RemoveTimer
+*//**
+* @brief Remove a timer before it expires
+*
+* @details
+*
+* @param    wheel: (IN)pointer to the wheel
+* @param    timer: (IN)timer to remove
+* @return   true if success, false if the timer is not in a wheel
+*
+* @pre None
+* @post None
+*
+* @code
+* ezTimingWheel_RemoveTimer(&wheel, &blink->timer);
+* @endcode
+*
+*****************************************************************************/
+bool ezTimingWheel_RemoveTimer(struct ezTimingWheel *wheel, struct ezTimingWheelTimer *timer);
+
+
+/*****************************************************************************
+* Function : ezTimingWheel_IsTimerActive
+*//**
+* @brief Check if a timer is in a wheel
+*
+* @details
+*
+* @param    timer: (IN)pointer to the timer
+* @return   true if the timer is in a wheel
+*
+* @pre timer is initialized by ezTimingWheel_InitTimer
+* @post None
+*
+* @code
+* bool is_running = ezTimingWheel_IsTimerActive(&blink->timer);
+* @endcode
+*
+*****************************************************************************/
+bool ezTimingWheel_IsTimerActive(struct ezTimingWheelTimer *timer);
+
+
+/*****************************************************************************
+* Function : ezTimingWheel_Advance
+*//**
+* @brief Process every tick until now and expire the due timers
+*
+* @details Ticks where nothing happens are skipped, so a late call does not
+* cost more than the timers it expires
+*
+* @param    wheel: (IN)pointer to the wheel
+* @param    now: (IN)current tick
+* @param    expire_func: (IN)function called for every expired timer
+* @param    arg: (IN)argument passed to expire_func
+* @return   number of expired timers
+*
+* @pre None
+* @post None
+*
+* @code
+* ezTimingWheel_Advance(&wheel, GetTick(), OnTimerExpired, NULL);
+* @endcode
+*
+*****************************************************************************/
+uint32_t ezTimingWheel_Advance(struct ezTimingWheel *wheel,
+                               uint32_t now,
+                               ezTimingWheel_ExpireFunc expire_func,
+                               void *arg);
+
+
+/*****************************************************************************
+* Function : ezTimingWheel_GetNextTick
+*//**
+* @brief Get the next tick when ezTimingWheel_Advance has work to do
+*
+* @details The tick is the earliest expiry, or earlier when timers must
+* move down a level first. Sleeping until this tick is always safe.
+*
+* @param    wheel: (IN)pointer to the wheel
+* @param    tick: (OUT)next tick to process
+* @return   true if success, false if the wheel has no timer
+*
+* @pre None
+* @post None
+*
+* @code
+* uint32_t tick;
+* if (ezTimingWheel_GetNextTick(&wheel, &tick) == true)
+* {
+*     Sleep(tick - GetTick());
+* }
+* @endcode
+*
+*****************************************************************************/
+bool ezTimingWheel_GetNextTick(struct ezTimingWheel *wheel, uint32_t *tick);
+
+
+/*****************************************************************************
+* Function : ezTimingWheel_GetNumOfTimer
+*//**
+* @brief Return the number of timers in the wheel
+*
+* @details
+*
+* @param    wheel: (IN)pointer to the wheel
+* @return   number of timers
+*
+* @pre None
+* @post None
+*
+* @code
+* uint32_t num_of_timer = ezTimingWheel_GetNumOfTimer(&wheel);
+* @endcode
+*
+*****************************************************************************/
+uint32_t ezTimingWheel_GetNumOfTimer(struct ezTimingWheel *wheel);
+
+#endif /* EZ_TIMING_WHEEL == 1U */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _EZ_TIMING_WHEEL_H */
+
+/* End of file */
@@ -4,16 +4,30 @@ option(ENABLE_EZ_LOGGING_COLOR  "Enable logging using color feature"    ON)
 option(ENABLE_EZ_LINKEDLIST     "Enable linked list feature"            ON)
 option(ENABLE_EZ_HEXDUMP        "Enable hexdump feature"                ON)
 option(ENABLE_EZ_RING_BUFFER    "Enable ring buffer feature"            ON)
+option(ENABLE_EZ_RING_BUFFER_32BIT "Use 32-bit sizes for the ring buffer" OFF)
+option(ENABLE_EZ_SPSC_RING_BUFFER "Enable lock-free SPSC ring buffer feature" ON)
 option(ENABLE_EZ_ASSERT         "Enable assert feature"                 OFF)
 option(ENABLE_EZ_STATIC_ALLOC   "Enable static allocation feature"      ON)
+option(ENABLE_EZ_STATIC_ALLOC_TLSF "Use TLSF backend for static allocation" OFF)
+option(ENABLE_EZ_STATIC_ALLOC_INBAND "Store static allocation headers in the buffer" OFF)
+option(ENABLE_EZ_STATIC_ALLOC_32BIT "Use 32-bit sizes for static allocation" OFF)
 option(ENABLE_EZ_SYS_ERROR      "Enable system error feature"           ON)
 option(ENABLE_EZ_QUEUE          "Enable queue feature"                  ON)
+option(ENABLE_EZ_QUEUE_RING     "Store queue elements in a ring buffer" OFF)
+option(ENABLE_EZ_MPMC_QUEUE     "Enable lock-free MPMC queue feature"   ON)
+option(ENABLE_EZ_OBJ_POOL       "Enable object pool feature"            ON)
+option(ENABLE_EZ_PRIORITY_QUEUE "Enable priority queue feature"         ON)
+option(ENABLE_EZ_HASH_TABLE    "Enable hash table feature"             ON)
+option(ENABLE_EZ_TIMING_WHEEL  "Enable timing wheel feature"           ON)
 
 # Configure Service modules
 option(ENABLE_EZ_EVENT_NOTIFIER    "Enable the Event Notifier module"       ON)
 option(ENABLE_EZ_KERNEL            "Enable the Kernel service"              OFF)
 option(ENABLE_EZ_TASK_WORKER       "Enable the task worker"                 ON)
 option(ENABLE_EZ_STATE_MACHINE     "Enable state machine"                   ON)
+option(ENABLE_EZ_OSAL              "Enable the OS abstraction layer"        ON)
+option(ENABLE_EZ_BLOCKING_QUEUE    "Enable the blocking queue"              ON)
+option(ENABLE_EZ_TASK_WORKER_POOL  "Enable the task worker pool"            ON)
 
 # Configure application framework
 option(ENABLE_DATA_MODEL        "Enable the Event Notifier module"          ON)
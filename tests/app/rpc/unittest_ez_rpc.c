@@ -0,0 +1,397 @@
+/*****************************************************************************
+* Filename:         unittest_ez_rpc.c
+* Author:           Hai Nguyen
+* Original Date:    18.10.2026
+*
+* ----------------------------------------------------------------------------
+* Contact:          Hai Nguyen
+*                   hainguyen.eeit@gmail.com
+*
+* ----------------------------------------------------------------------------
+* License: This file is published under the license described in LICENSE.md
+*
+*****************************************************************************/
+
+/** @file   unittest_ez_rpc.c
+ *  @author Hai Nguyen
+ *  @date   18.10.2026
+ *  @brief  Unit test for the service dispatch of the rpc component
+ *
+ *  @details The service and dispatch tables are generated from
+ *  test_rpc_services.json by tools/rpc_dispatch_generator
+ *
+ */
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "unity.h"
+#include "unity_fixture.h"
+#include "ez_rpc.h"
+#include "test_rpc_services.h"
+
+TEST_GROUP(ez_rpc);
+
+/******************************************************************************
+* Module Preprocessor Macros
+*******************************************************************************/
+#define BUFF_SIZE           2048U   /**< Shared by the tx and rx queues */
+#define FRAME_SIZE          64U     /**< Max size of a frame fed to the instance */
+#define PAYLOAD_SIZE        4U      /**< Size of the test payload */
+#define NUM_OF_TAG          256U    /**< Tags are 8 bits */
+#define NO_HANDLER          0xFFU   /**< No handler has been called */
+#define MAX_NUM_OF_RUN      4U      /**< Runs needed to handle a frame */
+
+
+/******************************************************************************
+* Module Typedefs
+*******************************************************************************/
+/* None */
+
+
+/******************************************************************************
+* Module Variable Definitions
+*******************************************************************************/
+static struct ezRpc rpc_inst;
+static uint8_t rpc_buff[BUFF_SIZE];
+
+static uint8_t rx_stream[FRAME_SIZE];
+static uint32_t rx_stream_size = 0U;
+static uint32_t rx_index = 0U;
+
+static uint8_t called_handler = NO_HANDLER;
+static uint32_t num_of_call = 0U;
+static uint8_t received_payload[PAYLOAD_SIZE];
+static uint32_t received_payload_size = 0U;
+
+static const uint8_t test_payload[PAYLOAD_SIZE] = { 0xDE, 0xAD, 0xBE, 0xEF };
+
+
+/******************************************************************************
+* Function Definitions
+*******************************************************************************/
+static void RunAllTests(void);
+static uint32_t TestRpc_Transmit(uint8_t *tx_data, uint32_t tx_size);
+static uint32_t TestRpc_Receive(uint8_t *rx_data, uint32_t rx_size);
+static void TestRpc_Record(uint8_t handler, void *payload, uint32_t payload_size);
+static void TestRpc_FeedFrame(uint8_t tag);
+static void TestRpc_Init(struct ezRpcService *service_table, uint32_t service_table_size);
+
+
+/******************************************************************************
+* External functions
+*******************************************************************************/
+int main(int argc, const char *argv[])
+{
+    return UnityMain(argc, argv, RunAllTests);
+}
+
+
+TEST_SETUP(ez_rpc)
+{
+    TestRpc_Init(test_rpc_service_table, TEST_RPC_NUM_OF_SERVICE);
+}
+
+
+TEST_TEAR_DOWN(ez_rpc)
+{
+}
+
+
+TEST_GROUP_RUNNER(ez_rpc)
+{
+    RUN_TEST_CASE(ez_rpc, SetDispatchTable_InvalidParam);
+    RUN_TEST_CASE(ez_rpc, GeneratedTable_Layout);
+    RUN_TEST_CASE(ez_rpc, Dispatch_KnownTag);
+    RUN_TEST_CASE(ez_rpc, Dispatch_UnknownTag);
+    RUN_TEST_CASE(ez_rpc, ScanAndDispatch_Agree);
+    RUN_TEST_CASE(ez_rpc, NullHandler_ConsumesPayload);
+#if (EZ_RPC_ITEM_POOL == 1U)
+    RUN_TEST_CASE(ez_rpc, QueueItemPool);
+#endif /* EZ_RPC_ITEM_POOL == 1U */
+}
+
+
+TEST(ez_rpc, SetDispatchTable_InvalidParam)
+{
+    const struct ezRpcDispatchTable no_entry = { NULL, 1U };
+    const struct ezRpcDispatchTable no_modulus = { test_rpc_service_table, 0U };
+
+    TEST_ASSERT_EQUAL(ezFAIL, ezRpc_SetDispatchTable(NULL, &test_rpc_dispatch_table));
+    TEST_ASSERT_EQUAL(ezFAIL, ezRpc_SetDispatchTable(&rpc_inst, &no_entry));
+    TEST_ASSERT_EQUAL(ezFAIL, ezRpc_SetDispatchTable(&rpc_inst, &no_modulus));
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezRpc_SetDispatchTable(&rpc_inst, &test_rpc_dispatch_table));
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezRpc_SetDispatchTable(&rpc_inst, NULL));
+}
+
+
+TEST(ez_rpc, GeneratedTable_Layout)
+{
+    uint32_t i = 0;
+    uint32_t modulus = test_rpc_dispatch_table.modulus;
+    const struct ezRpcService *entry = NULL;
+
+    TEST_ASSERT_TRUE(modulus >= TEST_RPC_NUM_OF_SERVICE);
+    TEST_ASSERT_TRUE(modulus <= NUM_OF_TAG);
+
+    for (i = 0; i < TEST_RPC_NUM_OF_SERVICE; i++)
+    {
+        entry = &test_rpc_dispatch_table.entries[test_rpc_service_table[i].tag % modulus];
+        TEST_ASSERT_EQUAL(test_rpc_service_table[i].tag, entry->tag);
+        TEST_ASSERT_EQUAL_PTR(test_rpc_service_table[i].pfnService, entry->pfnService);
+    }
+
+    /* Unused entries must not be reachable by any tag */
+    for (i = 0; i < modulus; i++)
+    {
+        entry = &test_rpc_dispatch_table.entries[i];
+        if (entry->pfnService == NULL)
+        {
+            TEST_ASSERT_NOT_EQUAL(i, entry->tag % modulus);
+        }
+    }
+}
+
+
+TEST(ez_rpc, Dispatch_KnownTag)
+{
+    uint32_t i = 0;
+
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezRpc_SetDispatchTable(&rpc_inst, &test_rpc_dispatch_table));
+
+    for (i = 0; i < TEST_RPC_NUM_OF_SERVICE; i++)
+    {
+        TestRpc_FeedFrame(test_rpc_service_table[i].tag);
+
+        TEST_ASSERT_EQUAL(1U, num_of_call);
+        TEST_ASSERT_EQUAL(i, called_handler);
+        TEST_ASSERT_EQUAL(PAYLOAD_SIZE, received_payload_size);
+        TEST_ASSERT_EQUAL_UINT8_ARRAY(test_payload, received_payload, PAYLOAD_SIZE);
+        TEST_ASSERT_TRUE(ezQueue_IsEmpty(&rpc_inst.rx_msg_queue));
+    }
+}
+
+
+TEST(ez_rpc, Dispatch_UnknownTag)
+{
+    uint32_t i = 0;
+    uint32_t modulus = test_rpc_dispatch_table.modulus;
+
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezRpc_SetDispatchTable(&rpc_inst, &test_rpc_dispatch_table));
+
+    /* A tag equal to the index of an unused entry, and a tag colliding
+     * with a service */
+    for (i = 0; i < modulus; i++)
+    {
+        if (test_rpc_dispatch_table.entries[i].pfnService == NULL)
+        {
+            break;
+        }
+    }
+    TEST_ASSERT_TRUE(i < modulus);
+
+    TestRpc_FeedFrame((uint8_t)i);
+    TEST_ASSERT_EQUAL(0U, num_of_call);
+    TEST_ASSERT_TRUE(ezQueue_IsEmpty(&rpc_inst.rx_msg_queue));
+
+    TestRpc_FeedFrame((uint8_t)(test_rpc_service_table[0].tag + modulus));
+    TEST_ASSERT_EQUAL(0U, num_of_call);
+    TEST_ASSERT_TRUE(ezQueue_IsEmpty(&rpc_inst.rx_msg_queue));
+
+    /* The payload was consumed, the next message is still handled */
+    TestRpc_FeedFrame(test_rpc_service_table[0].tag);
+    TEST_ASSERT_EQUAL(1U, num_of_call);
+    TEST_ASSERT_EQUAL(0U, called_handler);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(test_payload, received_payload, PAYLOAD_SIZE);
+}
+
+
+TEST(ez_rpc, ScanAndDispatch_Agree)
+{
+    uint32_t tag = 0;
+    uint8_t scan_handler = NO_HANDLER;
+    uint32_t scan_num_of_call = 0U;
+
+    for (tag = 0; tag < NUM_OF_TAG; tag++)
+    {
+        TEST_ASSERT_EQUAL(ezSUCCESS, ezRpc_SetDispatchTable(&rpc_inst, NULL));
+        TestRpc_FeedFrame((uint8_t)tag);
+        TEST_ASSERT_TRUE(ezQueue_IsEmpty(&rpc_inst.rx_msg_queue));
+        scan_handler = called_handler;
+        scan_num_of_call = num_of_call;
+
+        TEST_ASSERT_EQUAL(ezSUCCESS, ezRpc_SetDispatchTable(&rpc_inst, &test_rpc_dispatch_table));
+        TestRpc_FeedFrame((uint8_t)tag);
+        TEST_ASSERT_TRUE(ezQueue_IsEmpty(&rpc_inst.rx_msg_queue));
+        TEST_ASSERT_EQUAL(scan_num_of_call, num_of_call);
+        TEST_ASSERT_EQUAL(scan_handler, called_handler);
+    }
+}
+
+
+TEST(ez_rpc, NullHandler_ConsumesPayload)
+{
+    /* Tag 5 has no handler. Tag 6 is stored at index 0 and tag 5 at index 1 */
+    static struct ezRpcService service_table[] = {
+        { 5U, NULL },
+        { 6U, TestRpc_HandleFirst },
+    };
+    static const struct ezRpcService dispatch_entries[] = {
+        { 6U, TestRpc_HandleFirst },
+        { 5U, NULL },
+    };
+    static const struct ezRpcDispatchTable dispatch_table = { dispatch_entries, 2U };
+    const struct ezRpcDispatchTable *tables[] = { NULL, &dispatch_table };
+    uint32_t i = 0;
+
+    for (i = 0; i < sizeof(tables) / sizeof(tables[0]); i++)
+    {
+        TestRpc_Init(service_table, sizeof(service_table) / sizeof(service_table[0]));
+        TEST_ASSERT_EQUAL(ezSUCCESS, ezRpc_SetDispatchTable(&rpc_inst, tables[i]));
+
+        TestRpc_FeedFrame(5U);
+        TEST_ASSERT_EQUAL(0U, num_of_call);
+        TEST_ASSERT_TRUE(ezQueue_IsEmpty(&rpc_inst.rx_msg_queue));
+
+        TestRpc_FeedFrame(6U);
+        TEST_ASSERT_EQUAL(1U, num_of_call);
+        TEST_ASSERT_EQUAL_UINT8_ARRAY(test_payload, received_payload, PAYLOAD_SIZE);
+    }
+}
+
+
+#if (EZ_RPC_ITEM_POOL == 1U)
+TEST(ez_rpc, QueueItemPool)
+{
+    uint8_t payload[PAYLOAD_SIZE] = { 0 };
+
+    /* Header and small payload fit in an item of the instance */
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezRPC_CreateRpcRequest(&rpc_inst, 1U, payload, sizeof(payload)));
+    TEST_ASSERT_EQUAL(CONFIG_EZ_RPC_NUM_OF_QUEUE_ITEM - 1U, ezObjPool_GetNumOfFreeObj(&rpc_inst.item_pool));
+    TEST_ASSERT_EQUAL(0U, ezStaticAlloc_GetNumOfAllocBlock(&rpc_inst.tx_msg_queue.mem_list));
+
+    TestRpc_FeedFrame(test_rpc_service_table[0].tag);
+    TEST_ASSERT_EQUAL(1U, num_of_call);
+    TEST_ASSERT_EQUAL(CONFIG_EZ_RPC_NUM_OF_QUEUE_ITEM, ezObjPool_GetNumOfFreeObj(&rpc_inst.item_pool));
+}
+#endif /* EZ_RPC_ITEM_POOL == 1U */
+
+
+/******************************************************************************
+* Internal functions
+*******************************************************************************/
+static void RunAllTests(void)
+{
+    RUN_TEST_GROUP(ez_rpc);
+}
+
+
+void TestRpc_HandleFirst(void *payload, uint32_t payload_size_byte)
+{
+    TestRpc_Record(0U, payload, payload_size_byte);
+}
+
+
+void TestRpc_HandleSecond(void *payload, uint32_t payload_size_byte)
+{
+    TestRpc_Record(1U, payload, payload_size_byte);
+}
+
+
+void TestRpc_HandleThird(void *payload, uint32_t payload_size_byte)
+{
+    TestRpc_Record(2U, payload, payload_size_byte);
+}
+
+
+void TestRpc_HandleFourth(void *payload, uint32_t payload_size_byte)
+{
+    TestRpc_Record(3U, payload, payload_size_byte);
+}
+
+
+static void TestRpc_Record(uint8_t handler, void *payload, uint32_t payload_size)
+{
+    called_handler = handler;
+    num_of_call++;
+    received_payload_size = payload_size;
+    if (payload_size <= PAYLOAD_SIZE)
+    {
+        memcpy(received_payload, payload, payload_size);
+    }
+}
+
+
+static uint32_t TestRpc_Transmit(uint8_t *tx_data, uint32_t tx_size)
+{
+    (void)tx_data;
+    return tx_size;
+}
+
+
+static uint32_t TestRpc_Receive(uint8_t *rx_data, uint32_t rx_size)
+{
+    uint32_t num_of_byte = 0U;
+
+    while (num_of_byte < rx_size && rx_index < rx_stream_size)
+    {
+        rx_data[num_of_byte++] = rx_stream[rx_index++];
+    }
+
+    return num_of_byte;
+}
+
+
+static void TestRpc_Init(struct ezRpcService *service_table, uint32_t service_table_size)
+{
+    memset(rpc_buff, 0, sizeof(rpc_buff));
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezRpc_Initialization(&rpc_inst,
+                                                      rpc_buff,
+                                                      BUFF_SIZE,
+                                                      service_table,
+                                                      service_table_size));
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezRpc_SetTxRxFunctions(&rpc_inst,
+                                                        TestRpc_Transmit,
+                                                        TestRpc_Receive));
+}
+
+
+/* Build a request frame without CRC, see ezRpcMsg, and let the instance
+ * handle it */
+static void TestRpc_FeedFrame(uint8_t tag)
+{
+    uint32_t i = 0;
+
+    rx_stream_size = 0U;
+    rx_index = 0U;
+    called_handler = NO_HANDLER;
+    num_of_call = 0U;
+    received_payload_size = 0U;
+    memset(received_payload, 0, sizeof(received_payload));
+
+    rx_stream[rx_stream_size++] = 0x80;         /* SOF */
+    rx_stream[rx_stream_size++] = 0x00;         /* UUID */
+    rx_stream[rx_stream_size++] = 0x00;
+    rx_stream[rx_stream_size++] = 0x00;
+    rx_stream[rx_stream_size++] = 0x01;
+    rx_stream[rx_stream_size++] = RPC_MSG_REQ;
+    rx_stream[rx_stream_size++] = tag;
+    rx_stream[rx_stream_size++] = 0x00;         /* not encrypted */
+    rx_stream[rx_stream_size++] = 0x00;         /* payload size */
+    rx_stream[rx_stream_size++] = 0x00;
+    rx_stream[rx_stream_size++] = 0x00;
+    rx_stream[rx_stream_size++] = PAYLOAD_SIZE;
+    memcpy(&rx_stream[rx_stream_size], test_payload, PAYLOAD_SIZE);
+    rx_stream_size += PAYLOAD_SIZE;
+
+    for (i = 0; i < MAX_NUM_OF_RUN; i++)
+    {
+        ezRPC_Run(&rpc_inst);
+    }
+}
+
+
+/* End of file */
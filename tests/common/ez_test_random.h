@@ -0,0 +1,75 @@
+/*****************************************************************************
+* Filename:         ez_test_random.h
+* Author:           Hai Nguyen
+* Original Date:    18.10.2026
+*
+* ----------------------------------------------------------------------------
+* Contact:          Hai Nguyen
+*                   hainguyen.eeit@gmail.com
+*
+* ----------------------------------------------------------------------------
+* License: This file is published under the license described in LICENSE.md
+*
+*****************************************************************************/
+
+/** @file   ez_test_random.h
+ *  @author Hai Nguyen
+ *  @date   18.10.2026
+ *  @brief  Pseudo random numbers shared by the unit tests
+ *
+ *  @details Randomized tests must fail the same way on every run, so the
+ *  sequence only depends on the seed given by the test.
+ */
+
+#ifndef _EZ_TEST_RANDOM_H
+#define _EZ_TEST_RANDOM_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/*****************************************************************************
+* Includes
+*****************************************************************************/
+#include <stdint.h>
+
+
+/*****************************************************************************
+* Function Prototypes
+*****************************************************************************/
+
+/*****************************************************************************
+* Function : ezTest_NextRandom
+*//** 
+* @brief Return the next number of a xorshift32 sequence
+*
+* @param    *state: (IN/OUT)state of the sequence, initialized with a non
+*                   zero seed
+* @return   next number of the sequence
+*
+* @pre *state is not 0
+* @post None
+*
+* @code
+* uint32_t random_state = 12345;
+* uint32_t index = ezTest_NextRandom(&random_state) % NUM_OF_ITEM;
+* @endcode
+*
+*****************************************************************************/
+static inline uint32_t ezTest_NextRandom(uint32_t *state)
+{
+    *state ^= *state << 13;
+    *state ^= *state >> 17;
+    *state ^= *state << 5;
+    return *state;
+}
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _EZ_TEST_RANDOM_H */
+
+/* End of file */
@@ -0,0 +1,256 @@
+/*****************************************************************************
+* Filename:         unittest_ez_blocking_queue.c
+* Author:           Hai Nguyen
+* Original Date:    18.10.2026
+*
+* ----------------------------------------------------------------------------
+* Contact:          Hai Nguyen
+*                   hainguyen.eeit@gmail.com
+*
+* ----------------------------------------------------------------------------
+* License: This file is published under the license described in LICENSE.md
+*
+*****************************************************************************/
+
+/** @file   unittest_ez_blocking_queue.c
+ *  @author Hai Nguyen
+ *  @date   18.10.2026
+ *  @brief  Unit test for the blocking queue component
+ *
+ *  @details
+ *
+ */
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <pthread.h>
+#include <time.h>
+#include "unity.h"
+#include "unity_fixture.h"
+#include "ez_blocking_queue.h"
+
+TEST_GROUP(ez_blocking_queue);
+
+/******************************************************************************
+* Module Preprocessor Macros
+*******************************************************************************/
+#if (EZ_STATIC_ALLOC_TLSF == 1U) || (EZ_STATIC_ALLOC_INBAND == 1U)
+#define BUFF_SIZE           1024U   /**< Leave room for the block headers stored in the buffer */
+#else
+#define BUFF_SIZE           128U
+#endif
+#define TIMEOUT_MS          50U
+#define STRESS_NUM_OF_MSG   20000UL
+
+
+/******************************************************************************
+* Module Typedefs
+*******************************************************************************/
+/* None */
+
+
+/******************************************************************************
+* Module Variable Definitions
+*******************************************************************************/
+static uint8_t buff[BUFF_SIZE];
+static ezBlockingQueue queue;
+
+
+/******************************************************************************
+* Function Definitions
+*******************************************************************************/
+static void RunAllTests(void);
+static void *DelayedPusher(void *arg);
+static void *StressProducer(void *arg);
+
+
+/******************************************************************************
+* External functions
+*******************************************************************************/
+int main(int argc, const char *argv[])
+{
+    return UnityMain(argc, argv, RunAllTests);
+}
+
+
+TEST_SETUP(ez_blocking_queue)
+{
+    memset(buff, 0, sizeof(buff));
+    (void)ezBlockingQueue_Create(&queue, buff, sizeof(buff));
+}
+
+
+TEST_TEAR_DOWN(ez_blocking_queue)
+{
+}
+
+
+TEST_GROUP_RUNNER(ez_blocking_queue)
+{
+    RUN_TEST_CASE(ez_blocking_queue, create_invalid_param);
+    RUN_TEST_CASE(ez_blocking_queue, push_pop);
+    RUN_TEST_CASE(ez_blocking_queue, pop_timeout);
+    RUN_TEST_CASE(ez_blocking_queue, push_timeout);
+    RUN_TEST_CASE(ez_blocking_queue, pop_buffer_too_small);
+    RUN_TEST_CASE(ez_blocking_queue, pop_wakes_up_on_push);
+    RUN_TEST_CASE(ez_blocking_queue, producer_consumer_threads);
+}
+
+
+TEST(ez_blocking_queue, create_invalid_param)
+{
+    ezBlockingQueue test_queue;
+
+    TEST_ASSERT_EQUAL(ezFAIL, ezBlockingQueue_Create(NULL, buff, sizeof(buff)));
+    TEST_ASSERT_EQUAL(ezFAIL, ezBlockingQueue_Create(&test_queue, NULL, sizeof(buff)));
+    TEST_ASSERT_EQUAL(ezFAIL, ezBlockingQueue_Create(&test_queue, buff, 0U));
+}
+
+
+TEST(ez_blocking_queue, push_pop)
+{
+    uint8_t data[] = {1, 2, 3, 4, 5};
+    uint8_t out[8] = {0};
+    uint32_t out_size = sizeof(out);
+
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezBlockingQueue_Push(&queue, data, sizeof(data), EZ_OSAL_NO_WAIT));
+    TEST_ASSERT_EQUAL(1U, ezBlockingQueue_GetNumOfElement(&queue));
+
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezBlockingQueue_Pop(&queue, out, &out_size, EZ_OSAL_NO_WAIT));
+    TEST_ASSERT_EQUAL(sizeof(data), out_size);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(data, out, sizeof(data));
+    TEST_ASSERT_EQUAL(0U, ezBlockingQueue_GetNumOfElement(&queue));
+}
+
+
+TEST(ez_blocking_queue, pop_timeout)
+{
+    uint8_t out[8] = {0};
+    uint32_t out_size = sizeof(out);
+    uint32_t start_ms = 0;
+
+    TEST_ASSERT_EQUAL(ezFAIL, ezBlockingQueue_Pop(&queue, out, &out_size, EZ_OSAL_NO_WAIT));
+
+    start_ms = ezOsal_GetTimeMs();
+    TEST_ASSERT_EQUAL(ezFAIL, ezBlockingQueue_Pop(&queue, out, &out_size, TIMEOUT_MS));
+    TEST_ASSERT_TRUE(ezOsal_GetTimeMs() - start_ms >= TIMEOUT_MS);
+}
+
+
+TEST(ez_blocking_queue, push_timeout)
+{
+    uint8_t data[BUFF_SIZE / 4] = {0};
+    uint32_t start_ms = 0;
+
+    /* Fill the queue */
+    while (ezBlockingQueue_Push(&queue, data, sizeof(data), EZ_OSAL_NO_WAIT) == ezSUCCESS)
+    {
+    }
+    TEST_ASSERT_TRUE(ezBlockingQueue_GetNumOfElement(&queue) > 0U);
+
+    start_ms = ezOsal_GetTimeMs();
+    TEST_ASSERT_EQUAL(ezFAIL, ezBlockingQueue_Push(&queue, data, sizeof(data), TIMEOUT_MS));
+    TEST_ASSERT_TRUE(ezOsal_GetTimeMs() - start_ms >= TIMEOUT_MS);
+}
+
+
+TEST(ez_blocking_queue, pop_buffer_too_small)
+{
+    uint8_t data[] = {1, 2, 3, 4, 5};
+    uint8_t out[2] = {0};
+    uint32_t out_size = sizeof(out);
+
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezBlockingQueue_Push(&queue, data, sizeof(data), EZ_OSAL_NO_WAIT));
+
+    /* The element stays in the queue, its size is returned */
+    TEST_ASSERT_EQUAL(ezFAIL, ezBlockingQueue_Pop(&queue, out, &out_size, EZ_OSAL_NO_WAIT));
+    TEST_ASSERT_EQUAL(sizeof(data), out_size);
+    TEST_ASSERT_EQUAL(1U, ezBlockingQueue_GetNumOfElement(&queue));
+}
+
+
+TEST(ez_blocking_queue, pop_wakes_up_on_push)
+{
+    pthread_t pusher;
+    uint32_t out = 0;
+    uint32_t out_size = sizeof(out);
+
+    TEST_ASSERT_EQUAL(0, pthread_create(&pusher, NULL, DelayedPusher, NULL));
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezBlockingQueue_Pop(&queue, &out, &out_size, EZ_OSAL_WAIT_FOREVER));
+    TEST_ASSERT_EQUAL(0, pthread_join(pusher, NULL));
+
+    TEST_ASSERT_EQUAL(0xCAFEU, out);
+}
+
+
+TEST(ez_blocking_queue, producer_consumer_threads)
+{
+    pthread_t producer;
+    uint32_t out = 0;
+    uint32_t out_size = 0;
+    uint32_t i = 0;
+    bool is_in_order = true;
+
+    TEST_ASSERT_EQUAL(0, pthread_create(&producer, NULL, StressProducer, NULL));
+
+    for (i = 0; i < STRESS_NUM_OF_MSG; i++)
+    {
+        out_size = sizeof(out);
+        if (ezBlockingQueue_Pop(&queue, &out, &out_size, EZ_OSAL_WAIT_FOREVER) != ezSUCCESS
+            || out != i)
+        {
+            is_in_order = false;
+        }
+    }
+
+    TEST_ASSERT_EQUAL(0, pthread_join(producer, NULL));
+    TEST_ASSERT_TRUE(is_in_order);
+    TEST_ASSERT_EQUAL(0U, ezBlockingQueue_GetNumOfElement(&queue));
+}
+
+
+/******************************************************************************
+* Internal functions
+*******************************************************************************/
+static void RunAllTests(void)
+{
+    RUN_TEST_GROUP(ez_blocking_queue);
+}
+
+
+static void *DelayedPusher(void *arg)
+{
+    uint32_t data = 0xCAFEU;
+    struct timespec delay = {0, 10000000L};
+
+    (void)arg;
+
+    /* Give the consumer time to block */
+    (void)nanosleep(&delay, NULL);
+    (void)ezBlockingQueue_Push(&queue, &data, sizeof(data), EZ_OSAL_WAIT_FOREVER);
+
+    return NULL;
+}
+
+
+static void *StressProducer(void *arg)
+{
+    uint32_t i = 0;
+
+    (void)arg;
+
+    /* The queue is much smaller than the messages, so both sides block */
+    for (i = 0; i < STRESS_NUM_OF_MSG; i++)
+    {
+        (void)ezBlockingQueue_Push(&queue, &i, sizeof(i), EZ_OSAL_WAIT_FOREVER);
+    }
+
+    return NULL;
+}
+
+
+/* End of file */
@@ -35,7 +35,11 @@ TEST_GROUP(ez_task_worker);
 /******************************************************************************
 * Module Preprocessor Macros
 *******************************************************************************/
+#if (EZ_STATIC_ALLOC_TLSF == 1U) || (EZ_STATIC_ALLOC_INBAND == 1U)
+#define BUFF_SIZE       512   /**< Leave room for the block headers stored in the buffer */
+#else
 #define BUFF_SIZE       256
+#endif
 
 /******************************************************************************
 * Module Typedefs
@@ -60,13 +64,17 @@ static struct ezTaskWorker worker1;
 static struct ezTaskWorker worker2;
 static uint8_t buff1[BUFF_SIZE];
 static uint8_t buff2[BUFF_SIZE];
+static uint8_t urgent_buff[BUFF_SIZE];
 static int worker1_sum = 0;
+static uint32_t fake_time = 0;
 
 /******************************************************************************
 * Function Definitions
 *******************************************************************************/
 static void RunAllTests(void);
 static bool worker1_sum_external(int a, int b);
+static bool worker1_sum_urgent(int a, int b);
+static uint32_t get_fake_time(void);
 static bool worker1_sum_internal(void *context, ezTaskWorkerCallbackFunc callback);
 static void callback1(uint8_t event, void *ret_data);
 
@@ -98,6 +106,12 @@ TEST_TEAR_DOWN(ez_task_worker)
 TEST_GROUP_RUNNER(ez_task_worker)
 {
     RUN_TEST_CASE(ez_task_worker, Test_ezTaskWorker_EnqueueTask);
+    RUN_TEST_CASE(ez_task_worker, Test_ezTaskWorker_DrainLimit);
+    RUN_TEST_CASE(ez_task_worker, Test_ezTaskWorker_PriorityLane);
+    RUN_TEST_CASE(ez_task_worker, Test_ezTaskWorker_ZeroCopy);
+#if (EZ_TIMING_WHEEL == 1U)
+    RUN_TEST_CASE(ez_task_worker, Test_ezTaskWorker_DelayedTask);
+#endif /* EZ_TIMING_WHEEL == 1U */
 }
 
 
@@ -115,6 +129,11 @@ TEST(ez_task_worker, Test_ezTaskWorker_EnqueueTask)
     ret = worker1_sum_external(100, 200);
     TEST_ASSERT_EQUAL(true, ret);
     TEST_ASSERT_EQUAL(3, ezQueue_GetNumOfElement(&worker1.msg_queue));
+#if (EZ_TASK_WORKER_ITEM_POOL == 1U)
+    /* The queue items of the task blocks come from the worker */
+    TEST_ASSERT_EQUAL(CONFIG_EZ_TASK_WORKER_NUM_OF_QUEUE_ITEM - 3U,
+                      ezObjPool_GetNumOfFreeObj(&worker1.item_pool));
+#endif /* EZ_TASK_WORKER_ITEM_POOL == 1U */
 
     ezTaskWorker_ExecuteTaskNoRTOS();
     TEST_ASSERT_EQUAL(22, worker1_sum);
@@ -127,9 +146,193 @@ TEST(ez_task_worker, Test_ezTaskWorker_EnqueueTask)
     ezTaskWorker_ExecuteTaskNoRTOS();
     TEST_ASSERT_EQUAL(300, worker1_sum);
     TEST_ASSERT_EQUAL(0, ezQueue_GetNumOfElement(&worker1.msg_queue));
+#if (EZ_TASK_WORKER_ITEM_POOL == 1U)
+    TEST_ASSERT_EQUAL(CONFIG_EZ_TASK_WORKER_NUM_OF_QUEUE_ITEM,
+                      ezObjPool_GetNumOfFreeObj(&worker1.item_pool));
+#endif /* EZ_TASK_WORKER_ITEM_POOL == 1U */
 }
 
 
+TEST(ez_task_worker, Test_ezTaskWorker_DrainLimit)
+{
+    TEST_ASSERT_EQUAL(false, ezTaskWorker_SetDrainLimit(NULL, 2));
+
+    TEST_ASSERT_EQUAL(true, ezTaskWorker_SetDrainLimit(&worker1, 2));
+    TEST_ASSERT_EQUAL(true, worker1_sum_external(10, 12));
+    TEST_ASSERT_EQUAL(true, worker1_sum_external(4, 5));
+    TEST_ASSERT_EQUAL(true, worker1_sum_external(100, 200));
+
+    ezTaskWorker_ExecuteTaskNoRTOS();
+    TEST_ASSERT_EQUAL(9, worker1_sum);
+    TEST_ASSERT_EQUAL(1, ezQueue_GetNumOfElement(&worker1.msg_queue));
+
+    ezTaskWorker_ExecuteTaskNoRTOS();
+    TEST_ASSERT_EQUAL(300, worker1_sum);
+    TEST_ASSERT_EQUAL(0, ezQueue_GetNumOfElement(&worker1.msg_queue));
+
+    TEST_ASSERT_EQUAL(true, ezTaskWorker_SetDrainLimit(&worker1, EZ_TASK_WORKER_DRAIN_ALL));
+    TEST_ASSERT_EQUAL(true, worker1_sum_external(10, 12));
+    TEST_ASSERT_EQUAL(true, worker1_sum_external(4, 5));
+    TEST_ASSERT_EQUAL(true, worker1_sum_external(1, 2));
+
+    ezTaskWorker_ExecuteTaskNoRTOS();
+    TEST_ASSERT_EQUAL(3, worker1_sum);
+    TEST_ASSERT_EQUAL(0, ezQueue_GetNumOfElement(&worker1.msg_queue));
+}
+
+
+TEST(ez_task_worker, Test_ezTaskWorker_PriorityLane)
+{
+    struct ezTaskWorkerLaneStats stats;
+
+    /* Lane must be added before use */
+    TEST_ASSERT_EQUAL(false, worker1_sum_urgent(1, 1));
+    TEST_ASSERT_EQUAL(false, ezTaskWorker_AddLane(&worker1, EZ_TASK_WORKER_LANE_DEFAULT, urgent_buff, BUFF_SIZE));
+    TEST_ASSERT_EQUAL(true, ezTaskWorker_AddLane(&worker1, 0, urgent_buff, BUFF_SIZE));
+
+    ezTaskWorker_SetTimestampFunc(get_fake_time);
+    fake_time = 100;
+    TEST_ASSERT_EQUAL(true, worker1_sum_external(10, 12));
+    TEST_ASSERT_EQUAL(true, worker1_sum_external(4, 5));
+    fake_time = 110;
+    TEST_ASSERT_EQUAL(true, worker1_sum_urgent(100, 200));
+
+    /* Urgent task overtakes the pending ones */
+    fake_time = 115;
+    ezTaskWorker_ExecuteTaskNoRTOS();
+    TEST_ASSERT_EQUAL(300, worker1_sum);
+
+    fake_time = 130;
+    ezTaskWorker_ExecuteTaskNoRTOS();
+    TEST_ASSERT_EQUAL(22, worker1_sum);
+    ezTaskWorker_ExecuteTaskNoRTOS();
+    TEST_ASSERT_EQUAL(9, worker1_sum);
+    ezTaskWorker_SetTimestampFunc(NULL);
+
+    TEST_ASSERT_EQUAL(true, ezTaskWorker_GetLaneStats(&worker1, 0, &stats));
+    TEST_ASSERT_EQUAL(1, stats.num_of_enqueued_task);
+    TEST_ASSERT_EQUAL(1, stats.num_of_executed_task);
+    TEST_ASSERT_EQUAL(1, stats.max_depth);
+    TEST_ASSERT_EQUAL(5, stats.max_latency);
+
+    TEST_ASSERT_EQUAL(true, ezTaskWorker_GetLaneStats(&worker1, EZ_TASK_WORKER_LANE_DEFAULT, &stats));
+    TEST_ASSERT_EQUAL(2, stats.num_of_enqueued_task);
+    TEST_ASSERT_EQUAL(2, stats.num_of_executed_task);
+    TEST_ASSERT_EQUAL(2, stats.max_depth);
+    TEST_ASSERT_EQUAL(30, stats.last_latency);
+    TEST_ASSERT_EQUAL(30, stats.max_latency);
+
+    TEST_ASSERT_EQUAL(false, ezTaskWorker_GetLaneStats(&worker1, CONFIG_EZ_TASK_WORKER_NUM_OF_LANE, &stats));
+}
+
+
+TEST(ez_task_worker, Test_ezTaskWorker_ZeroCopy)
+{
+    struct ezTaskWorkerReservation reservation;
+    struct Worker1SumContext *context = NULL;
+    struct Worker1SumContext ref_context = {40, 2};
+
+    /* Context is built in the queue storage */
+    context = ezTaskWorker_ReserveTask(&worker1, EZ_TASK_WORKER_LANE_DEFAULT,
+                                       worker1_sum_internal, callback1,
+                                       sizeof(struct Worker1SumContext), &reservation, 0);
+    TEST_ASSERT_NOT_NULL(context);
+    context->a = 7;
+    context->b = 8;
+    TEST_ASSERT_EQUAL(0, ezQueue_GetNumOfElement(&worker1.msg_queue));
+    TEST_ASSERT_EQUAL(true, ezTaskWorker_SubmitTask(&worker1, &reservation, 0));
+    TEST_ASSERT_EQUAL(false, ezTaskWorker_SubmitTask(&worker1, &reservation, 0));
+    TEST_ASSERT_EQUAL(1, ezQueue_GetNumOfElement(&worker1.msg_queue));
+
+    ezTaskWorker_ExecuteTaskNoRTOS();
+    TEST_ASSERT_EQUAL(15, worker1_sum);
+
+    /* Cancelled task is never executed */
+    context = ezTaskWorker_ReserveTask(&worker1, EZ_TASK_WORKER_LANE_DEFAULT,
+                                       worker1_sum_internal, callback1,
+                                       sizeof(struct Worker1SumContext), &reservation, 0);
+    TEST_ASSERT_NOT_NULL(context);
+    TEST_ASSERT_EQUAL(true, ezTaskWorker_CancelTask(&worker1, &reservation, 0));
+    TEST_ASSERT_EQUAL(0, ezQueue_GetNumOfElement(&worker1.msg_queue));
+
+    /* Task reads the caller's context when it is executed */
+    TEST_ASSERT_EQUAL(true, ezTaskWorker_EnqueueTaskRef(&worker1, EZ_TASK_WORKER_LANE_DEFAULT,
+                                                        worker1_sum_internal, callback1,
+                                                        &ref_context, 0));
+    ref_context.b = 60;
+    ezTaskWorker_ExecuteTaskNoRTOS();
+    TEST_ASSERT_EQUAL(100, worker1_sum);
+    TEST_ASSERT_EQUAL(0, ezQueue_GetNumOfElement(&worker1.msg_queue));
+}
+
+
+#if (EZ_TIMING_WHEEL == 1U)
+TEST(ez_task_worker, Test_ezTaskWorker_DelayedTask)
+{
+    static struct ezTaskWorkerTimer delayed_timer;
+    static struct ezTaskWorkerTimer periodic_timer;
+    struct Worker1SumContext delayed_context = {1, 2};
+    struct Worker1SumContext periodic_context = {3, 4};
+
+    /* Timers need the timestamp function */
+    TEST_ASSERT_EQUAL(false, ezTaskWorker_EnqueueDelayed(&worker1, &delayed_timer, EZ_TASK_WORKER_LANE_DEFAULT,
+                                                         worker1_sum_internal, callback1,
+                                                         &delayed_context, 10, 0));
+
+    ezTaskWorker_SetTimestampFunc(get_fake_time);
+    fake_time = 200;
+    worker1_sum = 0;
+    TEST_ASSERT_EQUAL(true, ezTaskWorker_EnqueueDelayed(&worker1, &delayed_timer, EZ_TASK_WORKER_LANE_DEFAULT,
+                                                        worker1_sum_internal, callback1,
+                                                        &delayed_context, 10, 0));
+
+    fake_time = 205;
+    ezTaskWorker_ExecuteTaskNoRTOS();
+    TEST_ASSERT_EQUAL(0, worker1_sum);
+    TEST_ASSERT_EQUAL(0, ezQueue_GetNumOfElement(&worker1.msg_queue));
+
+    fake_time = 210;
+    ezTaskWorker_ExecuteTaskNoRTOS();
+    TEST_ASSERT_EQUAL(3, worker1_sum);
+
+    /* Periodic task is enqueued once per period */
+    TEST_ASSERT_EQUAL(false, ezTaskWorker_EnqueuePeriodic(&worker1, &periodic_timer, EZ_TASK_WORKER_LANE_DEFAULT,
+                                                          worker1_sum_internal, callback1,
+                                                          &periodic_context, 0, 0));
+    TEST_ASSERT_EQUAL(true, ezTaskWorker_EnqueuePeriodic(&worker1, &periodic_timer, EZ_TASK_WORKER_LANE_DEFAULT,
+                                                         worker1_sum_internal, callback1,
+                                                         &periodic_context, 5, 0));
+    TEST_ASSERT_EQUAL(false, ezTaskWorker_EnqueueDelayed(&worker1, &periodic_timer, EZ_TASK_WORKER_LANE_DEFAULT,
+                                                         worker1_sum_internal, callback1,
+                                                         &periodic_context, 1, 0));
+
+    fake_time = 215;
+    ezTaskWorker_ExecuteTaskNoRTOS();
+    TEST_ASSERT_EQUAL(7, worker1_sum);
+
+    worker1_sum = 0;
+    fake_time = 217;
+    ezTaskWorker_ExecuteTaskNoRTOS();
+    TEST_ASSERT_EQUAL(0, worker1_sum);
+
+    fake_time = 220;
+    ezTaskWorker_ExecuteTaskNoRTOS();
+    TEST_ASSERT_EQUAL(7, worker1_sum);
+
+    /* Cancelled timer enqueues nothing more */
+    TEST_ASSERT_EQUAL(true, ezTaskWorker_CancelTimer(&worker1, &periodic_timer, 0));
+    TEST_ASSERT_EQUAL(false, ezTaskWorker_CancelTimer(&worker1, &periodic_timer, 0));
+    worker1_sum = 0;
+    fake_time = 240;
+    ezTaskWorker_ExecuteTaskNoRTOS();
+    TEST_ASSERT_EQUAL(0, worker1_sum);
+    TEST_ASSERT_EQUAL(0, ezQueue_GetNumOfElement(&worker1.msg_queue));
+
+    ezTaskWorker_SetTimestampFunc(NULL);
+}
+#endif /* EZ_TIMING_WHEEL == 1U */
+
+
 /******************************************************************************
 * Internal functions
 *******************************************************************************/
@@ -156,6 +359,26 @@ static bool worker1_sum_external(int a, int b)
     return true;
 }
 
+static bool worker1_sum_urgent(int a, int b)
+{
+    struct Worker1SumContext contxt;
+
+    contxt.a = a;
+    contxt.b = b;
+
+    return ezTaskWorker_EnqueueTaskToLane(&worker1,
+                                          0,
+                                          worker1_sum_internal,
+                                          callback1,
+                                          (void*)&contxt,
+                                          sizeof(struct Worker1SumContext), 0);
+}
+
+static uint32_t get_fake_time(void)
+{
+    return fake_time;
+}
+
 static bool worker1_sum_internal(void *context, ezTaskWorkerCallbackFunc callback)
 {
     bool ret = false;
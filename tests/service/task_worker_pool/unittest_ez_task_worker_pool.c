@@ -0,0 +1,325 @@
+/*****************************************************************************
+* Filename:         unittest_ez_task_worker_pool.c
+* Author:           Hai Nguyen
+* Original Date:    18.10.2026
+*
+* ----------------------------------------------------------------------------
+* Contact:          Hai Nguyen
+*                   hainguyen.eeit@gmail.com
+*
+* ----------------------------------------------------------------------------
+* License: This file is published under the license described in LICENSE.md
+*
+*****************************************************************************/
+
+/** @file   unittest_ez_task_worker_pool.c
+ *  @author Hai Nguyen
+ *  @date   18.10.2026
+ *  @brief  Unit test for the task worker pool component
+ *
+ *  @details
+ *
+ */
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+#include <sched.h>
+#include <time.h>
+#include "unity.h"
+#include "unity_fixture.h"
+#include "ez_task_worker_pool.h"
+
+TEST_GROUP(ez_task_worker_pool);
+
+/******************************************************************************
+* Module Preprocessor Macros
+*******************************************************************************/
+#define NUM_OF_THREAD       4U
+#define QUEUE_SIZE          1024U   /**< Per thread, leaves room for the allocator headers */
+#define STRESS_NUM_OF_TASK  20000U
+#define BURST_NUM_OF_TASK   6U      /**< Fits in the queue of one thread */
+#define TASK_DELAY_MS       5U
+#define NUM_OF_STOP_ROUND   20U
+
+
+/******************************************************************************
+* Module Typedefs
+*******************************************************************************/
+struct AddContext
+{
+    uint32_t value;     /**< Value added to task_sum */
+    uint32_t delay_ms;  /**< Time the task takes */
+};
+
+
+/******************************************************************************
+* Module Variable Definitions
+*******************************************************************************/
+static struct ezTaskWorkerPool pool;
+static struct ezTaskWorkerPoolThread threads[NUM_OF_THREAD];
+static uint8_t queue_buff[NUM_OF_THREAD * QUEUE_SIZE];
+static atomic_uint_least32_t task_sum;
+static atomic_uint_least32_t num_of_callback;
+static atomic_uint_least32_t num_of_accepted_task;
+static atomic_bool is_producer_done;
+static ezOsalThread producer;
+
+
+/******************************************************************************
+* Function Definitions
+*******************************************************************************/
+static void RunAllTests(void);
+static bool AddTask(void *context, ezTaskWorkerCallbackFunc callback);
+static void AddCallback(uint8_t event, void *ret_data);
+static void Produce(void *arg);
+static uint32_t GetNumOfExecutedTask(void);
+static uint32_t GetNumOfStolenTask(void);
+
+
+/******************************************************************************
+* External functions
+*******************************************************************************/
+int main(int argc, const char *argv[])
+{
+    return UnityMain(argc, argv, RunAllTests);
+}
+
+
+TEST_SETUP(ez_task_worker_pool)
+{
+    atomic_store(&task_sum, 0U);
+    atomic_store(&num_of_callback, 0U);
+}
+
+
+TEST_TEAR_DOWN(ez_task_worker_pool)
+{
+}
+
+
+TEST_GROUP_RUNNER(ez_task_worker_pool)
+{
+    RUN_TEST_CASE(ez_task_worker_pool, Create_InvalidParam);
+    RUN_TEST_CASE(ez_task_worker_pool, EnqueueTask_InvalidParam);
+    RUN_TEST_CASE(ez_task_worker_pool, EnqueueTask_AllTasksExecuted);
+    RUN_TEST_CASE(ez_task_worker_pool, EnqueueTaskTo_BurstIsStolen);
+    RUN_TEST_CASE(ez_task_worker_pool, Stop_RejectsNewTasks);
+    RUN_TEST_CASE(ez_task_worker_pool, Stop_AcceptedTasksAreExecuted);
+}
+
+
+TEST(ez_task_worker_pool, Create_InvalidParam)
+{
+    TEST_ASSERT_FALSE(ezTaskWorkerPool_Create(NULL, threads, NUM_OF_THREAD,
+                                              queue_buff, sizeof(queue_buff), NULL, 0, 0));
+    TEST_ASSERT_FALSE(ezTaskWorkerPool_Create(&pool, NULL, NUM_OF_THREAD,
+                                              queue_buff, sizeof(queue_buff), NULL, 0, 0));
+    TEST_ASSERT_FALSE(ezTaskWorkerPool_Create(&pool, threads, 0,
+                                              queue_buff, sizeof(queue_buff), NULL, 0, 0));
+    TEST_ASSERT_FALSE(ezTaskWorkerPool_Create(&pool, threads, NUM_OF_THREAD,
+                                              NULL, sizeof(queue_buff), NULL, 0, 0));
+}
+
+
+TEST(ez_task_worker_pool, EnqueueTask_InvalidParam)
+{
+    struct AddContext context = {1, 0};
+    uint8_t big_context[CONFIG_EZ_TASK_WORKER_POOL_MAX_CONTEXT_SIZE + 1U] = {0};
+
+    TEST_ASSERT_TRUE(ezTaskWorkerPool_Create(&pool, threads, NUM_OF_THREAD,
+                                             queue_buff, sizeof(queue_buff), NULL, 0, 0));
+
+    TEST_ASSERT_FALSE(ezTaskWorkerPool_EnqueueTask(NULL, AddTask, AddCallback, &context, sizeof(context)));
+    TEST_ASSERT_FALSE(ezTaskWorkerPool_EnqueueTask(&pool, NULL, AddCallback, &context, sizeof(context)));
+    TEST_ASSERT_FALSE(ezTaskWorkerPool_EnqueueTask(&pool, AddTask, NULL, &context, sizeof(context)));
+    TEST_ASSERT_FALSE(ezTaskWorkerPool_EnqueueTask(&pool, AddTask, AddCallback, big_context, sizeof(big_context)));
+    TEST_ASSERT_FALSE(ezTaskWorkerPool_EnqueueTaskTo(&pool, NUM_OF_THREAD, AddTask, AddCallback,
+                                                     &context, sizeof(context)));
+
+    ezTaskWorkerPool_Stop(&pool);
+    TEST_ASSERT_EQUAL(0U, GetNumOfExecutedTask());
+}
+
+
+TEST(ez_task_worker_pool, EnqueueTask_AllTasksExecuted)
+{
+    struct AddContext context = {0, 0};
+    uint32_t expected_sum = 0;
+    uint32_t i = 0;
+
+    TEST_ASSERT_TRUE(ezTaskWorkerPool_Create(&pool, threads, NUM_OF_THREAD,
+                                             queue_buff, sizeof(queue_buff), NULL, 0, 0));
+
+    for (i = 1; i <= STRESS_NUM_OF_TASK; i++)
+    {
+        context.value = i;
+        while (ezTaskWorkerPool_EnqueueTask(&pool, AddTask, AddCallback, &context, sizeof(context)) == false)
+        {
+            /* All queues are full, let the workers run */
+            (void)sched_yield();
+        }
+        expected_sum += i;
+    }
+
+    /* Stop waits for the queued tasks */
+    ezTaskWorkerPool_Stop(&pool);
+
+    TEST_ASSERT_EQUAL(expected_sum, atomic_load(&task_sum));
+    TEST_ASSERT_EQUAL(STRESS_NUM_OF_TASK, atomic_load(&num_of_callback));
+    TEST_ASSERT_EQUAL(STRESS_NUM_OF_TASK, GetNumOfExecutedTask());
+    TEST_ASSERT_EQUAL(0U, ezTaskWorkerPool_GetNumOfPendingTask(&pool));
+}
+
+
+TEST(ez_task_worker_pool, EnqueueTaskTo_BurstIsStolen)
+{
+    struct AddContext context = {1, TASK_DELAY_MS};
+    uint32_t i = 0;
+
+    TEST_ASSERT_TRUE(ezTaskWorkerPool_Create(&pool, threads, NUM_OF_THREAD,
+                                             queue_buff, sizeof(queue_buff), NULL, 0, 0));
+
+    /* Every task goes to thread 0, the other threads must steal them */
+    for (i = 0; i < BURST_NUM_OF_TASK; i++)
+    {
+        TEST_ASSERT_TRUE(ezTaskWorkerPool_EnqueueTaskTo(&pool, 0, AddTask, AddCallback,
+                                                        &context, sizeof(context)));
+    }
+
+    ezTaskWorkerPool_Stop(&pool);
+
+    TEST_ASSERT_EQUAL(BURST_NUM_OF_TASK, atomic_load(&task_sum));
+    TEST_ASSERT_EQUAL(BURST_NUM_OF_TASK, GetNumOfExecutedTask());
+    TEST_ASSERT_EQUAL(BURST_NUM_OF_TASK - threads[0].num_of_executed_task, GetNumOfStolenTask());
+    TEST_ASSERT_TRUE(GetNumOfStolenTask() > 0U);
+}
+
+
+TEST(ez_task_worker_pool, Stop_RejectsNewTasks)
+{
+    struct AddContext context = {1, 0};
+
+    TEST_ASSERT_TRUE(ezTaskWorkerPool_Create(&pool, threads, NUM_OF_THREAD,
+                                             queue_buff, sizeof(queue_buff), NULL, 0, 0));
+    ezTaskWorkerPool_Stop(&pool);
+
+    TEST_ASSERT_FALSE(ezTaskWorkerPool_EnqueueTask(&pool, AddTask, AddCallback, &context, sizeof(context)));
+    TEST_ASSERT_EQUAL(0U, atomic_load(&task_sum));
+}
+
+
+TEST(ez_task_worker_pool, Stop_AcceptedTasksAreExecuted)
+{
+    uint32_t round = 0;
+
+    /* Stop while a producer keeps enqueuing, every accepted task must run */
+    for (round = 0; round < NUM_OF_STOP_ROUND; round++)
+    {
+        atomic_store(&task_sum, 0U);
+        atomic_store(&num_of_accepted_task, 0U);
+        atomic_store(&is_producer_done, false);
+
+        TEST_ASSERT_TRUE(ezTaskWorkerPool_Create(&pool, threads, NUM_OF_THREAD,
+                                                 queue_buff, sizeof(queue_buff), NULL, 0, 0));
+        TEST_ASSERT_EQUAL(EZ_OSAL_OK, ezOsal_ThreadCreate(&producer, "producer", Produce,
+                                                          NULL, NULL, 0, 0));
+        while (atomic_load(&num_of_accepted_task) < round)
+        {
+            (void)sched_yield();
+        }
+
+        ezTaskWorkerPool_Stop(&pool);
+        while (atomic_load(&is_producer_done) == false)
+        {
+            (void)sched_yield();
+        }
+
+        TEST_ASSERT_EQUAL(atomic_load(&num_of_accepted_task), atomic_load(&task_sum));
+        TEST_ASSERT_EQUAL(0U, ezTaskWorkerPool_GetNumOfPendingTask(&pool));
+    }
+}
+
+
+/******************************************************************************
+* Internal functions
+*******************************************************************************/
+static void RunAllTests(void)
+{
+    RUN_TEST_GROUP(ez_task_worker_pool);
+}
+
+
+static bool AddTask(void *context, ezTaskWorkerCallbackFunc callback)
+{
+    struct AddContext *add_context = (struct AddContext *)context;
+    struct timespec delay = {0, (long)add_context->delay_ms * 1000000L};
+
+    if (add_context->delay_ms > 0U)
+    {
+        (void)nanosleep(&delay, NULL);
+    }
+
+    (void)atomic_fetch_add(&task_sum, add_context->value);
+    callback(0, NULL);
+
+    return true;
+}
+
+
+static void AddCallback(uint8_t event, void *ret_data)
+{
+    (void)event;
+    (void)ret_data;
+    (void)atomic_fetch_add(&num_of_callback, 1U);
+}
+
+
+static void Produce(void *arg)
+{
+    struct AddContext context = {1, 0};
+
+    (void)arg;
+    while (atomic_load(&pool.is_stopping) == false)
+    {
+        if (ezTaskWorkerPool_EnqueueTask(&pool, AddTask, AddCallback, &context, sizeof(context)) == true)
+        {
+            (void)atomic_fetch_add(&num_of_accepted_task, 1U);
+        }
+    }
+    atomic_store(&is_producer_done, true);
+}
+
+
+static uint32_t GetNumOfExecutedTask(void)
+{
+    uint32_t num_of_task = 0;
+    uint32_t i = 0;
+
+    for (i = 0; i < NUM_OF_THREAD; i++)
+    {
+        num_of_task += threads[i].num_of_executed_task;
+    }
+
+    return num_of_task;
+}
+
+
+static uint32_t GetNumOfStolenTask(void)
+{
+    uint32_t num_of_task = 0;
+    uint32_t i = 0;
+
+    for (i = 0; i < NUM_OF_THREAD; i++)
+    {
+        num_of_task += threads[i].num_of_stolen_task;
+    }
+
+    return num_of_task;
+}
+
+
+/* End of file */
@@ -0,0 +1,294 @@
+/*****************************************************************************
+* Filename:         unittest_ez_hash_table.c
+* Author:           Hai Nguyen
+* Original Date:    18.10.2026
+*
+* ----------------------------------------------------------------------------
+* Contact:          Hai Nguyen
+*                   hainguyen.eeit@gmail.com
+*
+* ----------------------------------------------------------------------------
+* License: This file is published under the license described in LICENSE.md
+*
+*****************************************************************************/
+
+/** @file   unittest_ez_hash_table.c
+ *  @author Hai Nguyen
+ *  @date   18.10.2026
+ *  @brief  Unit test for the hash table component
+ *
+ *  @details
+ *
+ */
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include "unity.h"
+#include "unity_fixture.h"
+#include "ez_hash_table.h"
+#include "ez_test_random.h"
+
+TEST_GROUP(ez_hash_table);
+
+/******************************************************************************
+* Module Preprocessor Macros
+*******************************************************************************/
+#define NUM_OF_SLOT     16U
+#define NUM_OF_ITEM     64U
+#define NAME_SIZE       12U
+
+
+/******************************************************************************
+* Module Typedefs
+*******************************************************************************/
+struct test_item
+{
+    char name[NAME_SIZE];
+    struct ezHashNode hash_node;
+};
+
+
+/******************************************************************************
+* Module Variable Definitions
+*******************************************************************************/
+static struct ezHashNode *slots[NUM_OF_SLOT];
+static struct ezHashTable int_table;
+static struct ezHashTable str_table;
+static struct test_item items[NUM_OF_ITEM];
+
+
+/******************************************************************************
+* Function Definitions
+*******************************************************************************/
+static void RunAllTests(void);
+
+
+/******************************************************************************
+* External functions
+*******************************************************************************/
+int main(int argc, const char *argv[])
+{
+    return UnityMain(argc, argv, RunAllTests);
+}
+
+
+TEST_SETUP(ez_hash_table)
+{
+    uint32_t i = 0;
+
+    for (i = 0; i < NUM_OF_ITEM; i++)
+    {
+        (void)snprintf(items[i].name, NAME_SIZE, "uart%lu", (unsigned long)i);
+    }
+}
+
+
+TEST_TEAR_DOWN(ez_hash_table)
+{
+}
+
+
+TEST_GROUP_RUNNER(ez_hash_table)
+{
+    RUN_TEST_CASE(ez_hash_table, Init_InvalidParam);
+    RUN_TEST_CASE(ez_hash_table, Init_StaticInitializer);
+    RUN_TEST_CASE(ez_hash_table, IntegerKey_InsertFind);
+    RUN_TEST_CASE(ez_hash_table, StringKey_InsertFind);
+    RUN_TEST_CASE(ez_hash_table, Insert_DuplicateKey);
+    RUN_TEST_CASE(ez_hash_table, Insert_TableFull);
+    RUN_TEST_CASE(ez_hash_table, Remove_KeepsOtherNodesReachable);
+    RUN_TEST_CASE(ez_hash_table, RandomOperations);
+}
+
+
+TEST(ez_hash_table, Init_InvalidParam)
+{
+    TEST_ASSERT_FALSE(ezHashTable_Init(NULL, slots, NUM_OF_SLOT, EZ_HASH_KEY_INTEGER));
+    TEST_ASSERT_FALSE(ezHashTable_Init(&int_table, NULL, NUM_OF_SLOT, EZ_HASH_KEY_INTEGER));
+    TEST_ASSERT_FALSE(ezHashTable_Init(&int_table, slots, 1U, EZ_HASH_KEY_INTEGER));
+
+    /* Rounded down to a power of two */
+    TEST_ASSERT_TRUE(ezHashTable_Init(&int_table, slots, 13U, EZ_HASH_KEY_INTEGER));
+    TEST_ASSERT_EQUAL(7U, int_table.mask);
+}
+
+
+TEST(ez_hash_table, Init_StaticInitializer)
+{
+    static struct ezHashNode *static_slots[8];
+    static struct ezHashTable static_table = EZ_HASH_TABLE_INIT(static_slots, EZ_HASH_KEY_STRING);
+
+    TEST_ASSERT_TRUE(ezHashTable_InsertString(&static_table, &items[0].hash_node, items[0].name));
+    TEST_ASSERT_EQUAL_PTR(&items[0].hash_node, ezHashTable_FindString(&static_table, "uart0"));
+    TEST_ASSERT_TRUE(ezHashTable_Remove(&static_table, &items[0].hash_node));
+}
+
+
+TEST(ez_hash_table, IntegerKey_InsertFind)
+{
+    uint32_t i = 0;
+
+    TEST_ASSERT_TRUE(ezHashTable_Init(&int_table, slots, NUM_OF_SLOT, EZ_HASH_KEY_INTEGER));
+
+    for (i = 0; i < 10U; i++)
+    {
+        TEST_ASSERT_TRUE(ezHashTable_InsertInteger(&int_table, &items[i].hash_node, i * 100U));
+    }
+    TEST_ASSERT_EQUAL(10U, ezHashTable_GetNumOfNode(&int_table));
+
+    for (i = 0; i < 10U; i++)
+    {
+        TEST_ASSERT_EQUAL_PTR(&items[i].hash_node, ezHashTable_FindInteger(&int_table, i * 100U));
+    }
+    TEST_ASSERT_NULL(ezHashTable_FindInteger(&int_table, 50U));
+
+    /* Wrong key type is rejected */
+    TEST_ASSERT_NULL(ezHashTable_FindString(&int_table, "uart0"));
+    TEST_ASSERT_FALSE(ezHashTable_InsertString(&int_table, &items[10].hash_node, "uart10"));
+}
+
+
+TEST(ez_hash_table, StringKey_InsertFind)
+{
+    struct ezHashNode *node = NULL;
+    char lookup_name[] = "uart3";
+    uint32_t i = 0;
+
+    TEST_ASSERT_TRUE(ezHashTable_Init(&str_table, slots, NUM_OF_SLOT, EZ_HASH_KEY_STRING));
+
+    for (i = 0; i < 10U; i++)
+    {
+        TEST_ASSERT_TRUE(ezHashTable_InsertString(&str_table, &items[i].hash_node, items[i].name));
+    }
+
+    /* Keys are compared by content, not by pointer */
+    node = ezHashTable_FindString(&str_table, lookup_name);
+    TEST_ASSERT_EQUAL_PTR(&items[3], EZ_HASH_TABLE_GET_PARENT_OF(node, hash_node, struct test_item));
+    TEST_ASSERT_NULL(ezHashTable_FindString(&str_table, "uart"));
+    TEST_ASSERT_NULL(ezHashTable_FindString(&str_table, NULL));
+}
+
+
+TEST(ez_hash_table, Insert_DuplicateKey)
+{
+    TEST_ASSERT_TRUE(ezHashTable_Init(&str_table, slots, NUM_OF_SLOT, EZ_HASH_KEY_STRING));
+
+    TEST_ASSERT_TRUE(ezHashTable_InsertString(&str_table, &items[0].hash_node, "COM1"));
+    TEST_ASSERT_FALSE(ezHashTable_InsertString(&str_table, &items[1].hash_node, "COM1"));
+    TEST_ASSERT_EQUAL(1U, ezHashTable_GetNumOfNode(&str_table));
+    TEST_ASSERT_EQUAL_PTR(&items[0].hash_node, ezHashTable_FindString(&str_table, "COM1"));
+}
+
+
+TEST(ez_hash_table, Insert_TableFull)
+{
+    uint32_t i = 0;
+
+    TEST_ASSERT_TRUE(ezHashTable_Init(&int_table, slots, NUM_OF_SLOT, EZ_HASH_KEY_INTEGER));
+
+    for (i = 0; i < NUM_OF_SLOT - 1U; i++)
+    {
+        TEST_ASSERT_TRUE(ezHashTable_InsertInteger(&int_table, &items[i].hash_node, i));
+    }
+    TEST_ASSERT_FALSE(ezHashTable_InsertInteger(&int_table, &items[i].hash_node, i));
+
+    /* Lookups of missing keys still terminate */
+    TEST_ASSERT_NULL(ezHashTable_FindInteger(&int_table, 1000U));
+    for (i = 0; i < NUM_OF_SLOT - 1U; i++)
+    {
+        TEST_ASSERT_EQUAL_PTR(&items[i].hash_node, ezHashTable_FindInteger(&int_table, i));
+    }
+}
+
+
+TEST(ez_hash_table, Remove_KeepsOtherNodesReachable)
+{
+    uint32_t i = 0;
+    uint32_t j = 0;
+
+    TEST_ASSERT_TRUE(ezHashTable_Init(&int_table, slots, NUM_OF_SLOT, EZ_HASH_KEY_INTEGER));
+
+    /* Highly loaded table, so removals have clusters to repair */
+    for (i = 0; i < 12U; i++)
+    {
+        TEST_ASSERT_TRUE(ezHashTable_InsertInteger(&int_table, &items[i].hash_node, i));
+    }
+
+    for (i = 0; i < 12U; i += 2U)
+    {
+        TEST_ASSERT_TRUE(ezHashTable_Remove(&int_table, &items[i].hash_node));
+        TEST_ASSERT_FALSE(ezHashTable_Remove(&int_table, &items[i].hash_node));
+        TEST_ASSERT_NULL(ezHashTable_FindInteger(&int_table, i));
+
+        /* Odd keys and even keys not removed yet are still there */
+        for (j = 0; j < 12U; j++)
+        {
+            if ((j % 2U) == 1U || j > i)
+            {
+                TEST_ASSERT_EQUAL_PTR(&items[j].hash_node, ezHashTable_FindInteger(&int_table, j));
+            }
+        }
+    }
+    TEST_ASSERT_EQUAL(6U, ezHashTable_GetNumOfNode(&int_table));
+}
+
+
+TEST(ez_hash_table, RandomOperations)
+{
+    static struct ezHashNode *big_slots[128];
+    bool is_inserted[NUM_OF_ITEM] = {false};
+    uint32_t random_state = 2463534242UL;
+    uint32_t num_of_node = 0;
+    uint32_t round = 0;
+    uint32_t i = 0;
+
+    TEST_ASSERT_TRUE(ezHashTable_Init(&str_table, big_slots, 128U, EZ_HASH_KEY_STRING));
+
+    for (round = 0; round < 10000U; round++)
+    {
+        i = ezTest_NextRandom(&random_state) % NUM_OF_ITEM;
+
+        if (is_inserted[i] == false)
+        {
+            TEST_ASSERT_TRUE(ezHashTable_InsertString(&str_table, &items[i].hash_node, items[i].name));
+            is_inserted[i] = true;
+            num_of_node++;
+        }
+        else
+        {
+            TEST_ASSERT_TRUE(ezHashTable_Remove(&str_table, &items[i].hash_node));
+            is_inserted[i] = false;
+            num_of_node--;
+        }
+
+        /* Every key is found if and only if it is inserted */
+        for (i = 0; i < NUM_OF_ITEM; i++)
+        {
+            if (is_inserted[i] == true)
+            {
+                TEST_ASSERT_EQUAL_PTR(&items[i].hash_node, ezHashTable_FindString(&str_table, items[i].name));
+            }
+            else
+            {
+                TEST_ASSERT_NULL(ezHashTable_FindString(&str_table, items[i].name));
+            }
+        }
+        TEST_ASSERT_EQUAL(num_of_node, ezHashTable_GetNumOfNode(&str_table));
+    }
+}
+
+
+/******************************************************************************
+* Internal functions
+*******************************************************************************/
+static void RunAllTests(void)
+{
+    RUN_TEST_GROUP(ez_hash_table);
+}
+
+
+/* End of file */
@@ -55,6 +55,12 @@ struct a_more_complex_one
     bool busy;
 };
 
+struct sorted_item
+{
+    uint32_t key;
+    struct Node node;
+};
+
 /******************************************************************************
 * Module Variable Definitions
 *******************************************************************************/
@@ -64,6 +70,8 @@ struct a_more_complex_one
 * Function Definitions
 *******************************************************************************/
 static void RunAllTests(void);
+static bool IsKeyLess(const struct Node *a, const struct Node *b);
+static uint32_t GetKey(struct Node *node);
 
 /******************************************************************************
 * External functions
@@ -92,6 +100,10 @@ TEST_GROUP_RUNNER(ez_linked_list)
     RUN_TEST_CASE(ez_linked_list, ezLinkedList_IsNodeInList);
     RUN_TEST_CASE(ez_linked_list, Unlink_node);
     RUN_TEST_CASE(ez_linked_list, ezLinkedList_AppendNode);
+    RUN_TEST_CASE(ez_linked_list, ezLinkedList_InsertSorted);
+    RUN_TEST_CASE(ez_linked_list, ezLinkedList_SpliceTail);
+    RUN_TEST_CASE(ez_linked_list, ezLinkedList_MergeSorted);
+    RUN_TEST_CASE(ez_linked_list, CountedList);
 }
 
 
@@ -359,6 +371,139 @@ TEST(ez_linked_list, ezLinkedList_AppendNode)
 }
 
 
+TEST(ez_linked_list, ezLinkedList_InsertSorted)
+{
+    struct Node head = EZ_LINKEDLIST_INIT_NODE(head);
+    struct sorted_item items[] = {{.key = 30}, {.key = 10}, {.key = 20}, {.key = 10}, {.key = 40}};
+    struct Node *it_node = NULL;
+    uint32_t expected[] = {10, 10, 20, 30, 40};
+    uint32_t i = 0;
+
+    for (i = 0; i < 5; i++)
+    {
+        ezLinkedList_InitNode(&items[i].node);
+        TEST_ASSERT_EQUAL(true, ezLinkedList_InsertSorted(&head, &items[i].node, IsKeyLess));
+    }
+
+    i = 0;
+    EZ_LINKEDLIST_FOR_EACH(it_node, &head)
+    {
+        TEST_ASSERT_EQUAL(expected[i], GetKey(it_node));
+        i++;
+    }
+    TEST_ASSERT_EQUAL(5, i);
+
+    /* Equal keys keep their insertion order */
+    TEST_ASSERT_EQUAL_PTR(&items[1].node, head.next);
+    TEST_ASSERT_EQUAL_PTR(&items[3].node, head.next->next);
+
+    TEST_ASSERT_EQUAL(false, ezLinkedList_InsertSorted(&head, NULL, IsKeyLess));
+    TEST_ASSERT_EQUAL(false, ezLinkedList_InsertSorted(&head, &items[0].node, NULL));
+}
+
+
+TEST(ez_linked_list, ezLinkedList_SpliceTail)
+{
+    struct Node to_head = EZ_LINKEDLIST_INIT_NODE(to_head);
+    struct Node from_head = EZ_LINKEDLIST_INIT_NODE(from_head);
+    struct sorted_item items[] = {{.key = 1}, {.key = 2}, {.key = 3}, {.key = 4}};
+    struct Node *it_node = NULL;
+    uint32_t i = 0;
+
+    for (i = 0; i < 4; i++)
+    {
+        ezLinkedList_InitNode(&items[i].node);
+    }
+
+    /* Splicing an empty list changes nothing */
+    ezLinkedList_SpliceTail(&to_head, &from_head);
+    TEST_ASSERT_EQUAL(true, IS_LIST_EMPTY(&to_head));
+
+    EZ_LINKEDLIST_ADD_TAIL(&to_head, &items[0].node);
+    EZ_LINKEDLIST_ADD_TAIL(&from_head, &items[1].node);
+    EZ_LINKEDLIST_ADD_TAIL(&from_head, &items[2].node);
+    EZ_LINKEDLIST_ADD_TAIL(&from_head, &items[3].node);
+
+    ezLinkedList_SpliceTail(&to_head, &from_head);
+    TEST_ASSERT_EQUAL(true, IS_LIST_EMPTY(&from_head));
+    TEST_ASSERT_EQUAL(4, ezLinkedList_GetListSize(&to_head));
+
+    i = 1;
+    EZ_LINKEDLIST_FOR_EACH(it_node, &to_head)
+    {
+        TEST_ASSERT_EQUAL(i, GetKey(it_node));
+        i++;
+    }
+    TEST_ASSERT_EQUAL_PTR(&items[3].node, to_head.prev);
+}
+
+
+TEST(ez_linked_list, ezLinkedList_MergeSorted)
+{
+    struct Node to_head = EZ_LINKEDLIST_INIT_NODE(to_head);
+    struct Node from_head = EZ_LINKEDLIST_INIT_NODE(from_head);
+    struct sorted_item to_items[] = {{.key = 2}, {.key = 4}, {.key = 6}};
+    struct sorted_item from_items[] = {{.key = 1}, {.key = 4}, {.key = 5}, {.key = 8}, {.key = 9}};
+    uint32_t expected[] = {1, 2, 4, 4, 5, 6, 8, 9};
+    struct Node *it_node = NULL;
+    uint32_t i = 0;
+
+    for (i = 0; i < 3; i++)
+    {
+        ezLinkedList_InitNode(&to_items[i].node);
+        EZ_LINKEDLIST_ADD_TAIL(&to_head, &to_items[i].node);
+    }
+    for (i = 0; i < 5; i++)
+    {
+        ezLinkedList_InitNode(&from_items[i].node);
+        EZ_LINKEDLIST_ADD_TAIL(&from_head, &from_items[i].node);
+    }
+
+    ezLinkedList_MergeSorted(&to_head, &from_head, IsKeyLess);
+    TEST_ASSERT_EQUAL(true, IS_LIST_EMPTY(&from_head));
+
+    i = 0;
+    EZ_LINKEDLIST_FOR_EACH(it_node, &to_head)
+    {
+        TEST_ASSERT_EQUAL(expected[i], GetKey(it_node));
+        i++;
+    }
+    TEST_ASSERT_EQUAL(8, i);
+
+    /* On equal keys, the node which was already in the list comes first */
+    TEST_ASSERT_EQUAL_PTR(&to_items[1].node, from_items[0].node.next->next);
+}
+
+
+TEST(ez_linked_list, CountedList)
+{
+    struct ezCountedList list;
+    struct Node node1 = EZ_LINKEDLIST_INIT_NODE(node1);
+    struct Node node2 = EZ_LINKEDLIST_INIT_NODE(node2);
+    struct Node node3 = EZ_LINKEDLIST_INIT_NODE(node3);
+
+    ezLinkedList_InitCountedList(&list);
+    TEST_ASSERT_EQUAL(0, ezLinkedList_GetCountedListSize(&list));
+
+    TEST_ASSERT_EQUAL(true, ezLinkedList_CountedAddHead(&list, &node2));
+    TEST_ASSERT_EQUAL(true, ezLinkedList_CountedAddHead(&list, &node1));
+    TEST_ASSERT_EQUAL(true, ezLinkedList_CountedAddTail(&list, &node3));
+    TEST_ASSERT_EQUAL(3, ezLinkedList_GetCountedListSize(&list));
+    TEST_ASSERT_EQUAL(ezLinkedList_GetListSize(&list.head), ezLinkedList_GetCountedListSize(&list));
+    TEST_ASSERT_EQUAL_PTR(&node1, list.head.next);
+    TEST_ASSERT_EQUAL_PTR(&node3, list.head.prev);
+
+    TEST_ASSERT_EQUAL(true, ezLinkedList_CountedUnlink(&list, &node2));
+    TEST_ASSERT_EQUAL(2, ezLinkedList_GetCountedListSize(&list));
+    TEST_ASSERT_EQUAL(false, ezLinkedList_IsNodeInList(&list.head, &node2));
+
+    /* The head is not a node of the list */
+    TEST_ASSERT_EQUAL(false, ezLinkedList_CountedUnlink(&list, &list.head));
+    TEST_ASSERT_EQUAL(false, ezLinkedList_CountedAddTail(&list, NULL));
+    TEST_ASSERT_EQUAL(2, ezLinkedList_GetCountedListSize(&list));
+}
+
+
 /******************************************************************************
 * Internal functions
 *******************************************************************************/
@@ -368,4 +513,17 @@ static void RunAllTests(void)
 }
 
 
+static bool IsKeyLess(const struct Node *a, const struct Node *b)
+{
+    return (EZ_LINKEDLIST_GET_PARENT_OF(a, node, struct sorted_item))->key
+           < (EZ_LINKEDLIST_GET_PARENT_OF(b, node, struct sorted_item))->key;
+}
+
+
+static uint32_t GetKey(struct Node *node)
+{
+    return (EZ_LINKEDLIST_GET_PARENT_OF(node, node, struct sorted_item))->key;
+}
+
+
 /* End of file */
@@ -0,0 +1,260 @@
+/*****************************************************************************
+* Filename:         bench_ez_mpmc_queue.c
+* Author:           Hai Nguyen
+* Original Date:    18.10.2026
+*
+* ----------------------------------------------------------------------------
+* Contact:          Hai Nguyen
+*                   hainguyen.eeit@gmail.com
+*
+* ----------------------------------------------------------------------------
+* License: This file is published under the license described in LICENSE.md
+*
+*****************************************************************************/
+
+/** @file   bench_ez_mpmc_queue.c
+ *  @author Hai Nguyen
+ *  @date   18.10.2026
+ *  @brief  Microbenchmark of the MPMC queue
+ *
+ *  @details Moves the same number of messages from N producer threads to N
+ *  consumer threads, once through the MPMC queue and once through an ezQueue
+ *  guarded by a mutex, and prints the time per message. The benchmark is
+ *  not run by ctest, build it with CMAKE_BUILD_TYPE=Release to get
+ *  meaningful numbers.
+ *
+ */
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <time.h>
+#include <pthread.h>
+#include <sched.h>
+#include "ez_queue.h"
+#include "ez_mpmc_queue.h"
+
+
+/******************************************************************************
+* Module Preprocessor Macros
+*******************************************************************************/
+#define NUM_OF_MSG          400000UL    /* in total, shared by the producers */
+#define MAX_NUM_OF_THREAD   4U
+#define NUM_OF_SLOT         256U
+
+
+/******************************************************************************
+* Module Typedefs
+*******************************************************************************/
+typedef bool (*PushFunction)(uint32_t msg);
+typedef bool (*PopFunction)(uint32_t *msg);
+
+struct BenchQueue
+{
+    const char *name;
+    void (*init)(void);
+    PushFunction push;
+    PopFunction pop;
+};
+
+
+/******************************************************************************
+* Module Variable Definitions
+*******************************************************************************/
+static uint32_t mpmc_buff[EZ_MPMC_QUEUE_BUFF_SIZE(sizeof(uint32_t), NUM_OF_SLOT)
+                          / sizeof(uint32_t)];
+static ezMpmcQueue mpmc_queue;
+
+static uint8_t locked_buff[NUM_OF_SLOT * 32U];
+static ezQueue locked_queue;
+static pthread_mutex_t locked_queue_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+static const struct BenchQueue *bench_queue;
+static uint32_t msg_per_producer;
+static uint32_t num_of_msg_total;
+static atomic_uint_least32_t num_of_consumed;
+static volatile uint32_t sink;
+
+
+/******************************************************************************
+* Function Definitions
+*******************************************************************************/
+static void MpmcInit(void);
+static bool MpmcPush(uint32_t msg);
+static bool MpmcPop(uint32_t *msg);
+static void LockedInit(void);
+static bool LockedPush(uint32_t msg);
+static bool LockedPop(uint32_t *msg);
+static double MeasureNsPerMsg(const struct BenchQueue *queue, uint32_t num_of_thread);
+static void *Producer(void *arg);
+static void *Consumer(void *arg);
+
+
+/******************************************************************************
+* External functions
+*******************************************************************************/
+int main(void)
+{
+    static const struct BenchQueue queues[] = {
+        {"ezMpmcQueue", MpmcInit, MpmcPush, MpmcPop},
+        {"ezQueue + mutex", LockedInit, LockedPush, LockedPop},
+    };
+    uint32_t num_of_thread = 0;
+    uint32_t i = 0;
+
+    printf("%-28s", "queue (ns per message)");
+    for(num_of_thread = 1; num_of_thread <= MAX_NUM_OF_THREAD; num_of_thread *= 2)
+    {
+        printf(" %6luP/%luC", (unsigned long)num_of_thread, (unsigned long)num_of_thread);
+    }
+    printf("\n");
+
+    for(i = 0; i < sizeof(queues) / sizeof(queues[0]); i++)
+    {
+        printf("%-28s", queues[i].name);
+        for(num_of_thread = 1; num_of_thread <= MAX_NUM_OF_THREAD; num_of_thread *= 2)
+        {
+            printf(" %10.2f", MeasureNsPerMsg(&queues[i], num_of_thread));
+        }
+        printf("\n");
+    }
+
+    return 0;
+}
+
+
+/******************************************************************************
+* Internal functions
+*******************************************************************************/
+static double MeasureNsPerMsg(const struct BenchQueue *queue, uint32_t num_of_thread)
+{
+    pthread_t producers[MAX_NUM_OF_THREAD];
+    pthread_t consumers[MAX_NUM_OF_THREAD];
+    struct timespec start;
+    struct timespec stop;
+    uint32_t i = 0;
+
+    bench_queue = queue;
+    msg_per_producer = NUM_OF_MSG / num_of_thread;
+    num_of_msg_total = msg_per_producer * num_of_thread;
+    atomic_init(&num_of_consumed, 0U);
+    queue->init();
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &start);
+    for(i = 0; i < num_of_thread; i++)
+    {
+        (void)pthread_create(&consumers[i], NULL, Consumer, NULL);
+        (void)pthread_create(&producers[i], NULL, Producer, NULL);
+    }
+    for(i = 0; i < num_of_thread; i++)
+    {
+        (void)pthread_join(producers[i], NULL);
+        (void)pthread_join(consumers[i], NULL);
+    }
+    (void)clock_gettime(CLOCK_MONOTONIC, &stop);
+
+    return ((double)(stop.tv_sec - start.tv_sec) * 1e9 + (double)(stop.tv_nsec - start.tv_nsec))
+           / (double)num_of_msg_total;
+}
+
+
+static void *Producer(void *arg)
+{
+    uint32_t i = 0;
+
+    (void)arg;
+
+    for(i = 0; i < msg_per_producer; i++)
+    {
+        while(bench_queue->push(i) == false)
+        {
+            (void)sched_yield();
+        }
+    }
+
+    return NULL;
+}
+
+
+static void *Consumer(void *arg)
+{
+    uint32_t msg = 0;
+
+    (void)arg;
+
+    while(atomic_load_explicit(&num_of_consumed, memory_order_relaxed) < num_of_msg_total)
+    {
+        if(bench_queue->pop(&msg) == true)
+        {
+            sink += msg;
+            (void)atomic_fetch_add_explicit(&num_of_consumed, 1U, memory_order_relaxed);
+        }
+        else
+        {
+            (void)sched_yield();
+        }
+    }
+
+    return NULL;
+}
+
+
+static void MpmcInit(void)
+{
+    (void)ezMpmcQueue_Init(&mpmc_queue, mpmc_buff, sizeof(mpmc_buff), sizeof(uint32_t));
+}
+
+
+static bool MpmcPush(uint32_t msg)
+{
+    return ezMpmcQueue_Push(&mpmc_queue, &msg);
+}
+
+
+static bool MpmcPop(uint32_t *msg)
+{
+    return ezMpmcQueue_Pop(&mpmc_queue, msg);
+}
+
+
+static void LockedInit(void)
+{
+    (void)ezQueue_CreateQueue(&locked_queue, locked_buff, sizeof(locked_buff));
+}
+
+
+static bool LockedPush(uint32_t msg)
+{
+    ezSTATUS status = ezFAIL;
+
+    (void)pthread_mutex_lock(&locked_queue_mutex);
+    status = ezQueue_Push(&locked_queue, &msg, sizeof(msg));
+    (void)pthread_mutex_unlock(&locked_queue_mutex);
+
+    return status == ezSUCCESS;
+}
+
+
+static bool LockedPop(uint32_t *msg)
+{
+    ezSTATUS status = ezFAIL;
+    void *data = NULL;
+    uint32_t data_size = 0;
+
+    (void)pthread_mutex_lock(&locked_queue_mutex);
+    status = ezQueue_GetFront(&locked_queue, &data, &data_size);
+    if(status == ezSUCCESS)
+    {
+        *msg = *(uint32_t*)data;
+        (void)ezQueue_PopFront(&locked_queue);
+    }
+    (void)pthread_mutex_unlock(&locked_queue_mutex);
+
+    return status == ezSUCCESS;
+}
+
+
+/* End of file */
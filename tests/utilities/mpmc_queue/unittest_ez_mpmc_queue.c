@@ -0,0 +1,333 @@
+/*****************************************************************************
+* Filename:         unittest_ez_mpmc_queue.c
+* Author:           Hai Nguyen
+* Original Date:    18.10.2026
+*
+* ----------------------------------------------------------------------------
+* Contact:          Hai Nguyen
+*                   hainguyen.eeit@gmail.com
+*
+* ----------------------------------------------------------------------------
+* License: This file is published under the license described in LICENSE.md
+*
+*****************************************************************************/
+
+/** @file   unittest_ez_mpmc_queue.c
+ *  @author Hai Nguyen
+ *  @date   18.10.2026
+ *  @brief  Unit test for MPMC queue component
+ *
+ *  @details
+ *
+ */
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <pthread.h>
+#include <sched.h>
+#include "unity.h"
+#include "unity_fixture.h"
+#include "ez_mpmc_queue.h"
+
+TEST_GROUP(ez_mpmc_queue);
+
+/******************************************************************************
+* Module Preprocessor Macros
+*******************************************************************************/
+#define NUM_OF_SLOT                 8U
+#define STRESS_NUM_OF_SLOT          16U
+#define STRESS_NUM_OF_PRODUCER      4U
+#define STRESS_NUM_OF_CONSUMER      4U
+#define STRESS_NUM_OF_MSG           50000UL     /* per producer */
+
+#define MSG_PRODUCER(msg)           ((msg) >> 24)
+#define MSG_SEQ(msg)                ((msg) & 0x00FFFFFFUL)
+
+
+/******************************************************************************
+* Module Typedefs
+*******************************************************************************/
+struct ConsumerResult
+{
+    uint32_t num_of_msg;
+    bool is_in_order;
+};
+
+
+/******************************************************************************
+* Module Variable Definitions
+*******************************************************************************/
+static uint32_t buff[EZ_MPMC_QUEUE_BUFF_SIZE(sizeof(uint32_t), NUM_OF_SLOT) / sizeof(uint32_t)];
+static ezMpmcQueue queue;
+
+static uint32_t stress_buff[EZ_MPMC_QUEUE_BUFF_SIZE(sizeof(uint32_t), STRESS_NUM_OF_SLOT)
+                            / sizeof(uint32_t)];
+static ezMpmcQueue stress_queue;
+static uint8_t is_received[STRESS_NUM_OF_PRODUCER][STRESS_NUM_OF_MSG];
+static atomic_uint_least32_t num_of_consumed;
+
+
+/******************************************************************************
+* Function Definitions
+*******************************************************************************/
+static void RunAllTests(void);
+static void *StressProducer(void *arg);
+static void *StressConsumer(void *arg);
+
+
+/******************************************************************************
+* External functions
+*******************************************************************************/
+int main(int argc, const char *argv[])
+{
+    return UnityMain(argc, argv, RunAllTests);
+}
+
+
+TEST_SETUP(ez_mpmc_queue)
+{
+    memset(buff, 0, sizeof(buff));
+    (void)ezMpmcQueue_Init(&queue, buff, sizeof(buff), sizeof(uint32_t));
+}
+
+
+TEST_TEAR_DOWN(ez_mpmc_queue)
+{
+}
+
+
+TEST_GROUP_RUNNER(ez_mpmc_queue)
+{
+    RUN_TEST_CASE(ez_mpmc_queue, init_invalid_param);
+    RUN_TEST_CASE(ez_mpmc_queue, init_rounds_down_to_power_of_two);
+    RUN_TEST_CASE(ez_mpmc_queue, push_pop_fifo);
+    RUN_TEST_CASE(ez_mpmc_queue, push_when_full);
+    RUN_TEST_CASE(ez_mpmc_queue, pop_when_empty);
+    RUN_TEST_CASE(ez_mpmc_queue, wrap_around);
+    RUN_TEST_CASE(ez_mpmc_queue, multi_producer_multi_consumer_stress);
+}
+
+
+TEST(ez_mpmc_queue, init_invalid_param)
+{
+    ezMpmcQueue test_queue;
+
+    TEST_ASSERT_FALSE(ezMpmcQueue_Init(NULL, buff, sizeof(buff), sizeof(uint32_t)));
+    TEST_ASSERT_FALSE(ezMpmcQueue_Init(&test_queue, NULL, sizeof(buff), sizeof(uint32_t)));
+    TEST_ASSERT_FALSE(ezMpmcQueue_Init(&test_queue, buff, sizeof(buff), 0U));
+    TEST_ASSERT_FALSE(ezMpmcQueue_Init(&test_queue, buff, 4U, sizeof(uint32_t)));
+    TEST_ASSERT_FALSE(ezMpmcQueue_Init(&test_queue, (uint8_t*)buff + 1, sizeof(buff) - 4U,
+                                       sizeof(uint32_t)));
+}
+
+
+TEST(ez_mpmc_queue, init_rounds_down_to_power_of_two)
+{
+    ezMpmcQueue test_queue;
+
+    /* Room for 7 slots gives 4 */
+    TEST_ASSERT_TRUE(ezMpmcQueue_Init(&test_queue, buff,
+                                      EZ_MPMC_QUEUE_BUFF_SIZE(sizeof(uint32_t), 7U),
+                                      sizeof(uint32_t)));
+    TEST_ASSERT_EQUAL(4U, ezMpmcQueue_GetCapacity(&test_queue));
+
+    TEST_ASSERT_EQUAL(NUM_OF_SLOT, ezMpmcQueue_GetCapacity(&queue));
+}
+
+
+TEST(ez_mpmc_queue, push_pop_fifo)
+{
+    uint32_t data = 0;
+    uint32_t i = 0;
+
+    for (i = 0; i < 5U; i++)
+    {
+        TEST_ASSERT_TRUE(ezMpmcQueue_Push(&queue, &i));
+    }
+
+    for (i = 0; i < 5U; i++)
+    {
+        TEST_ASSERT_TRUE(ezMpmcQueue_Pop(&queue, &data));
+        TEST_ASSERT_EQUAL(i, data);
+    }
+}
+
+
+TEST(ez_mpmc_queue, push_when_full)
+{
+    uint32_t data = 0;
+    uint32_t i = 0;
+
+    for (i = 0; i < NUM_OF_SLOT; i++)
+    {
+        TEST_ASSERT_TRUE(ezMpmcQueue_Push(&queue, &i));
+    }
+    TEST_ASSERT_FALSE(ezMpmcQueue_Push(&queue, &i));
+
+    /* One pop makes room for one push */
+    TEST_ASSERT_TRUE(ezMpmcQueue_Pop(&queue, &data));
+    TEST_ASSERT_EQUAL(0U, data);
+    TEST_ASSERT_TRUE(ezMpmcQueue_Push(&queue, &i));
+    TEST_ASSERT_FALSE(ezMpmcQueue_Push(&queue, &i));
+}
+
+
+TEST(ez_mpmc_queue, pop_when_empty)
+{
+    uint32_t data = 0xCAFEU;
+
+    TEST_ASSERT_FALSE(ezMpmcQueue_Pop(&queue, &data));
+    TEST_ASSERT_EQUAL(0xCAFEU, data);
+
+    TEST_ASSERT_TRUE(ezMpmcQueue_Push(&queue, &data));
+    TEST_ASSERT_TRUE(ezMpmcQueue_Pop(&queue, &data));
+    TEST_ASSERT_FALSE(ezMpmcQueue_Pop(&queue, &data));
+}
+
+
+TEST(ez_mpmc_queue, wrap_around)
+{
+    uint32_t data = 0;
+    uint32_t i = 0;
+
+    /* Several laps over the slots, with one element in flight */
+    for (i = 0; i < NUM_OF_SLOT * 5U; i++)
+    {
+        TEST_ASSERT_TRUE(ezMpmcQueue_Push(&queue, &i));
+        TEST_ASSERT_TRUE(ezMpmcQueue_Pop(&queue, &data));
+        TEST_ASSERT_EQUAL(i, data);
+    }
+    TEST_ASSERT_FALSE(ezMpmcQueue_Pop(&queue, &data));
+}
+
+
+TEST(ez_mpmc_queue, multi_producer_multi_consumer_stress)
+{
+    pthread_t producers[STRESS_NUM_OF_PRODUCER];
+    pthread_t consumers[STRESS_NUM_OF_CONSUMER];
+    uint32_t producer_ids[STRESS_NUM_OF_PRODUCER];
+    struct ConsumerResult results[STRESS_NUM_OF_CONSUMER];
+    uint32_t total = 0;
+    uint32_t num_of_missing = 0;
+    uint32_t i = 0;
+    uint32_t j = 0;
+
+    memset(is_received, 0, sizeof(is_received));
+    atomic_init(&num_of_consumed, 0U);
+    TEST_ASSERT_TRUE(ezMpmcQueue_Init(&stress_queue, stress_buff, sizeof(stress_buff),
+                                      sizeof(uint32_t)));
+
+    for (i = 0; i < STRESS_NUM_OF_CONSUMER; i++)
+    {
+        TEST_ASSERT_EQUAL(0, pthread_create(&consumers[i], NULL, StressConsumer, &results[i]));
+    }
+    for (i = 0; i < STRESS_NUM_OF_PRODUCER; i++)
+    {
+        producer_ids[i] = i;
+        TEST_ASSERT_EQUAL(0, pthread_create(&producers[i], NULL, StressProducer, &producer_ids[i]));
+    }
+
+    for (i = 0; i < STRESS_NUM_OF_PRODUCER; i++)
+    {
+        TEST_ASSERT_EQUAL(0, pthread_join(producers[i], NULL));
+    }
+    for (i = 0; i < STRESS_NUM_OF_CONSUMER; i++)
+    {
+        TEST_ASSERT_EQUAL(0, pthread_join(consumers[i], NULL));
+        TEST_ASSERT_TRUE(results[i].is_in_order);
+        total += results[i].num_of_msg;
+    }
+
+    /* Every message is received exactly once */
+    TEST_ASSERT_EQUAL(STRESS_NUM_OF_PRODUCER * STRESS_NUM_OF_MSG, total);
+    for (i = 0; i < STRESS_NUM_OF_PRODUCER; i++)
+    {
+        for (j = 0; j < STRESS_NUM_OF_MSG; j++)
+        {
+            if (is_received[i][j] != 1U)
+            {
+                num_of_missing++;
+            }
+        }
+    }
+    TEST_ASSERT_EQUAL(0U, num_of_missing);
+}
+
+
+/******************************************************************************
+* Internal functions
+*******************************************************************************/
+static void RunAllTests(void)
+{
+    RUN_TEST_GROUP(ez_mpmc_queue);
+}
+
+
+static void *StressProducer(void *arg)
+{
+    uint32_t producer_id = *(uint32_t*)arg;
+    uint32_t msg = 0;
+    uint32_t i = 0;
+
+    for (i = 0; i < STRESS_NUM_OF_MSG; i++)
+    {
+        msg = (producer_id << 24) | i;
+        while (ezMpmcQueue_Push(&stress_queue, &msg) == false)
+        {
+            (void)sched_yield();
+        }
+    }
+
+    return NULL;
+}
+
+
+static void *StressConsumer(void *arg)
+{
+    struct ConsumerResult *result = (struct ConsumerResult*)arg;
+    uint32_t last_seq[STRESS_NUM_OF_PRODUCER];
+    bool has_last_seq[STRESS_NUM_OF_PRODUCER] = {false};
+    uint32_t msg = 0;
+    uint32_t producer_id = 0;
+
+    result->num_of_msg = 0;
+    result->is_in_order = true;
+
+    while (atomic_load(&num_of_consumed) < STRESS_NUM_OF_PRODUCER * STRESS_NUM_OF_MSG)
+    {
+        if (ezMpmcQueue_Pop(&stress_queue, &msg) == false)
+        {
+            (void)sched_yield();
+            continue;
+        }
+
+        producer_id = MSG_PRODUCER(msg);
+        if (producer_id >= STRESS_NUM_OF_PRODUCER || MSG_SEQ(msg) >= STRESS_NUM_OF_MSG)
+        {
+            result->is_in_order = false;
+        }
+        else
+        {
+            /* Messages of one producer reach a consumer in the order they were pushed */
+            if (has_last_seq[producer_id] == true && MSG_SEQ(msg) <= last_seq[producer_id])
+            {
+                result->is_in_order = false;
+            }
+            last_seq[producer_id] = MSG_SEQ(msg);
+            has_last_seq[producer_id] = true;
+            is_received[producer_id][MSG_SEQ(msg)]++;
+        }
+
+        result->num_of_msg++;
+        (void)atomic_fetch_add(&num_of_consumed, 1U);
+    }
+
+    return NULL;
+}
+
+
+/* End of file */
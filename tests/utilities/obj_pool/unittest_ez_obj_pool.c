@@ -0,0 +1,194 @@
+/*****************************************************************************
+* Filename:         unittest_ez_obj_pool.c
+* Author:           Hai Nguyen
+* Original Date:    18.10.2026
+*
+* ----------------------------------------------------------------------------
+* Contact:          Hai Nguyen
+*                   hainguyen.eeit@gmail.com
+*
+* ----------------------------------------------------------------------------
+* License: This file is published under the license described in LICENSE.md
+*
+*****************************************************************************/
+
+/** @file   unittest_ez_obj_pool.c
+ *  @author Hai Nguyen
+ *  @date   18.10.2026
+ *  @brief  Unit test for object pool component
+ *
+ *  @details
+ *
+ */
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "unity.h"
+#include "unity_fixture.h"
+#include "ez_obj_pool.h"
+
+TEST_GROUP(ez_obj_pool);
+
+/******************************************************************************
+* Module Preprocessor Macros
+*******************************************************************************/
+#define NUM_OF_OBJ      4U
+
+
+/******************************************************************************
+* Module Typedefs
+*******************************************************************************/
+struct TestObj
+{
+    uint32_t id;
+    uint8_t payload[10];
+};
+
+
+/******************************************************************************
+* Module Variable Definitions
+*******************************************************************************/
+static EZ_OBJ_POOL_SLOT(struct TestObj) slots[NUM_OF_OBJ];
+static ezObjPool pool;
+
+EZ_OBJ_POOL_DEFINE(static_pool, struct TestObj, NUM_OF_OBJ);
+
+
+/******************************************************************************
+* Function Definitions
+*******************************************************************************/
+static void RunAllTests(void);
+
+/******************************************************************************
+* External functions
+*******************************************************************************/
+int main(int argc, const char *argv[])
+{
+    return UnityMain(argc, argv, RunAllTests);
+}
+
+
+TEST_SETUP(ez_obj_pool)
+{
+    memset(slots, 0, sizeof(slots));
+    (void)ezObjPool_Init(&pool, slots, sizeof(slots[0]), NUM_OF_OBJ);
+}
+
+
+TEST_TEAR_DOWN(ez_obj_pool)
+{
+}
+
+
+TEST_GROUP_RUNNER(ez_obj_pool)
+{
+    RUN_TEST_CASE(ez_obj_pool, init_invalid_param);
+    RUN_TEST_CASE(ez_obj_pool, alloc_until_empty);
+    RUN_TEST_CASE(ez_obj_pool, free_and_reuse);
+    RUN_TEST_CASE(ez_obj_pool, free_invalid_obj);
+    RUN_TEST_CASE(ez_obj_pool, static_define);
+}
+
+
+TEST(ez_obj_pool, init_invalid_param)
+{
+    ezObjPool test_pool;
+
+    TEST_ASSERT_FALSE(ezObjPool_Init(NULL, slots, sizeof(slots[0]), NUM_OF_OBJ));
+    TEST_ASSERT_FALSE(ezObjPool_Init(&test_pool, NULL, sizeof(slots[0]), NUM_OF_OBJ));
+    TEST_ASSERT_FALSE(ezObjPool_Init(&test_pool, slots, 1U, NUM_OF_OBJ));
+    TEST_ASSERT_FALSE(ezObjPool_Init(&test_pool, slots, sizeof(slots[0]), 0U));
+    TEST_ASSERT_NULL(ezObjPool_Alloc(NULL));
+    TEST_ASSERT_FALSE(ezObjPool_Free(NULL, &slots[0]));
+}
+
+
+TEST(ez_obj_pool, alloc_until_empty)
+{
+    struct TestObj *objs[NUM_OF_OBJ] = {0};
+    uint32_t i = 0;
+
+    TEST_ASSERT_EQUAL(NUM_OF_OBJ, ezObjPool_GetNumOfFreeObj(&pool));
+
+    for (i = 0; i < NUM_OF_OBJ; i++)
+    {
+        objs[i] = EZ_OBJ_POOL_ALLOC(&pool, struct TestObj);
+        TEST_ASSERT_EQUAL_PTR(&slots[i], objs[i]);
+        objs[i]->id = i;
+    }
+
+    TEST_ASSERT_NULL(ezObjPool_Alloc(&pool));
+    TEST_ASSERT_EQUAL(0U, ezObjPool_GetNumOfFreeObj(&pool));
+
+    for (i = 0; i < NUM_OF_OBJ; i++)
+    {
+        TEST_ASSERT_EQUAL(i, objs[i]->id);
+        TEST_ASSERT_TRUE(ezObjPool_IsOwner(&pool, objs[i]));
+    }
+}
+
+
+TEST(ez_obj_pool, free_and_reuse)
+{
+    struct TestObj *obj1 = EZ_OBJ_POOL_ALLOC(&pool, struct TestObj);
+    struct TestObj *obj2 = EZ_OBJ_POOL_ALLOC(&pool, struct TestObj);
+
+    TEST_ASSERT_NOT_NULL(obj1);
+    TEST_ASSERT_NOT_NULL(obj2);
+    TEST_ASSERT_EQUAL(NUM_OF_OBJ - 2U, ezObjPool_GetNumOfFreeObj(&pool));
+
+    TEST_ASSERT_TRUE(ezObjPool_Free(&pool, obj1));
+    TEST_ASSERT_TRUE(ezObjPool_Free(&pool, obj2));
+    TEST_ASSERT_EQUAL(NUM_OF_OBJ, ezObjPool_GetNumOfFreeObj(&pool));
+
+    /* Released objects are reused first, the last released one first */
+    TEST_ASSERT_EQUAL_PTR(obj2, ezObjPool_Alloc(&pool));
+    TEST_ASSERT_EQUAL_PTR(obj1, ezObjPool_Alloc(&pool));
+    TEST_ASSERT_EQUAL_PTR(&slots[2], ezObjPool_Alloc(&pool));
+}
+
+
+TEST(ez_obj_pool, free_invalid_obj)
+{
+    struct TestObj other_obj;
+    struct TestObj *obj = EZ_OBJ_POOL_ALLOC(&pool, struct TestObj);
+
+    TEST_ASSERT_FALSE(ezObjPool_Free(&pool, &other_obj));
+    TEST_ASSERT_FALSE(ezObjPool_Free(&pool, (uint8_t*)obj + 1));
+    TEST_ASSERT_FALSE(ezObjPool_Free(&pool, &slots[1]));
+    TEST_ASSERT_FALSE(ezObjPool_IsOwner(&pool, &other_obj));
+    TEST_ASSERT_EQUAL(NUM_OF_OBJ - 1U, ezObjPool_GetNumOfFreeObj(&pool));
+
+    TEST_ASSERT_TRUE(ezObjPool_Free(&pool, obj));
+}
+
+
+TEST(ez_obj_pool, static_define)
+{
+    uint32_t num_of_obj = 0;
+
+    while (EZ_OBJ_POOL_ALLOC(&static_pool, struct TestObj) != NULL)
+    {
+        num_of_obj++;
+    }
+
+    TEST_ASSERT_EQUAL(NUM_OF_OBJ, num_of_obj);
+    TEST_ASSERT_TRUE(ezObjPool_Free(&static_pool, &static_pool_slots[3]));
+    TEST_ASSERT_EQUAL_PTR(&static_pool_slots[3], ezObjPool_Alloc(&static_pool));
+}
+
+
+/******************************************************************************
+* Internal functions
+*******************************************************************************/
+static void RunAllTests(void)
+{
+    RUN_TEST_GROUP(ez_obj_pool);
+}
+
+
+/* End of file */
@@ -0,0 +1,294 @@
+/*****************************************************************************
+* Filename:         unittest_ez_priority_queue.c
+* Author:           Hai Nguyen
+* Original Date:    18.10.2026
+*
+* ----------------------------------------------------------------------------
+* Contact:          Hai Nguyen
+*                   hainguyen.eeit@gmail.com
+*
+* ----------------------------------------------------------------------------
+* License: This file is published under the license described in LICENSE.md
+*
+*****************************************************************************/
+
+/** @file   unittest_ez_priority_queue.c
+ *  @author Hai Nguyen
+ *  @date   18.10.2026
+ *  @brief  Unit test for the priority queue component
+ *
+ *  @details
+ *
+ */
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "unity.h"
+#include "unity_fixture.h"
+#include "ez_priority_queue.h"
+#include "ez_test_random.h"
+
+TEST_GROUP(ez_priority_queue);
+
+/******************************************************************************
+* Module Preprocessor Macros
+*******************************************************************************/
+#define NUM_OF_ITEM     200U
+
+
+/******************************************************************************
+* Module Typedefs
+*******************************************************************************/
+struct test_item
+{
+    uint32_t key;
+    struct ezPriorityQueueNode node;
+};
+
+
+/******************************************************************************
+* Module Variable Definitions
+*******************************************************************************/
+static struct ezPriorityQueue queue;
+static struct test_item items[NUM_OF_ITEM];
+
+
+/******************************************************************************
+* Function Definitions
+*******************************************************************************/
+static void RunAllTests(void);
+static bool IsKeyLess(const struct ezPriorityQueueNode *a, const struct ezPriorityQueueNode *b);
+static uint32_t GetKey(struct ezPriorityQueueNode *node);
+
+
+/******************************************************************************
+* External functions
+*******************************************************************************/
+int main(int argc, const char *argv[])
+{
+    return UnityMain(argc, argv, RunAllTests);
+}
+
+
+TEST_SETUP(ez_priority_queue)
+{
+    uint32_t i = 0;
+
+    (void)ezPriorityQueue_Init(&queue, IsKeyLess);
+    for (i = 0; i < NUM_OF_ITEM; i++)
+    {
+        items[i].key = 0;
+        ezPriorityQueue_InitNode(&items[i].node);
+    }
+}
+
+
+TEST_TEAR_DOWN(ez_priority_queue)
+{
+}
+
+
+TEST_GROUP_RUNNER(ez_priority_queue)
+{
+    RUN_TEST_CASE(ez_priority_queue, Init_InvalidParam);
+    RUN_TEST_CASE(ez_priority_queue, EmptyQueue);
+    RUN_TEST_CASE(ez_priority_queue, Insert_PeekReturnsMin);
+    RUN_TEST_CASE(ez_priority_queue, ExtractMin_InOrder);
+    RUN_TEST_CASE(ez_priority_queue, Insert_NodeAlreadyInQueue);
+    RUN_TEST_CASE(ez_priority_queue, Remove_AnyNode);
+    RUN_TEST_CASE(ez_priority_queue, RandomOperations);
+}
+
+
+TEST(ez_priority_queue, Init_InvalidParam)
+{
+    struct ezPriorityQueue test_queue;
+
+    TEST_ASSERT_FALSE(ezPriorityQueue_Init(NULL, IsKeyLess));
+    TEST_ASSERT_FALSE(ezPriorityQueue_Init(&test_queue, NULL));
+}
+
+
+TEST(ez_priority_queue, EmptyQueue)
+{
+    TEST_ASSERT_NULL(ezPriorityQueue_Peek(&queue));
+    TEST_ASSERT_NULL(ezPriorityQueue_ExtractMin(&queue));
+    TEST_ASSERT_FALSE(ezPriorityQueue_Remove(&queue, &items[0].node));
+    TEST_ASSERT_FALSE(ezPriorityQueue_IsNodeInQueue(&queue, &items[0].node));
+    TEST_ASSERT_EQUAL(0U, ezPriorityQueue_GetNumOfNode(&queue));
+}
+
+
+TEST(ez_priority_queue, Insert_PeekReturnsMin)
+{
+    uint32_t keys[] = {50, 20, 70, 10, 40};
+    uint32_t expected_min[] = {50, 20, 20, 10, 10};
+    uint32_t i = 0;
+
+    for (i = 0; i < sizeof(keys) / sizeof(keys[0]); i++)
+    {
+        items[i].key = keys[i];
+        TEST_ASSERT_TRUE(ezPriorityQueue_Insert(&queue, &items[i].node));
+        TEST_ASSERT_EQUAL(expected_min[i], GetKey(ezPriorityQueue_Peek(&queue)));
+        TEST_ASSERT_TRUE(ezPriorityQueue_IsNodeInQueue(&queue, &items[i].node));
+    }
+    TEST_ASSERT_EQUAL(5U, ezPriorityQueue_GetNumOfNode(&queue));
+}
+
+
+TEST(ez_priority_queue, ExtractMin_InOrder)
+{
+    uint32_t keys[] = {9, 3, 7, 3, 1, 8, 2, 6, 5, 4};
+    uint32_t expected[] = {1, 2, 3, 3, 4, 5, 6, 7, 8, 9};
+    struct ezPriorityQueueNode *node = NULL;
+    uint32_t i = 0;
+
+    for (i = 0; i < sizeof(keys) / sizeof(keys[0]); i++)
+    {
+        items[i].key = keys[i];
+        TEST_ASSERT_TRUE(ezPriorityQueue_Insert(&queue, &items[i].node));
+    }
+
+    for (i = 0; i < sizeof(expected) / sizeof(expected[0]); i++)
+    {
+        node = ezPriorityQueue_ExtractMin(&queue);
+        TEST_ASSERT_NOT_NULL(node);
+        TEST_ASSERT_EQUAL(expected[i], GetKey(node));
+        TEST_ASSERT_FALSE(ezPriorityQueue_IsNodeInQueue(&queue, node));
+    }
+    TEST_ASSERT_NULL(ezPriorityQueue_ExtractMin(&queue));
+    TEST_ASSERT_EQUAL(0U, ezPriorityQueue_GetNumOfNode(&queue));
+}
+
+
+TEST(ez_priority_queue, Insert_NodeAlreadyInQueue)
+{
+    items[0].key = 1;
+    items[1].key = 2;
+
+    TEST_ASSERT_TRUE(ezPriorityQueue_Insert(&queue, &items[0].node));
+    TEST_ASSERT_TRUE(ezPriorityQueue_Insert(&queue, &items[1].node));
+
+    /* Root and inner node alike are rejected */
+    TEST_ASSERT_FALSE(ezPriorityQueue_Insert(&queue, &items[0].node));
+    TEST_ASSERT_FALSE(ezPriorityQueue_Insert(&queue, &items[1].node));
+    TEST_ASSERT_EQUAL(2U, ezPriorityQueue_GetNumOfNode(&queue));
+}
+
+
+TEST(ez_priority_queue, Remove_AnyNode)
+{
+    uint32_t keys[] = {5, 1, 4, 2, 3};
+    struct ezPriorityQueueNode *node = NULL;
+    uint32_t i = 0;
+
+    for (i = 0; i < sizeof(keys) / sizeof(keys[0]); i++)
+    {
+        items[i].key = keys[i];
+        TEST_ASSERT_TRUE(ezPriorityQueue_Insert(&queue, &items[i].node));
+    }
+
+    /* Pop once, so the heap has inner nodes with children */
+    node = ezPriorityQueue_ExtractMin(&queue);
+    TEST_ASSERT_EQUAL(1U, GetKey(node));
+
+    /* Inner node, then root */
+    TEST_ASSERT_TRUE(ezPriorityQueue_Remove(&queue, &items[2].node));
+    TEST_ASSERT_FALSE(ezPriorityQueue_Remove(&queue, &items[2].node));
+    TEST_ASSERT_TRUE(ezPriorityQueue_Remove(&queue, &items[3].node));
+    TEST_ASSERT_EQUAL(2U, ezPriorityQueue_GetNumOfNode(&queue));
+
+    TEST_ASSERT_EQUAL(3U, GetKey(ezPriorityQueue_ExtractMin(&queue)));
+    TEST_ASSERT_EQUAL(5U, GetKey(ezPriorityQueue_ExtractMin(&queue)));
+    TEST_ASSERT_NULL(ezPriorityQueue_ExtractMin(&queue));
+
+    /* A removed node can be inserted again */
+    TEST_ASSERT_TRUE(ezPriorityQueue_Insert(&queue, &items[2].node));
+    TEST_ASSERT_EQUAL(4U, GetKey(ezPriorityQueue_Peek(&queue)));
+}
+
+
+TEST(ez_priority_queue, RandomOperations)
+{
+    uint32_t random_state = 12345;
+    uint32_t round = 0;
+    uint32_t i = 0;
+    uint32_t num_of_node = 0;
+    uint32_t min_key = 0;
+    uint32_t last_key = 0;
+    struct ezPriorityQueueNode *node = NULL;
+
+    for (round = 0; round < 20000U; round++)
+    {
+        i = ezTest_NextRandom(&random_state) % NUM_OF_ITEM;
+
+        if (ezPriorityQueue_IsNodeInQueue(&queue, &items[i].node) == false)
+        {
+            items[i].key = ezTest_NextRandom(&random_state) % 1000U;
+            TEST_ASSERT_TRUE(ezPriorityQueue_Insert(&queue, &items[i].node));
+            num_of_node++;
+        }
+        else if ((ezTest_NextRandom(&random_state) & 1U) == 0U)
+        {
+            TEST_ASSERT_TRUE(ezPriorityQueue_Remove(&queue, &items[i].node));
+            num_of_node--;
+        }
+        else
+        {
+            /* Peek must be the minimum of the nodes in the queue */
+            min_key = UINT32_MAX;
+            for (i = 0; i < NUM_OF_ITEM; i++)
+            {
+                if (ezPriorityQueue_IsNodeInQueue(&queue, &items[i].node) == true
+                    && items[i].key < min_key)
+                {
+                    min_key = items[i].key;
+                }
+            }
+            node = ezPriorityQueue_ExtractMin(&queue);
+            TEST_ASSERT_EQUAL(min_key, GetKey(node));
+            num_of_node--;
+        }
+
+        TEST_ASSERT_EQUAL(num_of_node, ezPriorityQueue_GetNumOfNode(&queue));
+    }
+
+    /* Draining gives the keys in ascending order */
+    while ((node = ezPriorityQueue_ExtractMin(&queue)) != NULL)
+    {
+        TEST_ASSERT_TRUE(GetKey(node) >= last_key);
+        last_key = GetKey(node);
+        num_of_node--;
+    }
+    TEST_ASSERT_EQUAL(0U, num_of_node);
+}
+
+
+/******************************************************************************
+* Internal functions
+*******************************************************************************/
+static void RunAllTests(void)
+{
+    RUN_TEST_GROUP(ez_priority_queue);
+}
+
+
+static bool IsKeyLess(const struct ezPriorityQueueNode *a, const struct ezPriorityQueueNode *b)
+{
+    const struct test_item *item_a = EZ_PRIORITY_QUEUE_GET_PARENT_OF(a, node, const struct test_item);
+    const struct test_item *item_b = EZ_PRIORITY_QUEUE_GET_PARENT_OF(b, node, const struct test_item);
+
+    return item_a->key < item_b->key;
+}
+
+
+static uint32_t GetKey(struct ezPriorityQueueNode *node)
+{
+    return EZ_PRIORITY_QUEUE_GET_PARENT_OF(node, node, struct test_item)->key;
+}
+
+
+/* End of file */
@@ -0,0 +1,159 @@
+/*****************************************************************************
+* Filename:         bench_ez_queue.c
+* Author:           Hai Nguyen
+* Original Date:    18.10.2026
+*
+* ----------------------------------------------------------------------------
+* Contact:          Hai Nguyen
+*                   hainguyen.eeit@gmail.com
+*
+* ----------------------------------------------------------------------------
+* License: This file is published under the license described in LICENSE.md
+*
+*****************************************************************************/
+
+/** @file   bench_ez_queue.c
+ *  @author Hai Nguyen
+ *  @date   18.10.2026
+ *  @brief  Microbenchmark of the queue
+ *
+ *  @details Fills the queue with a burst of elements and drains it, once
+ *  element by element and once with the batch functions, for small elements
+ *  and for elements larger than CONFIG_EZ_QUEUE_ITEM_INLINE_SIZE. The
+ *  benchmark is not run by ctest, build it with CMAKE_BUILD_TYPE=Release to
+ *  get meaningful numbers.
+ *
+ */
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <time.h>
+#include "ez_queue.h"
+
+
+/******************************************************************************
+* Module Preprocessor Macros
+*******************************************************************************/
+#define NUM_OF_ROUND        200000UL
+#define BURST_SIZE          8U
+#define SMALL_ELEMENT_SIZE  8U
+#define LARGE_ELEMENT_SIZE  48U
+
+
+/******************************************************************************
+* Module Typedefs
+*******************************************************************************/
+typedef void (*BenchFunction)(ezQueue *queue, uint32_t element_size);
+
+
+/******************************************************************************
+* Module Variable Definitions
+*******************************************************************************/
+static uint8_t queue_buff[2048];
+static uint8_t element[LARGE_ELEMENT_SIZE];
+static volatile uint32_t sink;
+
+
+/******************************************************************************
+* Function Definitions
+*******************************************************************************/
+static void BenchSingle(ezQueue *queue, uint32_t element_size);
+static void BenchBatch(ezQueue *queue, uint32_t element_size);
+static double MeasureNsPerElement(BenchFunction function, uint32_t element_size);
+static void RunBench(const char *name, BenchFunction function);
+
+
+/******************************************************************************
+* External functions
+*******************************************************************************/
+int main(void)
+{
+    printf("%-28s %10s %10s\n", "operation (ns per element)", "small", "large");
+    RunBench("Push/GetFront/PopFront", BenchSingle);
+    RunBench("PushBatch/PopFrontBatch", BenchBatch);
+
+    return 0;
+}
+
+
+/******************************************************************************
+* Internal functions
+*******************************************************************************/
+static double MeasureNsPerElement(BenchFunction function, uint32_t element_size)
+{
+    ezQueue queue;
+    struct timespec start;
+    struct timespec stop;
+    uint32_t i = 0;
+
+    (void)ezQueue_CreateQueue(&queue, queue_buff, sizeof(queue_buff));
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &start);
+    for(i = 0; i < NUM_OF_ROUND; i++)
+    {
+        function(&queue, element_size);
+    }
+    (void)clock_gettime(CLOCK_MONOTONIC, &stop);
+
+    return ((double)(stop.tv_sec - start.tv_sec) * 1e9 + (double)(stop.tv_nsec - start.tv_nsec))
+           / ((double)NUM_OF_ROUND * BURST_SIZE);
+}
+
+
+static void RunBench(const char *name, BenchFunction function)
+{
+    printf("%-28s %10.2f %10.2f\n", name,
+           MeasureNsPerElement(function, SMALL_ELEMENT_SIZE),
+           MeasureNsPerElement(function, LARGE_ELEMENT_SIZE));
+}
+
+
+static void BenchSingle(ezQueue *queue, uint32_t element_size)
+{
+    uint8_t *data = NULL;
+    uint32_t data_size = 0;
+    uint32_t i = 0;
+
+    for(i = 0; i < BURST_SIZE; i++)
+    {
+        (void)ezQueue_Push(queue, element, element_size);
+    }
+    for(i = 0; i < BURST_SIZE; i++)
+    {
+        (void)ezQueue_GetFront(queue, (void*)&data, &data_size);
+        sink += data[0];
+        (void)ezQueue_PopFront(queue);
+    }
+}
+
+
+static void BenchBatch(ezQueue *queue, uint32_t element_size)
+{
+    void *elements[BURST_SIZE];
+    uint32_t element_sizes[BURST_SIZE];
+    void *data[BURST_SIZE];
+    uint32_t data_size[BURST_SIZE];
+    uint32_t count = 0;
+    uint32_t i = 0;
+
+    for(i = 0; i < BURST_SIZE; i++)
+    {
+        elements[i] = element;
+        element_sizes[i] = element_size;
+    }
+
+    (void)ezQueue_PushBatch(queue, elements, element_sizes, BURST_SIZE);
+    count = ezQueue_GetFrontBatch(queue, data, data_size, BURST_SIZE);
+    for(i = 0; i < count; i++)
+    {
+        sink += ((uint8_t*)data[i])[0];
+    }
+    (void)ezQueue_PopFrontBatch(queue, count);
+}
+
+
+/* End of file */
@@ -35,7 +35,17 @@ TEST_GROUP(ez_queue);
 /******************************************************************************
 * Module Preprocessor Macros
 *******************************************************************************/
+#if (EZ_STATIC_ALLOC_TLSF == 1U) || (EZ_STATIC_ALLOC_INBAND == 1U)
+#define BUFF_SIZE     1024  /**< Leave room for the block headers stored in the buffer */
+#define OVERFLOW_SIZE 800   /**< Element fitting once into the buffer */
+#else
 #define BUFF_SIZE     256   /**< Test buffer size */
+#define OVERFLOW_SIZE 200   /**< Element fitting once into the buffer */
+#endif
+
+#define CAPACITY_BUFF_SIZE      2048    /**< Buffer of the capacity test */
+#define CAPACITY_NUM_OF_ELEM    56      /**< 4-byte elements fitting into it with a global block_pool */
+#define NUM_OF_POOL_ITEM        8       /**< Items in the pool shared by the test queues */
 
 /******************************************************************************
 * Module Typedefs
@@ -52,6 +62,9 @@ static uint8_t item_1[3] = { 1, 2, 3 };
 static uint8_t item_2[6] = { 1, 2, 3 , 4, 5, 6 };
 static uint8_t item_3[10] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 0 };
 static uint8_t item_4[8] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+#if (EZ_QUEUE_ITEM_POOL == 1U)
+EZ_QUEUE_ITEM_POOL_DEFINE(item_pool, NUM_OF_POOL_ITEM);
+#endif /* EZ_QUEUE_ITEM_POOL == 1U */
 
 
 /******************************************************************************
@@ -90,7 +103,25 @@ TEST_GROUP_RUNNER(ez_queue)
     RUN_TEST_CASE(ez_queue, test_GetFrontPop);
     RUN_TEST_CASE(ez_queue, GetBackPop);
     RUN_TEST_CASE(ez_queue, OverflowQueue);
+    RUN_TEST_CASE(ez_queue, FailedPushKeepsCapacity);
     RUN_TEST_CASE(ez_queue, ezQueue_ReserveElement);
+    RUN_TEST_CASE(ez_queue, NumOfByteAndIsEmpty);
+    RUN_TEST_CASE(ez_queue, BatchPushPop);
+#if (EZ_QUEUE_ITEM_POOL == 1U)
+    RUN_TEST_CASE(ez_queue, ItemPool);
+#endif /* EZ_QUEUE_ITEM_POOL == 1U */
+#if (EZ_QUEUE_RING == 0U) && (EZ_STATIC_ALLOC_TLSF == 0U) && (EZ_STATIC_ALLOC_INBAND == 0U)
+    RUN_TEST_CASE(ez_queue, ListEngineCapacity);
+#endif /* EZ_QUEUE_RING == 0U && EZ_STATIC_ALLOC_TLSF == 0U && EZ_STATIC_ALLOC_INBAND == 0U */
+#if (EZ_QUEUE_RING == 1U)
+    RUN_TEST_CASE(ez_queue, RingWrapAround);
+    RUN_TEST_CASE(ez_queue, RingReservationOrder);
+#endif /* EZ_QUEUE_RING == 1U */
+#if (EZ_STATIC_ALLOC_32BIT == 1U)
+    RUN_TEST_CASE(ez_queue, LargeElement);
+#else
+    RUN_TEST_CASE(ez_queue, BufferSizeLimit);
+#endif /* EZ_STATIC_ALLOC_32BIT == 1U */
 }
 
 
@@ -320,7 +351,7 @@ TEST(ez_queue, OverflowQueue)
 {
     ezSTATUS status = ezSUCCESS;
     uint32_t queue_size = 0U;
-    uint8_t overflow_buff[200] = { 0 };
+    uint8_t overflow_buff[OVERFLOW_SIZE] = { 0 };
 
     status = ezQueue_Push(&queue, overflow_buff, sizeof(overflow_buff));
     TEST_ASSERT_EQUAL(ezSUCCESS, status);
@@ -336,6 +367,38 @@ TEST(ez_queue, OverflowQueue)
 }
 
 
+TEST(ez_queue, FailedPushKeepsCapacity)
+{
+    uint32_t i = 0;
+    uint32_t num_of_elem = 0;
+    uint8_t oversized_buff[BUFF_SIZE] = { 0 };
+
+    while (ezQueue_Push(&queue, item_1, sizeof(item_1)) == ezSUCCESS)
+    {
+        num_of_elem++;
+    }
+    TEST_ASSERT_TRUE(num_of_elem > 0U);
+
+    for (i = 0; i < num_of_elem; i++)
+    {
+        TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_PopFront(&queue));
+    }
+
+    /* The data does not fit, the reserved item must be given back */
+    for (i = 0; i < 20U; i++)
+    {
+        TEST_ASSERT_EQUAL(ezFAIL, ezQueue_Push(&queue, oversized_buff, sizeof(oversized_buff)));
+    }
+    TEST_ASSERT_EQUAL(0U, ezQueue_GetNumOfElement(&queue));
+
+    for (i = 0; i < num_of_elem; i++)
+    {
+        TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_Push(&queue, item_1, sizeof(item_1)));
+    }
+    TEST_ASSERT_EQUAL(ezFAIL, ezQueue_Push(&queue, item_1, sizeof(item_1)));
+}
+
+
 TEST(ez_queue, ezQueue_ReserveElement)
 {
     ezSTATUS status = ezSUCCESS;
@@ -414,6 +477,296 @@ TEST(ez_queue, ezQueue_ReserveElement)
     TEST_ASSERT_EQUAL(0, ezQueue_GetNumOfElement(&queue));
 }
 
+TEST(ez_queue, NumOfByteAndIsEmpty)
+{
+    ezReservedElement elem = NULL;
+    uint8_t *data = NULL;
+
+    TEST_ASSERT_TRUE(ezQueue_IsEmpty(&queue));
+    TEST_ASSERT_TRUE(ezQueue_IsEmpty(NULL));
+    TEST_ASSERT_EQUAL(0U, ezQueue_GetNumOfByte(&queue));
+
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_Push(&queue, item_1, sizeof(item_1)));
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_Push(&queue, item_2, sizeof(item_2)));
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_Push(&queue, item_3, sizeof(item_3)));
+    TEST_ASSERT_FALSE(ezQueue_IsEmpty(&queue));
+    TEST_ASSERT_EQUAL(3U, ezQueue_GetNumOfElement(&queue));
+    TEST_ASSERT_EQUAL(sizeof(item_1) + sizeof(item_2) + sizeof(item_3), ezQueue_GetNumOfByte(&queue));
+
+    /* Reserved elements are only counted once pushed */
+    elem = ezQueue_ReserveElement(&queue, (void*)&data, sizeof(item_4));
+    TEST_ASSERT_NOT_NULL(elem);
+    TEST_ASSERT_EQUAL(3U, ezQueue_GetNumOfElement(&queue));
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_ReleaseReservedElement(&queue, elem));
+    TEST_ASSERT_EQUAL(3U, ezQueue_GetNumOfElement(&queue));
+
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_PopBack(&queue));
+    TEST_ASSERT_EQUAL(sizeof(item_1) + sizeof(item_2), ezQueue_GetNumOfByte(&queue));
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_PopFront(&queue));
+    TEST_ASSERT_EQUAL(sizeof(item_2), ezQueue_GetNumOfByte(&queue));
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_PopFront(&queue));
+    TEST_ASSERT_EQUAL(0U, ezQueue_GetNumOfByte(&queue));
+    TEST_ASSERT_TRUE(ezQueue_IsEmpty(&queue));
+}
+
+
+TEST(ez_queue, BatchPushPop)
+{
+    void *items[] = { item_1, item_2, item_3, item_4 };
+    uint32_t item_sizes[] = { sizeof(item_1), sizeof(item_2), sizeof(item_3), sizeof(item_4) };
+    uint8_t overflow_buff[OVERFLOW_SIZE] = { 0 };
+    void *overflow_items[] = { overflow_buff, overflow_buff };
+    uint32_t overflow_sizes[] = { sizeof(overflow_buff), sizeof(overflow_buff) };
+    void *data[4] = { NULL };
+    uint32_t data_size[4] = { 0 };
+    uint32_t i = 0;
+
+    TEST_ASSERT_EQUAL(0U, ezQueue_PushBatch(NULL, items, item_sizes, 4U));
+    TEST_ASSERT_EQUAL(4U, ezQueue_PushBatch(&queue, items, item_sizes, 4U));
+    TEST_ASSERT_EQUAL(4U, ezQueue_GetNumOfElement(&queue));
+
+    /* Elements are accessed in place, the queue is unchanged */
+    TEST_ASSERT_EQUAL(3U, ezQueue_GetFrontBatch(&queue, data, data_size, 3U));
+    for (i = 0; i < 3U; i++)
+    {
+        TEST_ASSERT_EQUAL(item_sizes[i], data_size[i]);
+        TEST_ASSERT_EQUAL_MEMORY(items[i], data[i], item_sizes[i]);
+    }
+    TEST_ASSERT_EQUAL(4U, ezQueue_GetNumOfElement(&queue));
+
+    TEST_ASSERT_EQUAL(3U, ezQueue_PopFrontBatch(&queue, 3U));
+    TEST_ASSERT_EQUAL(1U, ezQueue_GetFrontBatch(&queue, data, data_size, 4U));
+    TEST_ASSERT_EQUAL_MEMORY(item_4, data[0], sizeof(item_4));
+
+    /* Popping more than available empties the queue */
+    TEST_ASSERT_EQUAL(1U, ezQueue_PopFrontBatch(&queue, 4U));
+    TEST_ASSERT_TRUE(ezQueue_IsEmpty(&queue));
+    TEST_ASSERT_EQUAL(0U, ezQueue_GetNumOfByte(&queue));
+
+    /* Pushing stops at the first element whose data is NULL */
+    items[2] = NULL;
+    TEST_ASSERT_EQUAL(2U, ezQueue_PushBatch(&queue, items, item_sizes, 4U));
+    TEST_ASSERT_EQUAL(2U, ezQueue_GetNumOfElement(&queue));
+    TEST_ASSERT_EQUAL(2U, ezQueue_PopFrontBatch(&queue, 2U));
+
+    /* Pushing stops at the first element which does not fit */
+    TEST_ASSERT_EQUAL(1U, ezQueue_PushBatch(&queue, overflow_items, overflow_sizes, 2U));
+    TEST_ASSERT_EQUAL(1U, ezQueue_GetNumOfElement(&queue));
+}
+
+
+#if (EZ_QUEUE_ITEM_POOL == 1U)
+TEST(ez_queue, ItemPool)
+{
+    static ezQueue other_queue;
+    static uint8_t other_buff[BUFF_SIZE];
+    uint32_t i = 0;
+    uint32_t data_size = 0;
+    uint8_t *data = NULL;
+    uint8_t large_item[CONFIG_EZ_QUEUE_ITEM_INLINE_SIZE + 1] = { 0 };
+
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_CreateQueue(&other_queue, other_buff, BUFF_SIZE));
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_SetItemPool(&queue, &item_pool));
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_SetItemPool(&other_queue, &item_pool));
+
+    /* Small elements of both queues are stored in the items of the pool */
+    for (i = 0; i < NUM_OF_POOL_ITEM / 2U; i++)
+    {
+        TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_Push(&queue, item_3, sizeof(item_3)));
+        TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_Push(&other_queue, item_2, sizeof(item_2)));
+    }
+    TEST_ASSERT_EQUAL(0U, ezStaticAlloc_GetNumOfAllocBlock(&queue.mem_list));
+    TEST_ASSERT_EQUAL(0U, ezStaticAlloc_GetNumOfAllocBlock(&other_queue.mem_list));
+    TEST_ASSERT_EQUAL(0U, ezObjPool_GetNumOfFreeObj(&item_pool));
+
+    /* The pool cannot be changed while the queue holds its items */
+    TEST_ASSERT_EQUAL(ezFAIL, ezQueue_SetItemPool(&queue, NULL));
+
+    /* Pool is empty, the item comes from the buffer */
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_Push(&queue, item_1, sizeof(item_1)));
+    TEST_ASSERT_EQUAL(2U, ezStaticAlloc_GetNumOfAllocBlock(&queue.mem_list));
+
+    for (i = 0; i < NUM_OF_POOL_ITEM / 2U; i++)
+    {
+        TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_GetFront(&queue, (void*)&data, &data_size));
+        TEST_ASSERT_EQUAL(sizeof(item_3), data_size);
+        TEST_ASSERT_EQUAL_MEMORY(item_3, data, sizeof(item_3));
+        TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_PopFront(&queue));
+
+        TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_GetFront(&other_queue, (void*)&data, &data_size));
+        TEST_ASSERT_EQUAL(sizeof(item_2), data_size);
+        TEST_ASSERT_EQUAL_MEMORY(item_2, data, sizeof(item_2));
+        TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_PopFront(&other_queue));
+    }
+    TEST_ASSERT_EQUAL(NUM_OF_POOL_ITEM, ezObjPool_GetNumOfFreeObj(&item_pool));
+
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_GetFront(&queue, (void*)&data, &data_size));
+    TEST_ASSERT_EQUAL_MEMORY(item_1, data, sizeof(item_1));
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_PopFront(&queue));
+    TEST_ASSERT_EQUAL(0U, ezStaticAlloc_GetNumOfAllocBlock(&queue.mem_list));
+
+    /* Large data is allocated from the buffer */
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_Push(&queue, large_item, sizeof(large_item)));
+    TEST_ASSERT_EQUAL(1U, ezStaticAlloc_GetNumOfAllocBlock(&queue.mem_list));
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_PopBack(&queue));
+    TEST_ASSERT_EQUAL(0U, ezStaticAlloc_GetNumOfAllocBlock(&queue.mem_list));
+
+    /* Without a pool the items come from the buffer again */
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_SetItemPool(&queue, NULL));
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_Push(&queue, item_1, sizeof(item_1)));
+    TEST_ASSERT_EQUAL(2U, ezStaticAlloc_GetNumOfAllocBlock(&queue.mem_list));
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_PopBack(&queue));
+}
+#endif /* EZ_QUEUE_ITEM_POOL == 1U */
+
+
+#if (EZ_QUEUE_RING == 0U) && (EZ_STATIC_ALLOC_TLSF == 0U) && (EZ_STATIC_ALLOC_INBAND == 0U)
+TEST(ez_queue, ListEngineCapacity)
+{
+    static ezQueue capacity_queue;
+    static uint8_t capacity_buff[CAPACITY_BUFF_SIZE];
+    uint32_t element = 0;
+    uint32_t num_of_elem = 0;
+
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_CreateQueue(&capacity_queue, capacity_buff, CAPACITY_BUFF_SIZE));
+
+    /* Block headers must not run out before the buffer */
+    while (num_of_elem < CAPACITY_BUFF_SIZE
+           && ezQueue_Push(&capacity_queue, &element, sizeof(element)) == ezSUCCESS)
+    {
+        element++;
+        num_of_elem++;
+    }
+    TEST_ASSERT_TRUE(num_of_elem >= CAPACITY_NUM_OF_ELEM);
+    TEST_ASSERT_EQUAL(num_of_elem, ezQueue_GetNumOfElement(&capacity_queue));
+
+    element = 0;
+    while (ezQueue_IsEmpty(&capacity_queue) == false)
+    {
+        TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_PopFront(&capacity_queue));
+        element++;
+    }
+    TEST_ASSERT_EQUAL(num_of_elem, element);
+}
+#endif /* EZ_QUEUE_RING == 0U && EZ_STATIC_ALLOC_TLSF == 0U && EZ_STATIC_ALLOC_INBAND == 0U */
+
+
+#if (EZ_QUEUE_RING == 1U)
+TEST(ez_queue, RingWrapAround)
+{
+    uint8_t elem_a[BUFF_SIZE / 3] = { 0 };
+    uint8_t elem_b[BUFF_SIZE / 3] = { 0 };
+    uint8_t elem_c[BUFF_SIZE / 3] = { 0 };
+    uint8_t *data = NULL;
+    uint32_t data_size = 0;
+
+    memset(elem_a, 0xA, sizeof(elem_a));
+    memset(elem_b, 0xB, sizeof(elem_b));
+    memset(elem_c, 0xC, sizeof(elem_c));
+
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_Push(&queue, elem_a, sizeof(elem_a)));
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_Push(&queue, elem_b, sizeof(elem_b)));
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_PopFront(&queue));
+
+    /* Does not fit before the end of the buffer, placed at its start */
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_Push(&queue, elem_c, sizeof(elem_c)));
+    TEST_ASSERT_EQUAL(2, ezQueue_GetNumOfElement(&queue));
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_GetBack(&queue, (void*)&data, &data_size));
+    TEST_ASSERT_TRUE(data < queue.buff + BUFF_SIZE / 3);
+
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_GetFront(&queue, (void*)&data, &data_size));
+    TEST_ASSERT_EQUAL(sizeof(elem_b), data_size);
+    TEST_ASSERT_EQUAL_MEMORY(elem_b, data, sizeof(elem_b));
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_PopFront(&queue));
+
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_GetFront(&queue, (void*)&data, &data_size));
+    TEST_ASSERT_EQUAL(sizeof(elem_c), data_size);
+    TEST_ASSERT_EQUAL_MEMORY(elem_c, data, sizeof(elem_c));
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_PopFront(&queue));
+    TEST_ASSERT_EQUAL(0, ezQueue_GetNumOfElement(&queue));
+    TEST_ASSERT_EQUAL(0U, queue.used_bytes);
+}
+
+
+TEST(ez_queue, RingReservationOrder)
+{
+    ezReservedElement elem1 = NULL;
+    ezReservedElement elem2 = NULL;
+    ezReservedElement elem3 = NULL;
+    uint8_t *data1 = NULL;
+    uint8_t *data2 = NULL;
+    uint8_t *data3 = NULL;
+    uint8_t *data = NULL;
+    uint32_t data_size = 0;
+    uint32_t used_bytes = 0;
+
+    elem1 = ezQueue_ReserveElement(&queue, (void*)&data1, 4U);
+    elem2 = ezQueue_ReserveElement(&queue, (void*)&data2, 4U);
+    TEST_ASSERT_NOT_NULL(elem1);
+    TEST_ASSERT_NOT_NULL(elem2);
+    memset(data1, 1, 4U);
+    memset(data2, 2, 4U);
+
+    /* Elements become visible in the order they were reserved */
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_PushReservedElement(&queue, elem2));
+    TEST_ASSERT_EQUAL(0, ezQueue_GetNumOfElement(&queue));
+    TEST_ASSERT_EQUAL(ezFAIL, ezQueue_PushReservedElement(&queue, elem2));
+
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_PushReservedElement(&queue, elem1));
+    TEST_ASSERT_EQUAL(2, ezQueue_GetNumOfElement(&queue));
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_GetFront(&queue, (void*)&data, &data_size));
+    TEST_ASSERT_EQUAL_PTR(data1, data);
+
+    /* Releasing the last reservation gives its memory back at once */
+    used_bytes = queue.used_bytes;
+    elem3 = ezQueue_ReserveElement(&queue, (void*)&data3, 16U);
+    TEST_ASSERT_NOT_NULL(elem3);
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_ReleaseReservedElement(&queue, elem3));
+    TEST_ASSERT_EQUAL(used_bytes, queue.used_bytes);
+    TEST_ASSERT_EQUAL(2, ezQueue_GetNumOfElement(&queue));
+
+    /* Popping the back element rewinds the ring as well */
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_PopBack(&queue));
+    TEST_ASSERT_EQUAL(1, ezQueue_GetNumOfElement(&queue));
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_GetBack(&queue, (void*)&data, &data_size));
+    TEST_ASSERT_EQUAL_PTR(data1, data);
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_PopFront(&queue));
+    TEST_ASSERT_EQUAL(0U, queue.used_bytes);
+}
+#endif /* EZ_QUEUE_RING == 1U */
+
+
+#if (EZ_STATIC_ALLOC_32BIT == 1U)
+TEST(ez_queue, LargeElement)
+{
+    static uint8_t large_queue_buff[128 * 1024];
+    static uint8_t large_item[70000];
+    ezQueue large_queue;
+    uint8_t *data = NULL;
+    uint32_t data_size = 0;
+
+    memset(large_item, 0x5A, sizeof(large_item));
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_CreateQueue(&large_queue, large_queue_buff, sizeof(large_queue_buff)));
+
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_Push(&large_queue, large_item, sizeof(large_item)));
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_GetFront(&large_queue, (void*)&data, &data_size));
+    TEST_ASSERT_EQUAL(sizeof(large_item), data_size);
+    TEST_ASSERT_EQUAL_MEMORY(large_item, data, sizeof(large_item));
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_PopFront(&large_queue));
+}
+#else
+TEST(ez_queue, BufferSizeLimit)
+{
+    ezQueue large_queue;
+    uint8_t *data = NULL;
+
+    /* Sizes the memory list can not represent are rejected, not truncated */
+    TEST_ASSERT_EQUAL(ezFAIL, ezQueue_CreateQueue(&large_queue, queue_buff, EZ_STATIC_ALLOC_SIZE_MAX + 1UL));
+    TEST_ASSERT_NULL(ezQueue_ReserveElement(&queue, (void*)&data, EZ_STATIC_ALLOC_SIZE_MAX + 1UL));
+}
+#endif /* EZ_STATIC_ALLOC_32BIT == 1U */
+
+
 /******************************************************************************
 * Internal functions
 *******************************************************************************/
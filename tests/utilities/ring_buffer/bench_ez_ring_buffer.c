@@ -0,0 +1,186 @@
+/*****************************************************************************
+* Filename:         bench_ez_ring_buffer.c
+* Author:           Hai Nguyen
+* Original Date:    18.10.2026
+*
+* ----------------------------------------------------------------------------
+* Contact:          Hai Nguyen
+*                   hainguyen.eeit@gmail.com
+*
+* ----------------------------------------------------------------------------
+* License: This file is published under the license described in LICENSE.md
+*
+*****************************************************************************/
+
+/** @file   bench_ez_ring_buffer.c
+ *  @author Hai Nguyen
+ *  @date   18.10.2026
+ *  @brief  Microbenchmark of the ring buffer
+ *
+ *  @details Compares ezRingBuffer_Push/Pop of one byte and of four bytes
+ *  with the inline byte and word functions, for a capacity which is a power
+ *  of two and one which is not. The benchmark is not run by ctest, build
+ *  it with CMAKE_BUILD_TYPE=Release to get meaningful numbers.
+ *
+ */
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <time.h>
+#include "ez_ring_buffer.h"
+
+
+/******************************************************************************
+* Module Preprocessor Macros
+*******************************************************************************/
+#define NUM_OF_ROUND        2000000UL
+#define BURST_SIZE          32U
+
+
+/******************************************************************************
+* Module Typedefs
+*******************************************************************************/
+typedef void (*BenchFunction)(RingBuffer *ring_buff);
+
+
+/******************************************************************************
+* Module Variable Definitions
+*******************************************************************************/
+static uint8_t buff_pow2[1024];
+static uint8_t buff_other[1000];
+static volatile uint32_t sink;
+
+
+/******************************************************************************
+* Function Definitions
+*******************************************************************************/
+static void BenchPushPopByte(RingBuffer *ring_buff);
+static void BenchPushPopByteInline(RingBuffer *ring_buff);
+static void BenchPushPopWord(RingBuffer *ring_buff);
+static void BenchPushPopWordInline(RingBuffer *ring_buff);
+static double MeasureNsPerByte(BenchFunction function, uint8_t *buff, ezRingBufferSize size,
+                               uint32_t byte_per_round);
+static void RunBench(const char *name, BenchFunction function, uint32_t byte_per_round);
+
+
+/******************************************************************************
+* External functions
+*******************************************************************************/
+int main(void)
+{
+    printf("%-28s %10s %10s\n", "operation (ns per byte)", "cap 1024", "cap 1000");
+    RunBench("Push/Pop 1 byte", BenchPushPopByte, BURST_SIZE);
+    RunBench("PushByte/PopByte", BenchPushPopByteInline, BURST_SIZE);
+    RunBench("Push/Pop 4 bytes", BenchPushPopWord, BURST_SIZE * sizeof(uint32_t));
+    RunBench("PushWord/PopWord", BenchPushPopWordInline, BURST_SIZE * sizeof(uint32_t));
+
+    return 0;
+}
+
+
+/******************************************************************************
+* Internal functions
+*******************************************************************************/
+static double MeasureNsPerByte(BenchFunction function, uint8_t *buff, ezRingBufferSize size,
+                               uint32_t byte_per_round)
+{
+    RingBuffer ring_buff;
+    struct timespec start;
+    struct timespec stop;
+    uint32_t i = 0;
+
+    (void)ezRingBuffer_Init(&ring_buff, buff, size);
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &start);
+    for(i = 0; i < NUM_OF_ROUND; i++)
+    {
+        function(&ring_buff);
+    }
+    (void)clock_gettime(CLOCK_MONOTONIC, &stop);
+
+    return ((double)(stop.tv_sec - start.tv_sec) * 1e9 + (double)(stop.tv_nsec - start.tv_nsec))
+           / ((double)NUM_OF_ROUND * byte_per_round);
+}
+
+
+static void RunBench(const char *name, BenchFunction function, uint32_t byte_per_round)
+{
+    printf("%-28s %10.2f %10.2f\n", name,
+           MeasureNsPerByte(function, buff_pow2, sizeof(buff_pow2), byte_per_round),
+           MeasureNsPerByte(function, buff_other, sizeof(buff_other), byte_per_round));
+}
+
+
+static void BenchPushPopByte(RingBuffer *ring_buff)
+{
+    uint8_t byte = 0;
+    uint8_t i = 0;
+
+    for(i = 0; i < BURST_SIZE; i++)
+    {
+        (void)ezRingBuffer_Push(ring_buff, &i, 1U);
+    }
+    for(i = 0; i < BURST_SIZE; i++)
+    {
+        (void)ezRingBuffer_Pop(ring_buff, &byte, 1U);
+        sink += byte;
+    }
+}
+
+
+static void BenchPushPopByteInline(RingBuffer *ring_buff)
+{
+    uint8_t byte = 0;
+    uint8_t i = 0;
+
+    for(i = 0; i < BURST_SIZE; i++)
+    {
+        (void)ezRingBuffer_PushByte(ring_buff, i);
+    }
+    for(i = 0; i < BURST_SIZE; i++)
+    {
+        (void)ezRingBuffer_PopByte(ring_buff, &byte);
+        sink += byte;
+    }
+}
+
+
+static void BenchPushPopWord(RingBuffer *ring_buff)
+{
+    uint32_t word = 0;
+    uint32_t i = 0;
+
+    for(i = 0; i < BURST_SIZE; i++)
+    {
+        (void)ezRingBuffer_Push(ring_buff, (uint8_t*)&i, sizeof(i));
+    }
+    for(i = 0; i < BURST_SIZE; i++)
+    {
+        (void)ezRingBuffer_Pop(ring_buff, (uint8_t*)&word, sizeof(word));
+        sink += word;
+    }
+}
+
+
+static void BenchPushPopWordInline(RingBuffer *ring_buff)
+{
+    uint32_t word = 0;
+    uint32_t i = 0;
+
+    for(i = 0; i < BURST_SIZE; i++)
+    {
+        (void)ezRingBuffer_PushWord(ring_buff, i);
+    }
+    for(i = 0; i < BURST_SIZE; i++)
+    {
+        (void)ezRingBuffer_PopWord(ring_buff, &word);
+        sink += word;
+    }
+}
+
+
+/* End of file */
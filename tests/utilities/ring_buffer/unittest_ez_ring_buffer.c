@@ -26,6 +26,7 @@
 *******************************************************************************/
 #include <stdint.h>
 #include <stdbool.h>
+#include <string.h>
 #include "unity.h"
 #include "unity_fixture.h"
 #include "ez_ring_buffer.h"
@@ -36,6 +37,7 @@ TEST_GROUP(ez_ring_buffer);
 * Module Preprocessor Macros
 *******************************************************************************/
 #define BUFF_SIZE 10
+#define RECORD_BUFF_SIZE (6 + 2 * EZ_RING_BUFFER_RECORD_HEADER_SIZE)
 
 
 /******************************************************************************
@@ -48,6 +50,7 @@ TEST_GROUP(ez_ring_buffer);
 * Module Variable Definitions
 *******************************************************************************/
 static uint8_t au8TestBuffer[BUFF_SIZE] = { 0 };
+static uint8_t au8RecordBuffer[RECORD_BUFF_SIZE] = { 0 };
 static RingBuffer r_buff;
 
 
@@ -82,6 +85,16 @@ TEST_GROUP_RUNNER(ez_ring_buffer)
     RUN_TEST_CASE(ez_ring_buffer, Pop);
     RUN_TEST_CASE(ez_ring_buffer, wrapping_point_push);
     RUN_TEST_CASE(ez_ring_buffer, wrapping_point_pop);
+    RUN_TEST_CASE(ez_ring_buffer, peek_consume);
+    RUN_TEST_CASE(ez_ring_buffer, claim_commit);
+    RUN_TEST_CASE(ez_ring_buffer, push_pop_byte);
+    RUN_TEST_CASE(ez_ring_buffer, push_pop_word);
+    RUN_TEST_CASE(ez_ring_buffer, push_overwrite);
+    RUN_TEST_CASE(ez_ring_buffer, push_pop_record);
+    RUN_TEST_CASE(ez_ring_buffer, push_record_overwrite);
+#if (EZ_RING_BUFFER_32BIT == 1U)
+    RUN_TEST_CASE(ez_ring_buffer, large_capacity);
+#endif /* EZ_RING_BUFFER_32BIT == 1U */
 }
 
 
@@ -247,6 +260,270 @@ TEST(ez_ring_buffer, wrapping_point_pop)
 }
 
 
+TEST(ez_ring_buffer, peek_consume)
+{
+    ezRingBufferSpan spans[2];
+    uint8_t push_10[BUFF_SIZE] = { 0,1,2,3,4,5,6,7,8,9 };
+    uint8_t pop_5[5];
+
+    TEST_ASSERT_TRUE(ezRingBuffer_Init(&r_buff, au8TestBuffer, BUFF_SIZE));
+    TEST_ASSERT_EQUAL(0, ezRingBuffer_Peek(&r_buff, spans));
+    TEST_ASSERT_NULL(spans[0].data);
+    TEST_ASSERT_EQUAL(0, spans[1].size);
+
+    TEST_ASSERT_EQUAL(10, ezRingBuffer_Push(&r_buff, push_10, 10));
+    TEST_ASSERT_EQUAL(5, ezRingBuffer_Pop(&r_buff, pop_5, 5));
+    TEST_ASSERT_EQUAL(3, ezRingBuffer_Push(&r_buff, push_10, 3));
+
+    /* Data 5..9 lies at the end of the buffer, 0..2 at the beginning */
+    TEST_ASSERT_EQUAL(8, ezRingBuffer_Peek(&r_buff, spans));
+    TEST_ASSERT_EQUAL_PTR(&au8TestBuffer[5], spans[0].data);
+    TEST_ASSERT_EQUAL(5, spans[0].size);
+    TEST_ASSERT_EQUAL_MEMORY(&push_10[5], spans[0].data, 5);
+    TEST_ASSERT_EQUAL_PTR(au8TestBuffer, spans[1].data);
+    TEST_ASSERT_EQUAL(3, spans[1].size);
+    TEST_ASSERT_EQUAL_MEMORY(push_10, spans[1].data, 3);
+
+    TEST_ASSERT_EQUAL(6, ezRingBuffer_Consume(&r_buff, 6));
+    TEST_ASSERT_EQUAL(2, ezRingBuffer_Peek(&r_buff, spans));
+    TEST_ASSERT_EQUAL_PTR(&au8TestBuffer[1], spans[0].data);
+    TEST_ASSERT_EQUAL(2, spans[0].size);
+    TEST_ASSERT_EQUAL(0, spans[1].size);
+
+    /* Consuming more than stored only drops the stored data */
+    TEST_ASSERT_EQUAL(2, ezRingBuffer_Consume(&r_buff, 5));
+    TEST_ASSERT_TRUE(ezRingBuffer_IsEmpty(&r_buff));
+}
+
+
+TEST(ez_ring_buffer, claim_commit)
+{
+    ezRingBufferSpan spans[2];
+    uint8_t push_10[BUFF_SIZE] = { 0,1,2,3,4,5,6,7,8,9 };
+    uint8_t pop_10[BUFF_SIZE];
+
+    TEST_ASSERT_TRUE(ezRingBuffer_Init(&r_buff, au8TestBuffer, BUFF_SIZE));
+    TEST_ASSERT_EQUAL(6, ezRingBuffer_Push(&r_buff, push_10, 6));
+    TEST_ASSERT_EQUAL(4, ezRingBuffer_Pop(&r_buff, pop_10, 4));
+
+    /* Free memory is 6..9 followed by 0..3 */
+    TEST_ASSERT_EQUAL(8, ezRingBuffer_Claim(&r_buff, spans));
+    TEST_ASSERT_EQUAL_PTR(&au8TestBuffer[6], spans[0].data);
+    TEST_ASSERT_EQUAL(4, spans[0].size);
+    TEST_ASSERT_EQUAL_PTR(au8TestBuffer, spans[1].data);
+    TEST_ASSERT_EQUAL(4, spans[1].size);
+
+    memcpy(spans[0].data, &push_10[6], spans[0].size);
+    memcpy(spans[1].data, push_10, 2);
+    TEST_ASSERT_EQUAL(6, ezRingBuffer_Commit(&r_buff, 6));
+
+    TEST_ASSERT_EQUAL(8, ezRingBuffer_Pop(&r_buff, pop_10, BUFF_SIZE));
+    TEST_ASSERT_EQUAL_MEMORY(&push_10[4], pop_10, 6);
+    TEST_ASSERT_EQUAL_MEMORY(push_10, &pop_10[6], 2);
+
+    /* Committing more than the free memory only stores what fits */
+    TEST_ASSERT_EQUAL(BUFF_SIZE, ezRingBuffer_Commit(&r_buff, BUFF_SIZE + 3));
+    TEST_ASSERT_TRUE(ezRingBuffer_IsFull(&r_buff));
+    TEST_ASSERT_EQUAL(0, ezRingBuffer_Claim(&r_buff, spans));
+    TEST_ASSERT_NULL(spans[0].data);
+}
+
+
+TEST(ez_ring_buffer, push_pop_byte)
+{
+    static uint8_t buff_8[8];
+    uint8_t byte = 0;
+    uint8_t i = 0;
+
+    /* Masked indexes with 8 bytes, compared indexes with 10 bytes */
+    TEST_ASSERT_TRUE(ezRingBuffer_Init(&r_buff, buff_8, sizeof(buff_8)));
+    TEST_ASSERT_EQUAL(7, r_buff.mask);
+    TEST_ASSERT_TRUE(ezRingBuffer_Init(&r_buff, au8TestBuffer, BUFF_SIZE));
+    TEST_ASSERT_EQUAL(0, r_buff.mask);
+
+    TEST_ASSERT_FALSE(ezRingBuffer_PopByte(&r_buff, &byte));
+
+    /* Go around the buffer twice, with both index modes */
+    for(i = 0; i < 2 * BUFF_SIZE; i++)
+    {
+        TEST_ASSERT_TRUE(ezRingBuffer_PushByte(&r_buff, i));
+        TEST_ASSERT_TRUE(ezRingBuffer_PopByte(&r_buff, &byte));
+        TEST_ASSERT_EQUAL(i, byte);
+    }
+
+    TEST_ASSERT_TRUE(ezRingBuffer_Init(&r_buff, buff_8, sizeof(buff_8)));
+    for(i = 0; i < sizeof(buff_8); i++)
+    {
+        TEST_ASSERT_TRUE(ezRingBuffer_PushByte(&r_buff, i));
+    }
+    TEST_ASSERT_FALSE(ezRingBuffer_PushByte(&r_buff, 0xFF));
+
+    for(i = 0; i < 3 * sizeof(buff_8); i++)
+    {
+        TEST_ASSERT_TRUE(ezRingBuffer_PopByte(&r_buff, &byte));
+        TEST_ASSERT_EQUAL(i, byte);
+        TEST_ASSERT_TRUE(ezRingBuffer_PushByte(&r_buff, i + sizeof(buff_8)));
+    }
+    TEST_ASSERT_TRUE(ezRingBuffer_IsFull(&r_buff));
+}
+
+
+TEST(ez_ring_buffer, push_pop_word)
+{
+    static uint8_t buff_16[16];
+    uint32_t word = 0;
+    uint32_t i = 0;
+
+    TEST_ASSERT_TRUE(ezRingBuffer_Init(&r_buff, au8TestBuffer, BUFF_SIZE));
+    TEST_ASSERT_FALSE(ezRingBuffer_PopWord(&r_buff, &word));
+
+    /* 10 is not a multiple of 4, so the words wrap at every position */
+    for(i = 0; i < 10; i++)
+    {
+        TEST_ASSERT_TRUE(ezRingBuffer_PushWord(&r_buff, 0x01020304U * i));
+        TEST_ASSERT_TRUE(ezRingBuffer_PopWord(&r_buff, &word));
+        TEST_ASSERT_EQUAL_HEX32(0x01020304U * i, word);
+        TEST_ASSERT_TRUE(ezRingBuffer_PushByte(&r_buff, 0xAA));
+        TEST_ASSERT_EQUAL(1, ezRingBuffer_Consume(&r_buff, 1));
+    }
+
+    TEST_ASSERT_TRUE(ezRingBuffer_PushWord(&r_buff, 1U));
+    TEST_ASSERT_TRUE(ezRingBuffer_PushWord(&r_buff, 2U));
+    TEST_ASSERT_FALSE(ezRingBuffer_PushWord(&r_buff, 3U));
+    TEST_ASSERT_EQUAL(8, r_buff.written_byte_count);
+
+    /* Masked indexes, the words are not aligned to the buffer end */
+    TEST_ASSERT_TRUE(ezRingBuffer_Init(&r_buff, buff_16, sizeof(buff_16)));
+    TEST_ASSERT_TRUE(ezRingBuffer_PushByte(&r_buff, 0x55));
+    TEST_ASSERT_TRUE(ezRingBuffer_PopByte(&r_buff, buff_16));
+    for(i = 0; i < 12; i++)
+    {
+        TEST_ASSERT_TRUE(ezRingBuffer_PushWord(&r_buff, 0xA0B0C0D0U + i));
+        TEST_ASSERT_TRUE(ezRingBuffer_PushWord(&r_buff, i));
+        TEST_ASSERT_TRUE(ezRingBuffer_PopWord(&r_buff, &word));
+        TEST_ASSERT_EQUAL_HEX32(0xA0B0C0D0U + i, word);
+        TEST_ASSERT_TRUE(ezRingBuffer_PopWord(&r_buff, &word));
+        TEST_ASSERT_EQUAL_HEX32(i, word);
+    }
+    TEST_ASSERT_TRUE(ezRingBuffer_IsEmpty(&r_buff));
+}
+
+
+TEST(ez_ring_buffer, push_overwrite)
+{
+    uint8_t push_10[BUFF_SIZE] = { 0,1,2,3,4,5,6,7,8,9 };
+    uint8_t push_15[15] = { 0,1,2,3,4,5,6,7,8,9,10,11,12,13,14 };
+    uint8_t pop_10[BUFF_SIZE];
+
+    TEST_ASSERT_TRUE(ezRingBuffer_Init(&r_buff, au8TestBuffer, BUFF_SIZE));
+    TEST_ASSERT_EQUAL(7, ezRingBuffer_PushOverwrite(&r_buff, push_10, 7));
+
+    /* 3 bytes fit, the 3 oldest ones are dropped */
+    TEST_ASSERT_EQUAL(6, ezRingBuffer_PushOverwrite(&r_buff, &push_10[4], 6));
+    TEST_ASSERT_TRUE(ezRingBuffer_IsFull(&r_buff));
+    TEST_ASSERT_EQUAL(BUFF_SIZE, ezRingBuffer_Pop(&r_buff, pop_10, BUFF_SIZE));
+    TEST_ASSERT_EQUAL_MEMORY(&push_10[3], pop_10, 4);
+    TEST_ASSERT_EQUAL_MEMORY(&push_10[4], &pop_10[4], 6);
+
+    /* Data larger than the buffer keeps its newest part */
+    TEST_ASSERT_EQUAL(3, ezRingBuffer_Push(&r_buff, push_10, 3));
+    TEST_ASSERT_EQUAL(BUFF_SIZE, ezRingBuffer_PushOverwrite(&r_buff, push_15, sizeof(push_15)));
+    TEST_ASSERT_EQUAL(BUFF_SIZE, ezRingBuffer_Pop(&r_buff, pop_10, BUFF_SIZE));
+    TEST_ASSERT_EQUAL_MEMORY(&push_15[5], pop_10, BUFF_SIZE);
+}
+
+
+TEST(ez_ring_buffer, push_pop_record)
+{
+    uint8_t record_3[3] = { 1,2,3 };
+    uint8_t record_2[2] = { 4,5 };
+    uint8_t pop_buff[RECORD_BUFF_SIZE];
+    uint8_t i = 0;
+
+    TEST_ASSERT_TRUE(ezRingBuffer_Init(&r_buff, au8RecordBuffer, RECORD_BUFF_SIZE));
+    TEST_ASSERT_EQUAL(0, ezRingBuffer_GetRecordSize(&r_buff));
+    TEST_ASSERT_EQUAL(0, ezRingBuffer_PopRecord(&r_buff, pop_buff, RECORD_BUFF_SIZE));
+    TEST_ASSERT_FALSE(ezRingBuffer_PushRecord(&r_buff, record_3, 0, false));
+    TEST_ASSERT_FALSE(ezRingBuffer_PushRecord(&r_buff, pop_buff,
+                      RECORD_BUFF_SIZE - EZ_RING_BUFFER_RECORD_HEADER_SIZE + 1, false));
+
+    /* Records are pushed completely or not at all */
+    TEST_ASSERT_TRUE(ezRingBuffer_PushRecord(&r_buff, record_3, sizeof(record_3), false));
+    TEST_ASSERT_TRUE(ezRingBuffer_PushRecord(&r_buff, record_2, sizeof(record_2), false));
+    TEST_ASSERT_FALSE(ezRingBuffer_PushRecord(&r_buff, record_3, sizeof(record_3), false));
+    TEST_ASSERT_EQUAL(sizeof(record_3) + sizeof(record_2) + 2 * EZ_RING_BUFFER_RECORD_HEADER_SIZE,
+                      r_buff.written_byte_count);
+
+    /* A too small buffer leaves the record in place */
+    TEST_ASSERT_EQUAL(sizeof(record_3), ezRingBuffer_GetRecordSize(&r_buff));
+    TEST_ASSERT_EQUAL(0, ezRingBuffer_PopRecord(&r_buff, pop_buff, 2));
+    TEST_ASSERT_EQUAL(sizeof(record_3), ezRingBuffer_PopRecord(&r_buff, pop_buff, RECORD_BUFF_SIZE));
+    TEST_ASSERT_EQUAL_MEMORY(record_3, pop_buff, sizeof(record_3));
+    TEST_ASSERT_EQUAL(sizeof(record_2), ezRingBuffer_PopRecord(&r_buff, pop_buff, RECORD_BUFF_SIZE));
+    TEST_ASSERT_EQUAL_MEMORY(record_2, pop_buff, sizeof(record_2));
+    TEST_ASSERT_TRUE(ezRingBuffer_IsEmpty(&r_buff));
+
+    /* Records and their headers wrap at every position */
+    for(i = 0; i < RECORD_BUFF_SIZE; i++)
+    {
+        TEST_ASSERT_TRUE(ezRingBuffer_PushRecord(&r_buff, record_3, sizeof(record_3), false));
+        TEST_ASSERT_EQUAL(sizeof(record_3), ezRingBuffer_PopRecord(&r_buff, pop_buff, RECORD_BUFF_SIZE));
+        TEST_ASSERT_EQUAL_MEMORY(record_3, pop_buff, sizeof(record_3));
+    }
+}
+
+
+TEST(ez_ring_buffer, push_record_overwrite)
+{
+    uint8_t record_3[3] = { 1,2,3 };
+    uint8_t record_2[2] = { 4,5 };
+    uint8_t record_4[4] = { 6,7,8,9 };
+    uint8_t pop_buff[RECORD_BUFF_SIZE];
+
+    TEST_ASSERT_TRUE(ezRingBuffer_Init(&r_buff, au8RecordBuffer, RECORD_BUFF_SIZE));
+    TEST_ASSERT_TRUE(ezRingBuffer_PushRecord(&r_buff, record_3, sizeof(record_3), true));
+    TEST_ASSERT_TRUE(ezRingBuffer_PushRecord(&r_buff, record_2, sizeof(record_2), true));
+
+    /* Only whole records are dropped, the oldest first */
+    TEST_ASSERT_TRUE(ezRingBuffer_PushRecord(&r_buff, record_4, sizeof(record_4), true));
+    TEST_ASSERT_EQUAL(sizeof(record_2), ezRingBuffer_PopRecord(&r_buff, pop_buff, RECORD_BUFF_SIZE));
+    TEST_ASSERT_EQUAL_MEMORY(record_2, pop_buff, sizeof(record_2));
+    TEST_ASSERT_EQUAL(sizeof(record_4), ezRingBuffer_PopRecord(&r_buff, pop_buff, RECORD_BUFF_SIZE));
+    TEST_ASSERT_EQUAL_MEMORY(record_4, pop_buff, sizeof(record_4));
+    TEST_ASSERT_TRUE(ezRingBuffer_IsEmpty(&r_buff));
+}
+
+
+#if (EZ_RING_BUFFER_32BIT == 1U)
+TEST(ez_ring_buffer, large_capacity)
+{
+    static uint8_t large_buff[200000];
+    static uint8_t data[150000];
+    static uint8_t popped[150000];
+    uint32_t i = 0;
+
+    for (i = 0; i < sizeof(data); i++)
+    {
+        data[i] = (uint8_t)(i * 7U);
+    }
+
+    TEST_ASSERT_TRUE(ezRingBuffer_Init(&r_buff, large_buff, sizeof(large_buff)));
+    TEST_ASSERT_EQUAL(sizeof(large_buff), ezRingBuffer_GetAvailableMemory(&r_buff));
+
+    TEST_ASSERT_EQUAL(150000U, ezRingBuffer_Push(&r_buff, data, 150000U));
+    TEST_ASSERT_EQUAL(100000U, ezRingBuffer_Pop(&r_buff, popped, 100000U));
+    TEST_ASSERT_EQUAL_MEMORY(data, popped, 100000U);
+
+    /* Wraps around the end of the buffer */
+    TEST_ASSERT_EQUAL(100000U, ezRingBuffer_Push(&r_buff, data, 100000U));
+    TEST_ASSERT_EQUAL(150000U, ezRingBuffer_Pop(&r_buff, popped, 150000U));
+    TEST_ASSERT_EQUAL_MEMORY(&data[100000], popped, 50000U);
+    TEST_ASSERT_EQUAL_MEMORY(data, &popped[50000], 100000U);
+    TEST_ASSERT_TRUE(ezRingBuffer_IsEmpty(&r_buff));
+}
+#endif /* EZ_RING_BUFFER_32BIT == 1U */
+
+
 /******************************************************************************
 * Internal functions
 *******************************************************************************/
@@ -0,0 +1,259 @@
+/*****************************************************************************
+* Filename:         unittest_ez_spsc_ring_buffer.c
+* Author:           Hai Nguyen
+* Original Date:    18.10.2026
+*
+* ----------------------------------------------------------------------------
+* Contact:          Hai Nguyen
+*                   hainguyen.eeit@gmail.com
+*
+* ----------------------------------------------------------------------------
+* License: This file is published under the license described in LICENSE.md
+*
+*****************************************************************************/
+
+/** @file   unittest_ez_spsc_ring_buffer.c
+ *  @author Hai Nguyen
+ *  @date   18.10.2026
+ *  @brief  Unit test for SPSC ring buffer component
+ *
+ *  @details
+ *
+ */
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <pthread.h>
+#include <sched.h>
+#include "unity.h"
+#include "unity_fixture.h"
+#include "ez_spsc_ring_buffer.h"
+
+TEST_GROUP(ez_spsc_ring_buffer);
+
+/******************************************************************************
+* Module Preprocessor Macros
+*******************************************************************************/
+#define BUFF_SIZE           16U
+#define STRESS_BUFF_SIZE    64U
+#define STRESS_NUM_OF_BYTE  1000000UL
+
+
+/******************************************************************************
+* Module Typedefs
+*******************************************************************************/
+/* None */
+
+
+/******************************************************************************
+* Module Variable Definitions
+*******************************************************************************/
+static uint8_t buff[BUFF_SIZE];
+static ezSpscRingBuffer ring_buff;
+
+static uint8_t stress_buff[STRESS_BUFF_SIZE];
+static ezSpscRingBuffer stress_ring_buff;
+
+
+/******************************************************************************
+* Function Definitions
+*******************************************************************************/
+static void RunAllTests(void);
+static void *StressProducer(void *arg);
+
+
+/******************************************************************************
+* External functions
+*******************************************************************************/
+int main(int argc, const char *argv[])
+{
+    return UnityMain(argc, argv, RunAllTests);
+}
+
+
+TEST_SETUP(ez_spsc_ring_buffer)
+{
+    memset(buff, 0, sizeof(buff));
+    (void)ezSpscRingBuffer_Init(&ring_buff, buff, sizeof(buff));
+}
+
+
+TEST_TEAR_DOWN(ez_spsc_ring_buffer)
+{
+}
+
+
+TEST_GROUP_RUNNER(ez_spsc_ring_buffer)
+{
+    RUN_TEST_CASE(ez_spsc_ring_buffer, init_invalid_param);
+    RUN_TEST_CASE(ez_spsc_ring_buffer, push_pop);
+    RUN_TEST_CASE(ez_spsc_ring_buffer, full_and_empty);
+    RUN_TEST_CASE(ez_spsc_ring_buffer, wrap_around);
+    RUN_TEST_CASE(ez_spsc_ring_buffer, producer_consumer_threads);
+}
+
+
+TEST(ez_spsc_ring_buffer, init_invalid_param)
+{
+    ezSpscRingBuffer test_ring;
+
+    TEST_ASSERT_FALSE(ezSpscRingBuffer_Init(NULL, buff, sizeof(buff)));
+    TEST_ASSERT_FALSE(ezSpscRingBuffer_Init(&test_ring, NULL, sizeof(buff)));
+    TEST_ASSERT_FALSE(ezSpscRingBuffer_Init(&test_ring, buff, 0U));
+    TEST_ASSERT_FALSE(ezSpscRingBuffer_Init(&test_ring, buff, 12U));
+    TEST_ASSERT_TRUE(ezSpscRingBuffer_Init(&test_ring, buff, 8U));
+}
+
+
+TEST(ez_spsc_ring_buffer, push_pop)
+{
+    uint8_t data[] = {1, 2, 3, 4, 5};
+    uint8_t out[8] = {0};
+
+    TEST_ASSERT_EQUAL(sizeof(data), ezSpscRingBuffer_Push(&ring_buff, data, sizeof(data)));
+    TEST_ASSERT_EQUAL(sizeof(data), ezSpscRingBuffer_GetNumOfByte(&ring_buff));
+    TEST_ASSERT_EQUAL(BUFF_SIZE - sizeof(data), ezSpscRingBuffer_GetAvailableMemory(&ring_buff));
+
+    TEST_ASSERT_EQUAL(2U, ezSpscRingBuffer_Pop(&ring_buff, out, 2U));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(data, out, 2U);
+
+    TEST_ASSERT_EQUAL(3U, ezSpscRingBuffer_Pop(&ring_buff, out, sizeof(out)));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(&data[2], out, 3U);
+    TEST_ASSERT_EQUAL(0U, ezSpscRingBuffer_GetNumOfByte(&ring_buff));
+}
+
+
+TEST(ez_spsc_ring_buffer, full_and_empty)
+{
+    uint8_t data[BUFF_SIZE + 4U];
+    uint8_t out[BUFF_SIZE];
+    uint32_t i = 0;
+
+    for (i = 0; i < sizeof(data); i++)
+    {
+        data[i] = (uint8_t)i;
+    }
+
+    TEST_ASSERT_EQUAL(0U, ezSpscRingBuffer_Pop(&ring_buff, out, sizeof(out)));
+
+    /* Only the bytes fitting in the buffer are pushed */
+    TEST_ASSERT_EQUAL(BUFF_SIZE, ezSpscRingBuffer_Push(&ring_buff, data, sizeof(data)));
+    TEST_ASSERT_EQUAL(0U, ezSpscRingBuffer_GetAvailableMemory(&ring_buff));
+    TEST_ASSERT_EQUAL(0U, ezSpscRingBuffer_Push(&ring_buff, data, 1U));
+
+    TEST_ASSERT_EQUAL(BUFF_SIZE, ezSpscRingBuffer_Pop(&ring_buff, out, sizeof(out)));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(data, out, BUFF_SIZE);
+    TEST_ASSERT_EQUAL(BUFF_SIZE, ezSpscRingBuffer_GetAvailableMemory(&ring_buff));
+}
+
+
+TEST(ez_spsc_ring_buffer, wrap_around)
+{
+    uint8_t data[10] = {10, 11, 12, 13, 14, 15, 16, 17, 18, 19};
+    uint8_t out[10] = {0};
+    uint32_t round = 0;
+
+    /* Every round starts at another offset, so most of them wrap */
+    for (round = 0; round < 8U; round++)
+    {
+        TEST_ASSERT_EQUAL(sizeof(data), ezSpscRingBuffer_Push(&ring_buff, data, sizeof(data)));
+        memset(out, 0, sizeof(out));
+        TEST_ASSERT_EQUAL(sizeof(out), ezSpscRingBuffer_Pop(&ring_buff, out, sizeof(out)));
+        TEST_ASSERT_EQUAL_UINT8_ARRAY(data, out, sizeof(data));
+    }
+}
+
+
+TEST(ez_spsc_ring_buffer, producer_consumer_threads)
+{
+    pthread_t producer;
+    uint8_t out[7];
+    uint32_t num_of_byte = 0;
+    uint32_t count = 0;
+    uint32_t i = 0;
+    bool is_in_order = true;
+
+    TEST_ASSERT_TRUE(ezSpscRingBuffer_Init(&stress_ring_buff, stress_buff, sizeof(stress_buff)));
+    TEST_ASSERT_EQUAL(0, pthread_create(&producer, NULL, StressProducer, NULL));
+
+    while (num_of_byte < STRESS_NUM_OF_BYTE)
+    {
+        count = ezSpscRingBuffer_Pop(&stress_ring_buff, out, sizeof(out));
+        if (count == 0U)
+        {
+            /* Let the producer run on single core machines */
+            (void)sched_yield();
+        }
+
+        for (i = 0; i < count; i++)
+        {
+            if (out[i] != (uint8_t)(num_of_byte + i))
+            {
+                is_in_order = false;
+            }
+        }
+        num_of_byte += count;
+    }
+
+    TEST_ASSERT_EQUAL(0, pthread_join(producer, NULL));
+    TEST_ASSERT_TRUE(is_in_order);
+    TEST_ASSERT_EQUAL(STRESS_NUM_OF_BYTE, num_of_byte);
+    TEST_ASSERT_EQUAL(0U, ezSpscRingBuffer_GetNumOfByte(&stress_ring_buff));
+}
+
+
+/******************************************************************************
+* Internal functions
+*******************************************************************************/
+static void RunAllTests(void)
+{
+    RUN_TEST_GROUP(ez_spsc_ring_buffer);
+}
+
+
+static void *StressProducer(void *arg)
+{
+    uint8_t data[5];
+    uint32_t num_of_byte = 0;
+    uint32_t size = 0;
+    uint32_t count = 0;
+    uint32_t i = 0;
+
+    (void)arg;
+
+    while (num_of_byte < STRESS_NUM_OF_BYTE)
+    {
+        size = sizeof(data);
+        if (size > STRESS_NUM_OF_BYTE - num_of_byte)
+        {
+            size = STRESS_NUM_OF_BYTE - num_of_byte;
+        }
+
+        for (i = 0; i < size; i++)
+        {
+            data[i] = (uint8_t)(num_of_byte + i);
+        }
+
+        /* Retry the bytes which did not fit */
+        i = 0;
+        while (i < size)
+        {
+            count = ezSpscRingBuffer_Push(&stress_ring_buff, &data[i], size - i);
+            if (count == 0U)
+            {
+                (void)sched_yield();
+            }
+            i += count;
+        }
+        num_of_byte += size;
+    }
+
+    return NULL;
+}
+
+
+/* End of file */
@@ -77,14 +77,33 @@ TEST_TEAR_DOWN(ez_static_alloc)
 
 TEST_GROUP_RUNNER(ez_static_alloc)
 {
+#if (EZ_STATIC_ALLOC_TLSF == 0U) && (EZ_STATIC_ALLOC_INBAND == 0U)
     RUN_TEST_CASE(ez_static_alloc, u8_var);
     RUN_TEST_CASE(ez_static_alloc, u16_var);
     RUN_TEST_CASE(ez_static_alloc, u32_var);
     RUN_TEST_CASE(ez_static_alloc, array_1);
     RUN_TEST_CASE(ez_static_alloc, array_2);
+    RUN_TEST_CASE(ez_static_alloc, block_pool_carved_headers);
+    RUN_TEST_CASE(ez_static_alloc, local_list_keeps_block_pool);
+#else
+    RUN_TEST_CASE(ez_static_alloc, header_alloc_free);
+    RUN_TEST_CASE(ez_static_alloc, header_coalesce);
+    RUN_TEST_CASE(ez_static_alloc, header_invalid_free);
+    RUN_TEST_CASE(ez_static_alloc, header_exhaust);
+#endif /* EZ_STATIC_ALLOC_TLSF == 0U && EZ_STATIC_ALLOC_INBAND == 0U */
+    RUN_TEST_CASE(ez_static_alloc, scrub_on_free);
+    RUN_TEST_CASE(ez_static_alloc, scrub_none);
+    RUN_TEST_CASE(ez_static_alloc, scrub_poison);
+    RUN_TEST_CASE(ez_static_alloc, stats);
+#if (EZ_STATIC_ALLOC_32BIT == 1U)
+    RUN_TEST_CASE(ez_static_alloc, large_buffer);
+#endif /* EZ_STATIC_ALLOC_32BIT == 1U */
 }
 
 
+/* The first-fit backend keeps its headers outside of the buffer, so the
+ * position of every block is known */
+#if (EZ_STATIC_ALLOC_TLSF == 0U) && (EZ_STATIC_ALLOC_INBAND == 0U)
 TEST(ez_static_alloc, u8_var)
 {
     ezmMemList stMemList = {0};
@@ -389,6 +408,410 @@ TEST(ez_static_alloc, array_2)
 
 }
 
+TEST(ez_static_alloc, block_pool_carved_headers)
+{
+    ezmMemList stMemList1;
+    ezmMemList stMemList2;
+    uint8_t *au8Array[384];
+    uint16_t u16NumOfBlock = 0;
+    uint16_t u16NumOfBlockAgain = 0;
+
+    ezStaticAlloc_InitMemList(&stMemList1, au8Buffer, 384);
+    ezStaticAlloc_InitMemList(&stMemList2, &au8Buffer[384], 128);
+
+    /* More blocks than block_pool holds, the last headers are carved from
+     * the buffer */
+    while (u16NumOfBlock < 384U)
+    {
+        au8Array[u16NumOfBlock] = (uint8_t*)ezStaticAlloc_Malloc(&stMemList1, sizeof(uint8_t));
+        if (au8Array[u16NumOfBlock] == NULL)
+        {
+            break;
+        }
+        u16NumOfBlock++;
+    }
+    TEST_ASSERT_TRUE(u16NumOfBlock > CONFIG_NUM_OF_MEM_BLOCK);
+    TEST_ASSERT_EQUAL(ezStaticAlloc_GetNumOfAllocBlock(&stMemList1), u16NumOfBlock);
+
+    /* block_pool is empty, the other list still gets headers */
+    uint8_t *pu8Var = (uint8_t*)ezStaticAlloc_Malloc(&stMemList2, sizeof(uint8_t));
+    TEST_ASSERT_EQUAL_PTR(&au8Buffer[384], pu8Var);
+    TEST_ASSERT_TRUE(ezStaticAlloc_Free(&stMemList2, pu8Var));
+
+    /* Free blocks merge up to the carved headers */
+    for (uint16_t i = 0; i < u16NumOfBlock; i++)
+    {
+        TEST_ASSERT_TRUE(ezStaticAlloc_Free(&stMemList1, au8Array[i]));
+    }
+    TEST_ASSERT_EQUAL(ezStaticAlloc_GetNumOfFreeBlock(&stMemList1), 1U);
+    TEST_ASSERT_EQUAL(ezStaticAlloc_GetNumOfAllocBlock(&stMemList1), 0U);
+
+    /* Initializing the buffer again takes back the carved memory and the
+     * headers of block_pool */
+    ezStaticAlloc_InitMemList(&stMemList1, au8Buffer, 384);
+    while (u16NumOfBlockAgain < 384U
+           && ezStaticAlloc_Malloc(&stMemList1, sizeof(uint8_t)) != NULL)
+    {
+        u16NumOfBlockAgain++;
+    }
+    TEST_ASSERT_EQUAL(u16NumOfBlock, u16NumOfBlockAgain);
+
+    ezStaticAlloc_InitMemList(&stMemList1, au8Buffer, 384);
+    TEST_ASSERT_EQUAL_PTR(au8Buffer, ezStaticAlloc_Malloc(&stMemList1, 384));
+}
+
+TEST(ez_static_alloc, local_list_keeps_block_pool)
+{
+    ezmMemList stMemList1;
+    ezmMemList stLocalList;
+    uint8_t *au8Array[2];
+    uint16_t u16NumOfBlock = 0;
+    uint16_t u16NumOfBlockAgain = 0;
+
+    ezStaticAlloc_InitMemList(&stMemList1, au8Buffer, 384);
+    while (u16NumOfBlock < 384U
+           && ezStaticAlloc_Malloc(&stMemList1, sizeof(uint8_t)) != NULL)
+    {
+        u16NumOfBlock++;
+    }
+
+    /* The local list carves all of its headers, block_pool stays full */
+    ezStaticAlloc_InitMemList(&stMemList1, au8Buffer, 384);
+    TEST_ASSERT_TRUE(ezStaticAlloc_InitLocalMemList(&stLocalList, &au8Buffer[384], 128));
+    for (uint16_t i = 0; i < 2U; i++)
+    {
+        au8Array[i] = (uint8_t*)ezStaticAlloc_Malloc(&stLocalList, sizeof(uint8_t));
+        TEST_ASSERT_NOT_NULL(au8Array[i]);
+    }
+
+    while (u16NumOfBlockAgain < 384U
+           && ezStaticAlloc_Malloc(&stMemList1, sizeof(uint8_t)) != NULL)
+    {
+        u16NumOfBlockAgain++;
+    }
+    TEST_ASSERT_EQUAL(u16NumOfBlock, u16NumOfBlockAgain);
+
+    for (uint16_t i = 0; i < 2U; i++)
+    {
+        TEST_ASSERT_TRUE(ezStaticAlloc_Free(&stLocalList, au8Array[i]));
+    }
+    TEST_ASSERT_EQUAL(ezStaticAlloc_GetNumOfFreeBlock(&stLocalList), 1U);
+    TEST_ASSERT_EQUAL(ezStaticAlloc_GetNumOfAllocBlock(&stLocalList), 0U);
+    ezStaticAlloc_InitMemList(&stMemList1, au8Buffer, 384);
+}
+#else
+
+/* Block headers are stored in the buffer, only the properties of the blocks
+ * are checked, not their position */
+TEST(ez_static_alloc, header_alloc_free)
+{
+    ezmMemList stMemList;
+
+    TEST_ASSERT_TRUE(ezStaticAlloc_InitMemList(&stMemList, au8Buffer, 512));
+    TEST_ASSERT_EQUAL(ezStaticAlloc_GetNumOfFreeBlock(&stMemList), 1U);
+    TEST_ASSERT_EQUAL(ezStaticAlloc_GetNumOfAllocBlock(&stMemList), 0U);
+
+    uint8_t* pu8TestU8Var1 = (uint8_t*)ezStaticAlloc_Malloc(&stMemList, sizeof(uint8_t));
+    TEST_ASSERT_NOT_NULL(pu8TestU8Var1);
+    TEST_ASSERT_EQUAL(((uintptr_t)pu8TestU8Var1) % sizeof(void*), 0U);
+    TEST_ASSERT_TRUE(pu8TestU8Var1 > au8Buffer && pu8TestU8Var1 < au8Buffer + 512);
+    *pu8TestU8Var1 = 100;
+
+    uint32_t* pu32TestU32Var1 = (uint32_t*)ezStaticAlloc_Malloc(&stMemList, sizeof(uint32_t));
+    TEST_ASSERT_NOT_NULL(pu32TestU32Var1);
+    *pu32TestU32Var1 = 0xABCDCDEF;
+    TEST_ASSERT_EQUAL(*pu8TestU8Var1, 100);
+    TEST_ASSERT_EQUAL(ezStaticAlloc_GetNumOfFreeBlock(&stMemList), 1U);
+    TEST_ASSERT_EQUAL(ezStaticAlloc_GetNumOfAllocBlock(&stMemList), 2U);
+
+    TEST_ASSERT_TRUE(ezStaticAlloc_Free(&stMemList, pu8TestU8Var1));
+    TEST_ASSERT_EQUAL(ezStaticAlloc_GetNumOfFreeBlock(&stMemList), 2U);
+    TEST_ASSERT_EQUAL(ezStaticAlloc_GetNumOfAllocBlock(&stMemList), 1U);
+
+    uint8_t* pu8TestU8Var2 = (uint8_t*)ezStaticAlloc_Malloc(&stMemList, sizeof(uint8_t));
+    TEST_ASSERT_NOT_NULL(pu8TestU8Var2);
+#if (EZ_STATIC_ALLOC_TLSF == 1U)
+    /* Same size class, the freed block is reused */
+    TEST_ASSERT_EQUAL_PTR(pu8TestU8Var1, pu8TestU8Var2);
+#endif /* EZ_STATIC_ALLOC_TLSF == 1U */
+
+    TEST_ASSERT_TRUE(ezStaticAlloc_Free(&stMemList, pu8TestU8Var2));
+    TEST_ASSERT_TRUE(ezStaticAlloc_Free(&stMemList, pu32TestU32Var1));
+    TEST_ASSERT_EQUAL(ezStaticAlloc_GetNumOfFreeBlock(&stMemList), 1U);
+    TEST_ASSERT_EQUAL(ezStaticAlloc_GetNumOfAllocBlock(&stMemList), 0U);
+}
+
+TEST(ez_static_alloc, header_coalesce)
+{
+    ezmMemList stMemList;
+    uint8_t *au8Array[4];
+
+    TEST_ASSERT_TRUE(ezStaticAlloc_InitMemList(&stMemList, au8Buffer, 512));
+
+    for (uint8_t i = 0; i < 4; i++)
+    {
+        au8Array[i] = (uint8_t*)ezStaticAlloc_Malloc(&stMemList, 64);
+        TEST_ASSERT_NOT_NULL(au8Array[i]);
+        memset(au8Array[i], i, 64);
+    }
+    TEST_ASSERT_EQUAL(ezStaticAlloc_GetNumOfAllocBlock(&stMemList), 4U);
+
+    /* Free with a gap, nothing can be merged */
+    TEST_ASSERT_TRUE(ezStaticAlloc_Free(&stMemList, au8Array[0]));
+    TEST_ASSERT_TRUE(ezStaticAlloc_Free(&stMemList, au8Array[2]));
+    TEST_ASSERT_EQUAL(ezStaticAlloc_GetNumOfFreeBlock(&stMemList), 3U);
+
+    /* Block 1 is merged with both neighbours */
+    TEST_ASSERT_TRUE(ezStaticAlloc_Free(&stMemList, au8Array[1]));
+    TEST_ASSERT_EQUAL(ezStaticAlloc_GetNumOfFreeBlock(&stMemList), 2U);
+    TEST_ASSERT_EQUAL(ezStaticAlloc_GetNumOfAllocBlock(&stMemList), 1U);
+
+    /* Merged block is large enough for the three blocks and two headers */
+    uint8_t *au8Large = (uint8_t*)ezStaticAlloc_Malloc(&stMemList, 3 * 64);
+    TEST_ASSERT_EQUAL_PTR(au8Array[0], au8Large);
+    for (uint8_t i = 0; i < 64; i++)
+    {
+        TEST_ASSERT_EQUAL(au8Array[3][i], 3);
+    }
+
+    TEST_ASSERT_TRUE(ezStaticAlloc_Free(&stMemList, au8Array[3]));
+    TEST_ASSERT_TRUE(ezStaticAlloc_Free(&stMemList, au8Large));
+    TEST_ASSERT_EQUAL(ezStaticAlloc_GetNumOfFreeBlock(&stMemList), 1U);
+    TEST_ASSERT_EQUAL(ezStaticAlloc_GetNumOfAllocBlock(&stMemList), 0U);
+}
+
+TEST(ez_static_alloc, header_invalid_free)
+{
+    ezmMemList stMemList;
+    uint8_t au8Outside[8];
+
+    TEST_ASSERT_TRUE(ezStaticAlloc_InitMemList(&stMemList, au8Buffer, 512));
+
+    uint8_t *pu8Var = (uint8_t*)ezStaticAlloc_Malloc(&stMemList, 32);
+    TEST_ASSERT_NOT_NULL(pu8Var);
+    memset(pu8Var, 0, 32);
+
+    TEST_ASSERT_FALSE(ezStaticAlloc_Free(&stMemList, au8Outside));
+    TEST_ASSERT_FALSE(ezStaticAlloc_Free(&stMemList, pu8Var + 1));
+    TEST_ASSERT_FALSE(ezStaticAlloc_Free(&stMemList, pu8Var + 16));
+    TEST_ASSERT_EQUAL(ezStaticAlloc_GetNumOfAllocBlock(&stMemList), 1U);
+
+    TEST_ASSERT_TRUE(ezStaticAlloc_Free(&stMemList, pu8Var));
+    TEST_ASSERT_FALSE(ezStaticAlloc_Free(&stMemList, pu8Var));
+    TEST_ASSERT_EQUAL(ezStaticAlloc_GetNumOfFreeBlock(&stMemList), 1U);
+    TEST_ASSERT_EQUAL(ezStaticAlloc_GetNumOfAllocBlock(&stMemList), 0U);
+}
+
+TEST(ez_static_alloc, header_exhaust)
+{
+    ezmMemList stMemList;
+    uint8_t *au8Array[32];
+    uint16_t u16NumOfBlock = 0;
+
+    TEST_ASSERT_TRUE(ezStaticAlloc_InitMemList(&stMemList, au8Buffer, 512));
+    TEST_ASSERT_NULL(ezStaticAlloc_Malloc(&stMemList, 512));
+
+    while (u16NumOfBlock < 32)
+    {
+        au8Array[u16NumOfBlock] = (uint8_t*)ezStaticAlloc_Malloc(&stMemList, 16);
+        if (au8Array[u16NumOfBlock] == NULL)
+        {
+            break;
+        }
+        u16NumOfBlock++;
+    }
+
+    TEST_ASSERT_GREATER_THAN(1U, u16NumOfBlock);
+    TEST_ASSERT_LESS_THAN(32U, u16NumOfBlock);
+    TEST_ASSERT_EQUAL(ezStaticAlloc_GetNumOfAllocBlock(&stMemList), u16NumOfBlock);
+
+    /* Release in reverse order, everything must be merged back */
+    while (u16NumOfBlock > 0)
+    {
+        u16NumOfBlock--;
+        TEST_ASSERT_TRUE(ezStaticAlloc_Free(&stMemList, au8Array[u16NumOfBlock]));
+    }
+    TEST_ASSERT_EQUAL(ezStaticAlloc_GetNumOfFreeBlock(&stMemList), 1U);
+    TEST_ASSERT_EQUAL(ezStaticAlloc_GetNumOfAllocBlock(&stMemList), 0U);
+    TEST_ASSERT_NOT_NULL(ezStaticAlloc_Malloc(&stMemList, 256));
+}
+#endif /* EZ_STATIC_ALLOC_TLSF == 0U && EZ_STATIC_ALLOC_INBAND == 0U */
+
+
+/* Byte 20 lies past the list node some layouts keep in the payload of a
+ * free block */
+TEST(ez_static_alloc, scrub_on_free)
+{
+    ezmMemList stMemList;
+    uint8_t au8Zero[32] = { 0 };
+    uint8_t *pu8Data = NULL;
+
+    memset(au8Buffer, 0xFF, sizeof(au8Buffer));
+    TEST_ASSERT_TRUE(ezStaticAlloc_InitMemList(&stMemList, au8Buffer, 512));
+
+    pu8Data = (uint8_t*)ezStaticAlloc_Malloc(&stMemList, 32);
+    TEST_ASSERT_NOT_NULL(pu8Data);
+    TEST_ASSERT_EQUAL_MEMORY(au8Zero, pu8Data, 32);
+
+    memset(pu8Data, 0xFF, 32);
+    TEST_ASSERT_TRUE(ezStaticAlloc_Free(&stMemList, pu8Data));
+    pu8Data = (uint8_t*)ezStaticAlloc_Malloc(&stMemList, 32);
+    TEST_ASSERT_NOT_NULL(pu8Data);
+    TEST_ASSERT_EQUAL_MEMORY(au8Zero, pu8Data, 32);
+}
+
+
+TEST(ez_static_alloc, scrub_none)
+{
+    ezmMemList stMemList;
+    uint8_t *pu8Data = NULL;
+
+    TEST_ASSERT_TRUE(ezStaticAlloc_InitMemList(&stMemList, au8Buffer, 512));
+    TEST_ASSERT_TRUE(ezStaticAlloc_SetScrubPolicy(&stMemList, EZ_STATIC_ALLOC_SCRUB_NONE));
+    TEST_ASSERT_FALSE(ezStaticAlloc_SetScrubPolicy(&stMemList, (ezStaticAllocScrub)(EZ_STATIC_ALLOC_SCRUB_POISON + 1)));
+
+    pu8Data = (uint8_t*)ezStaticAlloc_Malloc(&stMemList, 32);
+    TEST_ASSERT_NOT_NULL(pu8Data);
+    pu8Data[20] = 0x5A;
+    TEST_ASSERT_TRUE(ezStaticAlloc_Free(&stMemList, pu8Data));
+
+    /* Freed memory is not touched */
+    TEST_ASSERT_EQUAL_HEX8(0x5A, pu8Data[20]);
+    TEST_ASSERT_EQUAL_PTR(pu8Data, ezStaticAlloc_Malloc(&stMemList, 32));
+    TEST_ASSERT_EQUAL_HEX8(0x5A, pu8Data[20]);
+    TEST_ASSERT_EQUAL(0U, ezStaticAlloc_GetNumOfPoisonError(&stMemList));
+}
+
+
+TEST(ez_static_alloc, scrub_poison)
+{
+    ezmMemList stMemList;
+    uint8_t *pu8Data1 = NULL;
+    uint8_t *pu8Data2 = NULL;
+
+    TEST_ASSERT_TRUE(ezStaticAlloc_InitMemList(&stMemList, au8Buffer, 512));
+    TEST_ASSERT_TRUE(ezStaticAlloc_SetScrubPolicy(&stMemList, EZ_STATIC_ALLOC_SCRUB_POISON));
+
+    pu8Data1 = (uint8_t*)ezStaticAlloc_Malloc(&stMemList, 32);
+    TEST_ASSERT_NOT_NULL(pu8Data1);
+    TEST_ASSERT_EQUAL_HEX8(CONFIG_EZ_STATIC_ALLOC_POISON_BYTE, pu8Data1[20]);
+    TEST_ASSERT_EQUAL(0U, ezStaticAlloc_GetNumOfPoisonError(&stMemList));
+
+    /* Correct use, the pattern is restored on free */
+    memset(pu8Data1, 0, 32);
+    TEST_ASSERT_TRUE(ezStaticAlloc_Free(&stMemList, pu8Data1));
+    TEST_ASSERT_EQUAL_HEX8(CONFIG_EZ_STATIC_ALLOC_POISON_BYTE, pu8Data1[20]);
+    TEST_ASSERT_EQUAL_PTR(pu8Data1, ezStaticAlloc_Malloc(&stMemList, 32));
+    TEST_ASSERT_EQUAL(0U, ezStaticAlloc_GetNumOfPoisonError(&stMemList));
+
+    /* Write after free is detected by the next allocation of the block */
+    TEST_ASSERT_TRUE(ezStaticAlloc_Free(&stMemList, pu8Data1));
+    pu8Data1[20] = 0x00;
+    TEST_ASSERT_EQUAL_PTR(pu8Data1, ezStaticAlloc_Malloc(&stMemList, 32));
+    TEST_ASSERT_EQUAL(1U, ezStaticAlloc_GetNumOfPoisonError(&stMemList));
+    TEST_ASSERT_TRUE(ezStaticAlloc_Free(&stMemList, pu8Data1));
+
+    /* Merged blocks keep the pattern */
+    pu8Data1 = (uint8_t*)ezStaticAlloc_Malloc(&stMemList, 32);
+    pu8Data2 = (uint8_t*)ezStaticAlloc_Malloc(&stMemList, 32);
+    TEST_ASSERT_TRUE(ezStaticAlloc_Free(&stMemList, pu8Data1));
+    TEST_ASSERT_TRUE(ezStaticAlloc_Free(&stMemList, pu8Data2));
+    TEST_ASSERT_NOT_NULL(ezStaticAlloc_Malloc(&stMemList, 128));
+    TEST_ASSERT_EQUAL(1U, ezStaticAlloc_GetNumOfPoisonError(&stMemList));
+}
+
+TEST(ez_static_alloc, stats)
+{
+    ezmMemList stMemList;
+    ezStaticAllocStats stStats;
+    ezStaticAllocSize total_free = 0;
+    uint8_t *pu8Data1 = NULL;
+    uint8_t *pu8Data2 = NULL;
+    uint8_t *pu8Data3 = NULL;
+
+    TEST_ASSERT_FALSE(ezStaticAlloc_GetStats(&stMemList, NULL));
+    TEST_ASSERT_TRUE(ezStaticAlloc_InitMemList(&stMemList, au8Buffer, 512));
+    TEST_ASSERT_TRUE(ezStaticAlloc_GetStats(&stMemList, &stStats));
+    TEST_ASSERT_EQUAL(0U, stStats.used_bytes);
+    TEST_ASSERT_EQUAL(stStats.free_bytes, stStats.largest_free_block);
+    TEST_ASSERT_EQUAL(0U, stStats.fragmentation);
+    TEST_ASSERT_EQUAL(1U, stStats.num_of_free_block);
+    total_free = stStats.free_bytes;
+
+    pu8Data1 = (uint8_t*)ezStaticAlloc_Malloc(&stMemList, 32);
+    pu8Data2 = (uint8_t*)ezStaticAlloc_Malloc(&stMemList, 32);
+    pu8Data3 = (uint8_t*)ezStaticAlloc_Malloc(&stMemList, 32);
+    TEST_ASSERT_NULL(ezStaticAlloc_Malloc(&stMemList, 600));
+
+    TEST_ASSERT_TRUE(ezStaticAlloc_GetStats(&stMemList, &stStats));
+    TEST_ASSERT_EQUAL(96U, stStats.used_bytes);
+    TEST_ASSERT_EQUAL(96U, stStats.high_water_mark);
+    TEST_ASSERT_EQUAL(3U, stStats.num_of_alloc_block);
+    TEST_ASSERT_EQUAL(3U, stStats.num_of_split);
+    TEST_ASSERT_EQUAL(1U, stStats.num_of_alloc_fail);
+    TEST_ASSERT_LESS_OR_EQUAL(total_free, stStats.free_bytes + stStats.used_bytes);
+
+    /* A hole in the middle fragments the free memory */
+    TEST_ASSERT_TRUE(ezStaticAlloc_Free(&stMemList, pu8Data2));
+    TEST_ASSERT_TRUE(ezStaticAlloc_GetStats(&stMemList, &stStats));
+    TEST_ASSERT_EQUAL(64U, stStats.used_bytes);
+    TEST_ASSERT_EQUAL(96U, stStats.high_water_mark);
+    TEST_ASSERT_EQUAL(2U, stStats.num_of_free_block);
+    TEST_ASSERT_LESS_THAN(stStats.free_bytes, stStats.largest_free_block);
+    TEST_ASSERT_GREATER_THAN(0U, stStats.fragmentation);
+
+    ezStaticAlloc_ResetStats(&stMemList);
+    TEST_ASSERT_TRUE(ezStaticAlloc_GetStats(&stMemList, &stStats));
+    TEST_ASSERT_EQUAL(64U, stStats.high_water_mark);
+    TEST_ASSERT_EQUAL(0U, stStats.num_of_alloc_fail);
+    TEST_ASSERT_EQUAL(0U, stStats.num_of_split);
+
+    TEST_ASSERT_TRUE(ezStaticAlloc_Free(&stMemList, pu8Data1));
+    TEST_ASSERT_TRUE(ezStaticAlloc_Free(&stMemList, pu8Data3));
+    TEST_ASSERT_TRUE(ezStaticAlloc_GetStats(&stMemList, &stStats));
+    TEST_ASSERT_EQUAL(0U, stStats.used_bytes);
+    TEST_ASSERT_EQUAL(total_free, stStats.free_bytes);
+    TEST_ASSERT_EQUAL(1U, stStats.num_of_free_block);
+    TEST_ASSERT_GREATER_THAN(0U, stStats.num_of_merge);
+    TEST_ASSERT_EQUAL(0U, stStats.fragmentation);
+}
+
+
+#if (EZ_STATIC_ALLOC_32BIT == 1U)
+TEST(ez_static_alloc, large_buffer)
+{
+    static uint8_t large_buff[256 * 1024];
+    ezmMemList stMemList;
+    uint8_t *pu8Data1 = NULL;
+    uint8_t *pu8Data2 = NULL;
+    uint8_t *pu8Data3 = NULL;
+
+    TEST_ASSERT_TRUE(ezStaticAlloc_InitMemList(&stMemList, large_buff, sizeof(large_buff)));
+
+    pu8Data1 = (uint8_t*)ezStaticAlloc_Malloc(&stMemList, 100000U);
+    pu8Data2 = (uint8_t*)ezStaticAlloc_Malloc(&stMemList, 100000U);
+    TEST_ASSERT_NOT_NULL(pu8Data1);
+    TEST_ASSERT_NOT_NULL(pu8Data2);
+    TEST_ASSERT_NULL(ezStaticAlloc_Malloc(&stMemList, 100000U));
+
+    memset(pu8Data1, 0x11, 100000U);
+    memset(pu8Data2, 0x22, 100000U);
+    TEST_ASSERT_EQUAL_HEX8(0x11, pu8Data1[99999]);
+    TEST_ASSERT_EQUAL_HEX8(0x22, pu8Data2[0]);
+
+    TEST_ASSERT_TRUE(ezStaticAlloc_Free(&stMemList, pu8Data1));
+    TEST_ASSERT_TRUE(ezStaticAlloc_Free(&stMemList, pu8Data2));
+    TEST_ASSERT_EQUAL(0U, ezStaticAlloc_GetNumOfAllocBlock(&stMemList));
+
+    /* Blocks are merged back into one block larger than 64 KiB */
+    pu8Data3 = (uint8_t*)ezStaticAlloc_Malloc(&stMemList, 200000U);
+    TEST_ASSERT_NOT_NULL(pu8Data3);
+    TEST_ASSERT_EQUAL_HEX8(0x00, pu8Data3[150000]);
+    TEST_ASSERT_TRUE(ezStaticAlloc_Free(&stMemList, pu8Data3));
+}
+#endif /* EZ_STATIC_ALLOC_32BIT == 1U */
+
+
 /******************************************************************************
 * Internal functions
 *******************************************************************************/
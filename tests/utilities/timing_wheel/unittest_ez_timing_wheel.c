@@ -0,0 +1,332 @@
+/*****************************************************************************
+* Filename:         unittest_ez_timing_wheel.c
+* Author:           Hai Nguyen
+* Original Date:    18.10.2026
+*
+* ----------------------------------------------------------------------------
+* Contact:          Hai Nguyen
+*                   hainguyen.eeit@gmail.com
+*
+* ----------------------------------------------------------------------------
+* License: This file is published under the license described in LICENSE.md
+*
+*****************************************************************************/
+
+/** @file   unittest_ez_timing_wheel.c
+ *  @author Hai Nguyen
+ *  @date   18.10.2026
+ *  @brief  Unit test for the timing wheel component
+ *
+ *  @details
+ *
+ */
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "unity.h"
+#include "unity_fixture.h"
+#include "ez_timing_wheel.h"
+#include "ez_test_random.h"
+
+TEST_GROUP(ez_timing_wheel);
+
+/******************************************************************************
+* Module Preprocessor Macros
+*******************************************************************************/
+#define NUM_OF_ITEM     64U
+
+
+/******************************************************************************
+* Module Typedefs
+*******************************************************************************/
+struct test_item
+{
+    uint32_t period;
+    uint32_t num_of_expiry;
+    uint32_t last_expiry_tick;
+    struct ezTimingWheelTimer timer;
+};
+
+
+/******************************************************************************
+* Module Variable Definitions
+*******************************************************************************/
+static struct ezTimingWheel wheel;
+static struct test_item items[NUM_OF_ITEM];
+static uint32_t current_tick = 0;
+static uint32_t previous_tick = 0;
+static bool is_expiry_in_time = true;
+
+
+/******************************************************************************
+* Function Definitions
+*******************************************************************************/
+static void RunAllTests(void);
+static void OnTimerExpired(struct ezTimingWheelTimer *timer, void *arg);
+
+
+/******************************************************************************
+* External functions
+*******************************************************************************/
+int main(int argc, const char *argv[])
+{
+    return UnityMain(argc, argv, RunAllTests);
+}
+
+
+TEST_SETUP(ez_timing_wheel)
+{
+    uint32_t i = 0;
+
+    current_tick = 0;
+    previous_tick = 0;
+    is_expiry_in_time = true;
+    (void)ezTimingWheel_Init(&wheel, current_tick);
+    for (i = 0; i < NUM_OF_ITEM; i++)
+    {
+        items[i].period = 0;
+        items[i].num_of_expiry = 0;
+        items[i].last_expiry_tick = 0;
+        ezTimingWheel_InitTimer(&items[i].timer);
+    }
+}
+
+
+TEST_TEAR_DOWN(ez_timing_wheel)
+{
+}
+
+
+TEST_GROUP_RUNNER(ez_timing_wheel)
+{
+    RUN_TEST_CASE(ez_timing_wheel, Init_InvalidParam);
+    RUN_TEST_CASE(ez_timing_wheel, Advance_ExpiresAtExactTick);
+    RUN_TEST_CASE(ez_timing_wheel, AddRemove);
+    RUN_TEST_CASE(ez_timing_wheel, GetNextTick_FewWakeups);
+    RUN_TEST_CASE(ez_timing_wheel, Advance_LateCall);
+    RUN_TEST_CASE(ez_timing_wheel, Periodic_ReAddInCallback);
+    RUN_TEST_CASE(ez_timing_wheel, TickWrapAround);
+    RUN_TEST_CASE(ez_timing_wheel, RandomOperations);
+}
+
+
+TEST(ez_timing_wheel, Init_InvalidParam)
+{
+    uint32_t tick = 0;
+
+    TEST_ASSERT_FALSE(ezTimingWheel_Init(NULL, 0));
+    TEST_ASSERT_FALSE(ezTimingWheel_AddTimer(NULL, &items[0].timer, 10U));
+    TEST_ASSERT_FALSE(ezTimingWheel_GetNextTick(&wheel, &tick));
+    TEST_ASSERT_EQUAL(0U, ezTimingWheel_Advance(&wheel, 100U, NULL, NULL));
+    TEST_ASSERT_EQUAL(0U, ezTimingWheel_GetNumOfTimer(&wheel));
+}
+
+
+TEST(ez_timing_wheel, Advance_ExpiresAtExactTick)
+{
+    uint32_t expiries[] = {1, 5, 15, 16, 17, 255, 256, 300, 4096, 5000, 65535, 70000};
+    uint32_t num_of_timer = sizeof(expiries) / sizeof(expiries[0]);
+    uint32_t i = 0;
+
+    for (i = 0; i < num_of_timer; i++)
+    {
+        TEST_ASSERT_TRUE(ezTimingWheel_AddTimer(&wheel, &items[i].timer, expiries[i]));
+    }
+    TEST_ASSERT_EQUAL(num_of_timer, ezTimingWheel_GetNumOfTimer(&wheel));
+
+    /* One tick at a time, every timer expires at its own tick */
+    for (current_tick = 1; current_tick <= 70000U; current_tick++)
+    {
+        (void)ezTimingWheel_Advance(&wheel, current_tick, OnTimerExpired, NULL);
+    }
+
+    for (i = 0; i < num_of_timer; i++)
+    {
+        TEST_ASSERT_EQUAL(1U, items[i].num_of_expiry);
+        TEST_ASSERT_EQUAL(expiries[i], items[i].last_expiry_tick);
+        TEST_ASSERT_FALSE(ezTimingWheel_IsTimerActive(&items[i].timer));
+    }
+    TEST_ASSERT_EQUAL(0U, ezTimingWheel_GetNumOfTimer(&wheel));
+}
+
+
+TEST(ez_timing_wheel, AddRemove)
+{
+    TEST_ASSERT_TRUE(ezTimingWheel_AddTimer(&wheel, &items[0].timer, 20U));
+    TEST_ASSERT_FALSE(ezTimingWheel_AddTimer(&wheel, &items[0].timer, 30U));
+    TEST_ASSERT_TRUE(ezTimingWheel_AddTimer(&wheel, &items[1].timer, 20U));
+    TEST_ASSERT_TRUE(ezTimingWheel_IsTimerActive(&items[0].timer));
+
+    TEST_ASSERT_TRUE(ezTimingWheel_RemoveTimer(&wheel, &items[0].timer));
+    TEST_ASSERT_FALSE(ezTimingWheel_RemoveTimer(&wheel, &items[0].timer));
+    TEST_ASSERT_FALSE(ezTimingWheel_IsTimerActive(&items[0].timer));
+    TEST_ASSERT_EQUAL(1U, ezTimingWheel_GetNumOfTimer(&wheel));
+
+    current_tick = 100;
+    TEST_ASSERT_EQUAL(1U, ezTimingWheel_Advance(&wheel, current_tick, OnTimerExpired, NULL));
+    TEST_ASSERT_EQUAL(0U, items[0].num_of_expiry);
+    TEST_ASSERT_EQUAL(1U, items[1].num_of_expiry);
+
+    /* Expired timer is added to the next tick */
+    TEST_ASSERT_TRUE(ezTimingWheel_AddTimer(&wheel, &items[0].timer, 50U));
+    TEST_ASSERT_EQUAL(0U, ezTimingWheel_Advance(&wheel, current_tick, OnTimerExpired, NULL));
+    current_tick = 101;
+    TEST_ASSERT_EQUAL(1U, ezTimingWheel_Advance(&wheel, current_tick, OnTimerExpired, NULL));
+    TEST_ASSERT_EQUAL(1U, items[0].num_of_expiry);
+}
+
+
+TEST(ez_timing_wheel, GetNextTick_FewWakeups)
+{
+    uint32_t tick = 0;
+    uint32_t num_of_wakeup = 0;
+
+    TEST_ASSERT_TRUE(ezTimingWheel_AddTimer(&wheel, &items[0].timer, 50000U));
+
+    /* Sleep until the next tick every time, like a worker thread */
+    while (items[0].num_of_expiry == 0)
+    {
+        TEST_ASSERT_TRUE(ezTimingWheel_GetNextTick(&wheel, &tick));
+        TEST_ASSERT_TRUE(tick <= 50000U);
+        current_tick = tick;
+        (void)ezTimingWheel_Advance(&wheel, current_tick, OnTimerExpired, NULL);
+        num_of_wakeup++;
+    }
+
+    /* One wakeup per level at most */
+    TEST_ASSERT_TRUE(num_of_wakeup <= CONFIG_EZ_TIMING_WHEEL_NUM_OF_LEVEL);
+    TEST_ASSERT_EQUAL(50000U, items[0].last_expiry_tick);
+    TEST_ASSERT_FALSE(ezTimingWheel_GetNextTick(&wheel, &tick));
+}
+
+
+TEST(ez_timing_wheel, Advance_LateCall)
+{
+    uint32_t i = 0;
+
+    for (i = 0; i < 10U; i++)
+    {
+        TEST_ASSERT_TRUE(ezTimingWheel_AddTimer(&wheel, &items[i].timer, 100U + i * 1000U));
+    }
+
+    /* Expiries up to 4100 are due */
+    previous_tick = 0;
+    current_tick = 4500;
+    TEST_ASSERT_EQUAL(5U, ezTimingWheel_Advance(&wheel, current_tick, OnTimerExpired, NULL));
+    TEST_ASSERT_TRUE(is_expiry_in_time);
+
+    previous_tick = current_tick;
+    current_tick = 20000;
+    TEST_ASSERT_EQUAL(5U, ezTimingWheel_Advance(&wheel, current_tick, OnTimerExpired, NULL));
+    TEST_ASSERT_TRUE(is_expiry_in_time);
+    TEST_ASSERT_EQUAL(0U, ezTimingWheel_GetNumOfTimer(&wheel));
+}
+
+
+TEST(ez_timing_wheel, Periodic_ReAddInCallback)
+{
+    /* A period of one rotation puts the timer back in the slot being expired */
+    items[0].period = EZ_TIMING_WHEEL_NUM_OF_SLOT;
+    items[1].period = 7;
+    TEST_ASSERT_TRUE(ezTimingWheel_AddTimer(&wheel, &items[0].timer, items[0].period));
+    TEST_ASSERT_TRUE(ezTimingWheel_AddTimer(&wheel, &items[1].timer, items[1].period));
+
+    for (current_tick = 1; current_tick <= 1000U; current_tick++)
+    {
+        (void)ezTimingWheel_Advance(&wheel, current_tick, OnTimerExpired, NULL);
+    }
+
+    TEST_ASSERT_EQUAL(1000U / EZ_TIMING_WHEEL_NUM_OF_SLOT, items[0].num_of_expiry);
+    TEST_ASSERT_EQUAL(1000U / 7U, items[1].num_of_expiry);
+    TEST_ASSERT_EQUAL(994U, items[1].last_expiry_tick);
+    TEST_ASSERT_EQUAL(2U, ezTimingWheel_GetNumOfTimer(&wheel));
+}
+
+
+TEST(ez_timing_wheel, TickWrapAround)
+{
+    current_tick = 0xFFFFFF00UL;
+    (void)ezTimingWheel_Init(&wheel, current_tick);
+
+    TEST_ASSERT_TRUE(ezTimingWheel_AddTimer(&wheel, &items[0].timer, current_tick + 0x80U));
+    TEST_ASSERT_TRUE(ezTimingWheel_AddTimer(&wheel, &items[1].timer, current_tick + 0x180U));
+
+    previous_tick = current_tick;
+    current_tick += 0x100U;
+    TEST_ASSERT_EQUAL(1U, ezTimingWheel_Advance(&wheel, current_tick, OnTimerExpired, NULL));
+    TEST_ASSERT_EQUAL(0xFFFFFF80UL, items[0].last_expiry_tick);
+
+    previous_tick = current_tick;
+    current_tick += 0x100U;
+    TEST_ASSERT_EQUAL(1U, ezTimingWheel_Advance(&wheel, current_tick, OnTimerExpired, NULL));
+    TEST_ASSERT_EQUAL(0x80U, items[1].last_expiry_tick);
+    TEST_ASSERT_TRUE(is_expiry_in_time);
+}
+
+
+TEST(ez_timing_wheel, RandomOperations)
+{
+    uint32_t random_state = 2463534242UL;
+    uint32_t round = 0;
+    uint32_t i = 0;
+    uint32_t delay = 0;
+
+    for (round = 0; round < 20000U; round++)
+    {
+        i = ezTest_NextRandom(&random_state) % NUM_OF_ITEM;
+
+        if (ezTimingWheel_IsTimerActive(&items[i].timer) == false)
+        {
+            /* Mostly short delays, some far beyond the wheel range */
+            delay = ezTest_NextRandom(&random_state) % ((round % 8U == 0) ? 200000U : 300U);
+            TEST_ASSERT_TRUE(ezTimingWheel_AddTimer(&wheel, &items[i].timer, current_tick + delay + 1U));
+        }
+        else if ((ezTest_NextRandom(&random_state) & 3U) == 0U)
+        {
+            TEST_ASSERT_TRUE(ezTimingWheel_RemoveTimer(&wheel, &items[i].timer));
+        }
+
+        /* Every timer expires in the call covering its tick */
+        previous_tick = current_tick;
+        current_tick += ezTest_NextRandom(&random_state) % 40U;
+        (void)ezTimingWheel_Advance(&wheel, current_tick, OnTimerExpired, NULL);
+        TEST_ASSERT_TRUE(is_expiry_in_time);
+    }
+}
+
+
+/******************************************************************************
+* Internal functions
+*******************************************************************************/
+static void RunAllTests(void)
+{
+    RUN_TEST_GROUP(ez_timing_wheel);
+}
+
+
+static void OnTimerExpired(struct ezTimingWheelTimer *timer, void *arg)
+{
+    struct test_item *item = EZ_TIMING_WHEEL_GET_PARENT_OF(timer, timer, struct test_item);
+    (void)arg;
+
+    /* Not before its tick, and not later than the current call */
+    if ((int32_t)(current_tick - timer->expiry) < 0
+        || (int32_t)(timer->expiry - previous_tick) <= 0)
+    {
+        is_expiry_in_time = false;
+    }
+
+    item->num_of_expiry++;
+    item->last_expiry_tick = timer->expiry;
+
+    if (item->period > 0)
+    {
+        (void)ezTimingWheel_AddTimer(&wheel, timer, timer->expiry + item->period);
+    }
+}
+
+
+/* End of file */
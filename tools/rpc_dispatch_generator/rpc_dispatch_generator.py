@@ -0,0 +1,276 @@
+__author__ =        "Hai Nguyen"
+__credits__ =       "Hai Nguyen"
+__license__ =       "This file is published under the license described in LICENSE.md"
+__maintainer__ =    "Hai Nguyen"
+__email__ =         "hainguyen.eeit@gmail.com"
+
+"""Generate the service table and the dispatch table of an RPC instance.
+
+The input is a json file listing the services:
+
+    {
+        "name": "my_rpc",
+        "services": [
+            {"tag": 1, "handler": "MyRpc_HandleEcho"},
+            {"tag": 7, "handler": "MyRpc_HandleReset"}
+        ]
+    }
+
+The output is <name>_services.h/.c, defining <name>_service_table for
+ezRpc_Initialization and <name>_dispatch_table for ezRpc_SetDispatchTable.
+The dispatch table is a perfect hash: the service of a tag is stored at
+tag % modulus, with the smallest modulus for which no two tags collide.
+"""
+
+import logging
+import argparse
+import json
+import os
+import re
+from datetime import datetime
+
+# create logger
+logger = logging.getLogger('RPC_DISPATCH_GENERATOR')
+logger.setLevel(logging.INFO)
+logger.propagate = False
+
+ch = logging.StreamHandler()
+formatter = logging.Formatter('%(name)s::%(funcName)s::%(levelname)s::%(message)s')
+ch.setFormatter(formatter)
+logger.addHandler(ch)
+
+
+# Create the parser
+my_parser = argparse.ArgumentParser(prog = 'RPC dispatch table generator',
+                                    description='Create the service and dispatch tables of an RPC instance')
+
+_MAX_NUM_OF_TAG = 256
+
+_file_header ="""\
+/*****************************************************************************
+* Filename:         {0}
+* Author:           {1}
+* Original Date:    {2}
+*
+* ----------------------------------------------------------------------------
+* Contact:          Hai Nguyen
+*                   hainguyen.eeit@gmail.com
+*
+* ----------------------------------------------------------------------------
+* License: This file is published under the license described in LICENSE.md
+*
+*****************************************************************************/
+
+/** @file   {0}
+ *  @author {1}
+ *  @date   {2}
+ *  @brief  RPC services of {3}, generated by rpc_dispatch_generator.py
+ *
+ *  @details Do not edit, regenerate from {4} instead
+ */
+"""
+
+_header_body=\
+"""
+#ifndef _{0}_SERVICES_H
+#define _{0}_SERVICES_H
+
+#ifdef __cplusplus
+extern "C" {{
+#endif
+
+/*****************************************************************************
+* Includes
+*****************************************************************************/
+#include "ez_rpc.h"
+
+#if (EZ_RPC_ENABLE == 1)
+
+/*****************************************************************************
+* Component Preprocessor Macros
+*****************************************************************************/
+#define {0}_NUM_OF_SERVICE    {1}U /**< Number of elements of the service table */
+
+
+/*****************************************************************************
+* Component Variable Definitions
+*****************************************************************************/
+extern struct ezRpcService {2}_service_table[{0}_NUM_OF_SERVICE];
+extern const struct ezRpcDispatchTable {2}_dispatch_table;
+
+
+/*****************************************************************************
+* Function Prototypes
+*****************************************************************************/
+{3}
+
+#endif /* EZ_RPC_ENABLE == 1 */
+
+#ifdef __cplusplus
+}}
+#endif
+
+#endif /* _{0}_SERVICES_H */
+
+
+/* End of file */
+"""
+
+_source_body=\
+"""
+/*****************************************************************************
+* Includes
+*****************************************************************************/
+#include "{0}_services.h"
+
+#if (EZ_RPC_ENABLE == 1)
+
+/*****************************************************************************
+* Component Variable Definitions
+*****************************************************************************/
+struct ezRpcService {0}_service_table[{1}_NUM_OF_SERVICE] = {{
+{2}
+}};
+
+/* Service of a tag is at tag % {3}, unused entries hold a tag of another index */
+static const struct ezRpcService {0}_dispatch_entries[{3}] = {{
+{4}
+}};
+
+const struct ezRpcDispatchTable {0}_dispatch_table = {{
+    {0}_dispatch_entries,
+    {3}U,
+}};
+
+#endif /* EZ_RPC_ENABLE == 1 */
+
+/* End of file */
+"""
+
+
+def load_services(input_path:str):
+    """Load and validate the service description
+
+    Args:
+        input_path (str): path to the json file
+
+    Returns:
+        (name, services) where services is a list of (tag, handler) sorted by tag
+
+    Raises:
+        ValueError: if the description is not valid
+    """
+    with open(input_path, "r") as input_file:
+        description = json.load(input_file)
+
+    name = description.get("name", "")
+    if re.fullmatch("[A-Za-z_][A-Za-z0-9_]*", name) is None:
+        raise ValueError("name must be a C identifier, got '{}'".format(name))
+
+    services = []
+    tags = set()
+    for service in description.get("services", []):
+        tag = service.get("tag")
+        handler = service.get("handler", "")
+
+        if not isinstance(tag, int) or tag < 0 or tag >= _MAX_NUM_OF_TAG:
+            raise ValueError("tag must be an integer in [0, 255], got {}".format(tag))
+        if tag in tags:
+            raise ValueError("tag {} is used more than once".format(tag))
+        if re.fullmatch("[A-Za-z_][A-Za-z0-9_]*", handler) is None:
+            raise ValueError("handler of tag {} must be a C identifier".format(tag))
+
+        tags.add(tag)
+        services.append((tag, handler))
+
+    if len(services) == 0:
+        raise ValueError("no service found")
+
+    return (name, sorted(services))
+
+
+def find_modulus(tags:list)->int:
+    """Find the smallest modulus for which the tags do not collide
+
+    Args:
+        tags (list): distinct tags
+
+    Returns:
+        int: modulus, at most 256 since the tags are 8 bits
+    """
+    for modulus in range(len(tags), _MAX_NUM_OF_TAG + 1):
+        if len(set(tag % modulus for tag in tags)) == len(tags):
+            return modulus
+    return _MAX_NUM_OF_TAG
+
+
+def generate_files(input_path:str, output_path:str, author:str):
+    """Generate the header and the source file
+
+    Args:
+        input_path (str): path to the json file
+        output_path (str): folder where the files are stored
+        author (str): author
+    """
+    name, services = load_services(input_path)
+    modulus = find_modulus([tag for tag, _ in services])
+    logger.info("{} services, modulus {}".format(len(services), modulus))
+
+    # an unused entry gets a tag stored at another index, so it never matches
+    entries = ["    {{{}, NULL}},".format((index + 1) % modulus) for index in range(modulus)]
+    for tag, handler in services:
+        entries[tag % modulus] = "    {{{}, {}}},".format(tag, handler)
+
+    service_table = "\n".join("    {{{}, {}}},".format(tag, handler) for tag, handler in services)
+    prototypes = "\n".join("void {}(void *payload, uint32_t payload_size_byte);".format(handler)
+                           for _, handler in services)
+
+    dt_string = datetime.now().strftime("%d.%m.%Y")
+    input_filename = os.path.basename(input_path)
+
+    header_name = name + "_services.h"
+    with open(os.path.join(output_path, header_name), "w") as header:
+        header.write(_file_header.format(header_name, author, dt_string, name, input_filename))
+        header.write(_header_body.format(name.upper(), len(services), name, prototypes))
+
+    source_name = name + "_services.c"
+    with open(os.path.join(output_path, source_name), "w") as source:
+        source.write(_file_header.format(source_name, author, dt_string, name, input_filename))
+        source.write(_source_body.format(name, name.upper(), service_table, modulus, "\n".join(entries)))
+
+    logger.info("complete")
+
+
+def main():
+    """main, entry point of the application
+    """
+    # read arguments
+    my_parser.add_argument( '-i',
+                            '--input',
+                            action='store',
+                            type=str,
+                            required=True,
+                            help='json file describing the services')
+
+    my_parser.add_argument( '-a',
+                            '--author',
+                            action='store',
+                            type=str,
+                            default="Hai Nguyen",
+                            help='name of the author of the generated files')
+
+    my_parser.add_argument( '-d',
+                            '--destination',
+                            action='store',
+                            type=str,
+                            default=".",
+                            help='where the files will be saved')
+    args = my_parser.parse_args()
+
+    logger.info("input: {}".format(args.input))
+    logger.info("destination: {}".format(args.destination))
+
+    generate_files(args.input, args.destination, args.author)
+
+if __name__ == "__main__":
+    main()